@@ -0,0 +1,230 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Assets/SonyGamepadHapticClip.h"
+
+#include "Algo/Unique.h"
+#include "Core/Output/TriggerEffects.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/ObjectSaveContext.h"
+#if WITH_EDITOR
+#include "Settings/ProjectPackagingSettings.h"
+#endif
+
+#if WITH_EDITOR
+namespace
+{
+	uint32 ToMs(const float Seconds)
+	{
+		return static_cast<uint32>(FMath::RoundToInt(FMath::Max(Seconds, 0.0f) * 1000.0f));
+	}
+
+	/**
+	 * Index of the last key at or before a time, or INDEX_NONE before the first key. Keys are sorted.
+	 */
+	template <typename KeyType>
+	int32 FindKey(const TArray<KeyType>& Keys, const uint32 TimeMs)
+	{
+		int32 Found = INDEX_NONE;
+		for (int32 Index = 0; Index < Keys.Num() && ToMs(Keys[Index].Time) <= TimeMs; ++Index)
+		{
+			Found = Index;
+		}
+		return Found;
+	}
+
+	template <typename KeyType>
+	float GetAlpha(const TArray<KeyType>& Keys, const int32 Index, const uint32 TimeMs)
+	{
+		if (Index == INDEX_NONE || Index + 1 >= Keys.Num())
+		{
+			return 0.0f;
+		}
+		const uint32 Start = ToMs(Keys[Index].Time);
+		const uint32 End = ToMs(Keys[Index + 1].Time);
+		return End > Start ? static_cast<float>(TimeMs - Start) / (End - Start) : 0.0f;
+	}
+
+	unsigned char ToByte(const float Value)
+	{
+		return static_cast<unsigned char>(FMath::RoundToInt(FMath::Clamp(Value, 0.0f, 1.0f) * 255.0f));
+	}
+
+	FHapticTriggers ToTrigger(const FSonyGamepadClipTriggerKey& Key)
+	{
+		const int32 Start = FMath::Clamp(Key.StartPosition, 0, 8);
+		const int32 Strength = FMath::Clamp(Key.Strength, 1, 8);
+		switch (Key.Effect)
+		{
+		case ESonyGamepadClipTriggerEffect::Resistance:
+			return FTriggerEffects::ContinuousResistance(Start, Strength);
+		case ESonyGamepadClipTriggerEffect::Vibration:
+			return FTriggerEffects::Vibration(Start, Strength, FMath::Clamp(Key.Frequency, 0.0f, 1.0f));
+		default:
+			return FHapticTriggers();
+		}
+	}
+}
+#endif
+
+TSharedPtr<const FHapticClip> USonyGamepadHapticClip::OpenClip()
+{
+	if (TSharedPtr<const FHapticClip> Opened = Clip.Pin())
+	{
+		return Opened;
+	}
+
+#if WITH_EDITOR
+	// The file is only written on save, the keyframes being edited are more recent.
+	TArray<uint8> Data;
+	Compile(Data);
+	TSharedPtr<const FHapticClip> Opened = FHapticClip::FromMemory(MoveTemp(Data));
+#else
+	TSharedPtr<const FHapticClip> Opened = FHapticClip::Open(GetClipPath());
+#endif
+	Clip = Opened;
+	return Opened;
+}
+
+FString USonyGamepadHapticClip::GetClipPath() const
+{
+	const FString Relative = ClipFile.IsEmpty() ? FString::Printf(TEXT("HapticClips/%s.sghc"), *GetName()) : ClipFile;
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectContentDir() / Relative);
+}
+
+void USonyGamepadHapticClip::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+#if WITH_EDITOR
+	// Only editor saves write the file. The cooker may save for another platform or from several
+	// processes at once, so it only checks that the file it stages matches the keyframes.
+	if (ObjectSaveContext.IsCooking() || IsRunningCookCommandlet())
+	{
+		VerifyClipFile();
+		return;
+	}
+	if (ObjectSaveContext.IsProceduralSave())
+	{
+		return;
+	}
+
+	TArray<uint8> Data;
+	Compile(Data);
+	const FString Path = GetClipPath();
+	if (!FFileHelper::SaveArrayToFile(Data, *Path))
+	{
+		UE_LOG(LogTemp, Error, TEXT("HapticClip: Failed to write %s. A playing clip keeps its file open."), *Path);
+	}
+#endif
+}
+
+#if WITH_EDITOR
+void USonyGamepadHapticClip::Compile(TArray<uint8>& OutData) const
+{
+	auto SortByTime = [](auto& Keys)
+	{
+		Keys.StableSort([](const auto& A, const auto& B) { return A.Time < B.Time; });
+	};
+	TArray<FSonyGamepadClipRumbleKey> Rumble = RumbleKeys;
+	TArray<FSonyGamepadClipLightbarKey> Lightbar = LightbarKeys;
+	TArray<FSonyGamepadClipTriggerKey> LeftTrigger = LeftTriggerKeys;
+	TArray<FSonyGamepadClipTriggerKey> RightTrigger = RightTriggerKeys;
+	SortByTime(Rumble);
+	SortByTime(Lightbar);
+	SortByTime(LeftTrigger);
+	SortByTime(RightTrigger);
+
+	EHapticClipChannel Channels = EHapticClipChannel::None;
+	Channels |= Rumble.Num() > 0 ? EHapticClipChannel::Rumble : EHapticClipChannel::None;
+	Channels |= Lightbar.Num() > 0 ? EHapticClipChannel::Lightbar : EHapticClipChannel::None;
+	Channels |= LeftTrigger.Num() > 0 ? EHapticClipChannel::LeftTrigger : EHapticClipChannel::None;
+	Channels |= RightTrigger.Num() > 0 ? EHapticClipChannel::RightTrigger : EHapticClipChannel::None;
+
+	// One frame at every key time of any track. The player interpolates between frames like the tracks
+	// interpolate between keys, so the frames reproduce the tracks exactly.
+	TArray<uint32> Times;
+	for (const FSonyGamepadClipRumbleKey& Key : Rumble) { Times.Add(ToMs(Key.Time)); }
+	for (const FSonyGamepadClipLightbarKey& Key : Lightbar) { Times.Add(ToMs(Key.Time)); }
+	for (const FSonyGamepadClipTriggerKey& Key : LeftTrigger) { Times.Add(ToMs(Key.Time)); }
+	for (const FSonyGamepadClipTriggerKey& Key : RightTrigger) { Times.Add(ToMs(Key.Time)); }
+	Times.Sort();
+	Times.SetNum(Algo::Unique(Times));
+
+	TArray<FHapticClipFrame> Frames;
+	Frames.Reserve(Times.Num());
+	for (const uint32 Time : Times)
+	{
+		FHapticClipFrame& Frame = Frames.AddDefaulted_GetRef();
+		Frame.TimeMs = Time;
+
+		if (Rumble.Num() > 0)
+		{
+			const int32 Index = FMath::Max(FindKey(Rumble, Time), 0);
+			const int32 Next = FMath::Min(Index + 1, Rumble.Num() - 1);
+			const float Alpha = GetAlpha(Rumble, FindKey(Rumble, Time), Time);
+			Frame.Rumbles.Left = ToByte(FMath::Lerp(Rumble[Index].Left, Rumble[Next].Left, Alpha));
+			Frame.Rumbles.Right = ToByte(FMath::Lerp(Rumble[Index].Right, Rumble[Next].Right, Alpha));
+		}
+		if (Lightbar.Num() > 0)
+		{
+			const int32 Index = FMath::Max(FindKey(Lightbar, Time), 0);
+			const int32 Next = FMath::Min(Index + 1, Lightbar.Num() - 1);
+			const float Alpha = GetAlpha(Lightbar, FindKey(Lightbar, Time), Time);
+			const FLinearColor Color = FMath::Lerp(FLinearColor(Lightbar[Index].Color.R, Lightbar[Index].Color.G, Lightbar[Index].Color.B),
+			                                       FLinearColor(Lightbar[Next].Color.R, Lightbar[Next].Color.G, Lightbar[Next].Color.B), Alpha);
+			Frame.Lightbar.R = static_cast<unsigned char>(FMath::RoundToInt(Color.R));
+			Frame.Lightbar.G = static_cast<unsigned char>(FMath::RoundToInt(Color.G));
+			Frame.Lightbar.B = static_cast<unsigned char>(FMath::RoundToInt(Color.B));
+		}
+		if (const int32 Index = FindKey(LeftTrigger, Time); Index != INDEX_NONE)
+		{
+			Frame.LeftTrigger = ToTrigger(LeftTrigger[Index]);
+		}
+		if (const int32 Index = FindKey(RightTrigger, Time); Index != INDEX_NONE)
+		{
+			Frame.RightTrigger = ToTrigger(RightTrigger[Index]);
+		}
+	}
+
+	FHapticClip::Encode(Frames, Channels, ToMs(Duration), OutData);
+}
+
+void USonyGamepadHapticClip::VerifyClipFile() const
+{
+	TArray<uint8> Compiled;
+	Compile(Compiled);
+	const FString Path = GetClipPath();
+	TArray<uint8> OnDisk;
+	if (!FFileHelper::LoadFileToArray(OnDisk, *Path, FILEREAD_Silent))
+	{
+		UE_LOG(LogTemp, Error, TEXT("HapticClip: %s of %s is missing. Save the asset in the editor and submit the file."), *Path, *GetPathName());
+		return;
+	}
+	if (OnDisk != Compiled)
+	{
+		UE_LOG(LogTemp, Error, TEXT("HapticClip: %s does not match the keyframes of %s. Save the asset in the editor and submit the file."), *Path, *GetPathName());
+		return;
+	}
+
+	const FString ContentDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectContentDir());
+	for (const FDirectoryPath& Directory : GetDefault<UProjectPackagingSettings>()->DirectoriesToAlwaysStageAsNonUFS)
+	{
+		if (!Directory.Path.IsEmpty() && FPaths::IsUnderDirectory(Path, ContentDir / Directory.Path))
+		{
+			return;
+		}
+	}
+	UE_LOG(LogTemp, Error, TEXT("HapticClip: %s of %s is not staged. Add its directory to \"Additional Non-Asset Directories To Copy\"."),
+	       *Path, *GetPathName());
+}
+
+void USonyGamepadHapticClip::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	// Playbacks keep the clip they started with, the next one compiles the new keyframes.
+	Clip.Reset();
+}
+#endif
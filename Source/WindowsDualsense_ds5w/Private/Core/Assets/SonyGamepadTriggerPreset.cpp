@@ -0,0 +1,153 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Assets/SonyGamepadTriggerPreset.h"
+
+#include "Core/Output/TriggerEffects.h"
+#include "UObject/ObjectSaveContext.h"
+#if WITH_EDITOR && !UE_VERSION_OLDER_THAN(5, 3, 0)
+#include "Misc/DataValidation.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "SonyGamepadTriggerPreset"
+
+FHapticTriggers USonyGamepadTriggerPreset::GetEffect() const
+{
+	if (Compiled.Num() != SONY_GAMEPAD_TRIGGER_EFFECT_SIZE)
+	{
+		return FHapticTriggers();
+	}
+	return FTriggerEffects::FromEncoded(Compiled.GetData());
+}
+
+void USonyGamepadTriggerPreset::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+#if WITH_EDITOR
+	TArray<FText> Errors;
+	if (!Validate(Errors))
+	{
+		for (const FText& Error : Errors)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("TriggerPreset: %s: %s The value is clamped."), *GetPathName(), *Error.ToString());
+		}
+	}
+	Compile();
+#endif
+}
+
+#if WITH_EDITOR
+void USonyGamepadTriggerPreset::PostLoad()
+{
+	Super::PostLoad();
+	// Presets saved before the bytes existed, or by an older encoder.
+	Compile();
+}
+
+void USonyGamepadTriggerPreset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	Compile();
+}
+
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+EDataValidationResult USonyGamepadTriggerPreset::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+	TArray<FText> Errors;
+	if (!Validate(Errors))
+	{
+		for (const FText& Error : Errors)
+		{
+			Context.AddError(Error);
+		}
+		return EDataValidationResult::Invalid;
+	}
+	return Result;
+}
+#endif
+
+bool USonyGamepadTriggerPreset::Validate(TArray<FText>& OutErrors) const
+{
+	const int32 Errors = OutErrors.Num();
+	auto CheckRange = [&OutErrors](const TCHAR* Name, const float Value, const float Min, const float Max)
+	{
+		if (Value < Min || Value > Max)
+		{
+			OutErrors.Add(FText::Format(LOCTEXT("OutOfRange", "{0} is {1}, outside of {2} to {3}."),
+			                            FText::FromString(Name), FText::AsNumber(Value), FText::AsNumber(Min), FText::AsNumber(Max)));
+		}
+	};
+	auto CheckOrder = [&OutErrors, this]()
+	{
+		if (Effect.StartPosition >= Effect.EndPosition)
+		{
+			OutErrors.Add(LOCTEXT("Order", "StartPosition must be before EndPosition."));
+		}
+	};
+
+	switch (Effect.Effect)
+	{
+	case ESonyGamepadTriggerEffect::ContinuousResistance:
+		CheckRange(TEXT("StartPosition"), Effect.StartPosition, 0, 8);
+		CheckRange(TEXT("BeginStrength"), Effect.BeginStrength, 0, 8);
+		break;
+	case ESonyGamepadTriggerEffect::Resistance:
+		// Zones store their strength minus one, so a zone is either off or from 1 to 8.
+		CheckRange(TEXT("BeginStrength"), Effect.BeginStrength, 0, 8);
+		CheckRange(TEXT("MiddleStrength"), Effect.MiddleStrength, 0, 8);
+		CheckRange(TEXT("EndStrength"), Effect.EndStrength, 0, 8);
+		break;
+	case ESonyGamepadTriggerEffect::Weapon:
+		CheckRange(TEXT("StartPosition"), Effect.StartPosition, 0, 8);
+		CheckRange(TEXT("EndPosition"), Effect.EndPosition, 0, 8);
+		CheckRange(TEXT("BeginStrength"), Effect.BeginStrength, 0, 8);
+		CheckOrder();
+		break;
+	case ESonyGamepadTriggerEffect::Galloping:
+		CheckRange(TEXT("StartPosition"), Effect.StartPosition, 0, 8);
+		CheckRange(TEXT("EndPosition"), Effect.EndPosition, 0, 8);
+		CheckRange(TEXT("FirstFoot"), Effect.FirstFoot, 0, 7);
+		CheckRange(TEXT("SecondFoot"), Effect.SecondFoot, 0, 7);
+		CheckRange(TEXT("Frequency"), Effect.Frequency, 0.0f, 1.0f);
+		CheckOrder();
+		break;
+	case ESonyGamepadTriggerEffect::Machine:
+		CheckRange(TEXT("StartPosition"), Effect.StartPosition, 0, 8);
+		CheckRange(TEXT("EndPosition"), Effect.EndPosition, 0, 8);
+		// Amplitudes are packed in 3 bits.
+		CheckRange(TEXT("BeginStrength"), Effect.BeginStrength, 0, 7);
+		CheckRange(TEXT("EndStrength"), Effect.EndStrength, 0, 7);
+		CheckRange(TEXT("Frequency"), Effect.Frequency, 0.0f, 1.0f);
+		CheckRange(TEXT("Period"), Effect.Period, 0.0f, 3.0f);
+		CheckOrder();
+		break;
+	case ESonyGamepadTriggerEffect::Bow:
+		CheckRange(TEXT("StartPosition"), Effect.StartPosition, 0, 8);
+		CheckRange(TEXT("EndPosition"), Effect.EndPosition, 0, 8);
+		CheckRange(TEXT("BeginStrength"), Effect.BeginStrength, 1, 8);
+		CheckRange(TEXT("EndStrength"), Effect.EndStrength, 1, 8);
+		CheckOrder();
+		break;
+	case ESonyGamepadTriggerEffect::AutomaticGun:
+		CheckRange(TEXT("BeginStrength"), Effect.BeginStrength, 0, 8);
+		CheckRange(TEXT("MiddleStrength"), Effect.MiddleStrength, 0, 8);
+		CheckRange(TEXT("EndStrength"), Effect.EndStrength, 0, 8);
+		break;
+	default:
+		break;
+	}
+	return OutErrors.Num() == Errors;
+}
+
+void USonyGamepadTriggerPreset::Compile()
+{
+	unsigned char Bytes[SONY_GAMEPAD_TRIGGER_EFFECT_SIZE];
+	FTriggerEffects::Encode(FTriggerEffects::Build(Effect), Bytes);
+	Compiled = TArray<uint8>(Bytes, SONY_GAMEPAD_TRIGGER_EFFECT_SIZE);
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,43 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Assets/SonyGamepadTriggerTimeline.h"
+
+#include "Core/Output/TriggerEffects.h"
+
+TSharedPtr<const FTriggerTimeline> USonyGamepadTriggerTimeline::GetTimeline()
+{
+	if (Timeline.IsValid())
+	{
+		return Timeline;
+	}
+
+	const TSharedRef<FTriggerTimeline> Compiled = MakeShared<FTriggerTimeline>();
+	Compiled->Layer = Layer;
+	Compiled->bHoldLastEffect = bHoldLastEffect;
+	Compiled->Duration = FMath::Max(Duration, 0.0f);
+	Compiled->Keys.Reserve(Keys.Num());
+	for (const FSonyGamepadTriggerTimelineKey& Key : Keys)
+	{
+		FTriggerTimeline::FKey& Entry = Compiled->Keys.AddDefaulted_GetRef();
+		Entry.Time = FMath::Max(Key.Time, 0.0f);
+		Entry.bLeft = Key.Hand == EControllerHand::Left || Key.Hand == EControllerHand::AnyHand;
+		Entry.bRight = Key.Hand == EControllerHand::Right || Key.Hand == EControllerHand::AnyHand;
+		Entry.Effect = FTriggerEffects::Build(Key.Effect);
+		Compiled->Duration = FMath::Max(Compiled->Duration, Entry.Time);
+	}
+	Compiled->Keys.StableSort([](const FTriggerTimeline::FKey& A, const FTriggerTimeline::FKey& B) { return A.Time < B.Time; });
+
+	Timeline = Compiled;
+	return Timeline;
+}
+
+#if WITH_EDITOR
+void USonyGamepadTriggerTimeline::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	// Playbacks keep the timeline they started with, the next one compiles the new keys.
+	Timeline.Reset();
+}
+#endif
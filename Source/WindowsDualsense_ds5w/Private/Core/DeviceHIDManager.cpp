@@ -9,6 +9,7 @@
 #include <windows.h>
 #include <hidsdi.h>
 #include <setupapi.h>
+#include "Core/Enums/EDeviceCommons.h"
 #include "Core/Structs/FDeviceContext.h"
 #include "Helpers/ValidateHelpers.h"
 #include "Windows/HideWindowsPlatformTypes.h"
@@ -110,13 +111,10 @@ bool UDeviceHIDManager::FindDevices(TArray<FDeviceContext>& Devices)
 							DevicePath.Contains(TEXT("bth")) ||
 							DevicePath.Contains(TEXT("BTHENUM")))
 						{
-							unsigned char FeatureBuffer[78];
-							FeatureBuffer[0] = 0x05;
-							if (!HidD_GetFeature(TempDeviceHandle, FeatureBuffer, 78)) {
-								UE_LOG(LogTemp, Warning, TEXT("HIDManager: Failed to HidD_GetFeature for the DualShock."));
-							}
 							Context.ConnectionType = Bluetooth;
 						}
+
+						ReadCalibration(TempDeviceHandle, Context);
 						
 						Devices.Add(Context);
 						UE_LOG(LogTemp, Log, TEXT("HIDManager: Found at %s"), Context.Path);
@@ -150,6 +148,58 @@ HANDLE UDeviceHIDManager::CreateHandle(FDeviceContext* DeviceContext)
 	return DeviceHandle;
 }
 
+void UDeviceHIDManager::ReadCalibration(const HANDLE DeviceHandle, FDeviceContext& Context)
+{
+	const bool bDualShockUsb = Context.DeviceType == DualShock4 && Context.ConnectionType == Usb;
+
+	unsigned char FeatureBuffer[78] = {};
+	FeatureBuffer[0] = bDualShockUsb ? 0x02 : 0x05;
+	if (!HidD_GetFeature(DeviceHandle, FeatureBuffer, sizeof(FeatureBuffer)))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HIDManager: Failed to read the IMU calibration, Error: %d"), GetLastError());
+		return;
+	}
+
+	const auto Word = [&FeatureBuffer](const int32 Offset)
+	{
+		return static_cast<int32>(static_cast<int16>(FeatureBuffer[Offset] | (FeatureBuffer[Offset + 1] << 8)));
+	};
+
+	// Per gyroscope axis, the bias and the readings at a known rate in both directions. The DualShock 4
+	// over USB lists every plus reading before the minus ones, the other layouts interleave them.
+	const int32 GyroSpeed2x = Word(19) + Word(21);
+	FImuCalibration Calibration;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const int32 GyroBias = Word(1 + Axis * 2);
+		const int32 GyroPlus = Word(bDualShockUsb ? 7 + Axis * 2 : 7 + Axis * 4);
+		const int32 GyroMinus = Word(bDualShockUsb ? 13 + Axis * 2 : 9 + Axis * 4);
+		const int32 GyroRange = FMath::Abs(GyroPlus - GyroBias) + FMath::Abs(GyroMinus - GyroBias);
+		Calibration.Bias[Axis] = GyroBias;
+		Calibration.Scale[Axis] = GyroRange > 0 ? FMath::RoundToInt32(GyroSpeed2x * GYRO_RAW_PER_DEGREE_S * 65536.0 / GyroRange) : 0;
+
+		// Readings at +1 g and -1 g; the bias is their midpoint.
+		const int32 AccelPlus = Word(23 + Axis * 4);
+		const int32 AccelMinus = Word(25 + Axis * 4);
+		const int32 AccelRange = AccelPlus - AccelMinus;
+		Calibration.Bias[Axis + 3] = AccelPlus - AccelRange / 2;
+		Calibration.Scale[Axis + 3] = AccelRange > 0 ? FMath::RoundToInt32(2.0 * ACCEL_RAW_PER_G * 65536.0 / AccelRange) : 0;
+	}
+
+	// A scale more than twice away from the nominal one means a blank or corrupted calibration block.
+	for (int32 Axis = 0; Axis < IMU_CALIBRATION_AXES; ++Axis)
+	{
+		if (Calibration.Scale[Axis] < 32768 || Calibration.Scale[Axis] > 131072)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HIDManager: Ignoring invalid IMU calibration for %s"), Context.Path);
+			return;
+		}
+	}
+
+	Calibration.bValid = true;
+	Context.Calibration = Calibration;
+}
+
 bool UDeviceHIDManager::GetDeviceInputState(FDeviceContext* DeviceContext)
 {
 	if (DeviceContext->Handle == INVALID_HANDLE_VALUE)
@@ -212,19 +262,49 @@ void UDeviceHIDManager::FreeContext(FDeviceContext* Context)
 
 void UDeviceHIDManager::OutputDualShock(FDeviceContext* DeviceContext)
 {
-	const FOutputContext* HidOut = &DeviceContext->Output;
+	WriteOutput(DeviceContext, BuildOutputDualShock(DeviceContext));
+}
+
+void UDeviceHIDManager::OutputDualSense(FDeviceContext* DeviceContext)
+{
+	WriteOutput(DeviceContext, BuildOutputDualSense(DeviceContext));
+}
+
+void UDeviceHIDManager::WriteOutput(FDeviceContext* DeviceContext, const uint32 Length)
+{
+	DWORD BytesWritten = 0;
+	if (!WriteFile(DeviceContext->Handle, DeviceContext->BufferOutput, Length, &BytesWritten, nullptr))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write output data to device. report %u Error Code: %d"), Length, GetLastError());
+		FreeContext(DeviceContext);
+	}
+}
+
+uint32 UDeviceHIDManager::BuildOutputDualShock(FDeviceContext* DeviceContext)
+{
+	return BuildOutputDualShock(DeviceContext->Output, DeviceContext->ConnectionType, DeviceContext->BufferOutput);
+}
 
-	size_t Padding = DeviceContext->ConnectionType == Bluetooth ? 2 : 1;
-	DeviceContext->BufferOutput[0] = DeviceContext->ConnectionType == Bluetooth ? 0x11 : 0x05;
+uint32 UDeviceHIDManager::BuildOutputDualSense(FDeviceContext* DeviceContext)
+{
+	return BuildOutputDualSense(DeviceContext->Output, DeviceContext->ConnectionType, DeviceContext->BufferOutput);
+}
+
+uint32 UDeviceHIDManager::BuildOutputDualShock(const FOutputContext& OutputContext, const EDeviceConnection Connection, unsigned char* Buffer)
+{
+	const FOutputContext* HidOut = &OutputContext;
+
+	size_t Padding = Connection == Bluetooth ? 2 : 1;
+	Buffer[0] = Connection == Bluetooth ? 0x11 : 0x05;
 
-	if (DeviceContext->ConnectionType == Bluetooth)
+	if (Connection == Bluetooth)
 	{
-		DeviceContext->BufferOutput[1] = 0xc0;
+		Buffer[1] = 0xc0;
 	}
 	
-	unsigned char* Output = &DeviceContext->BufferOutput[Padding];
+	unsigned char* Output = &Buffer[Padding];
 
-	if (DeviceContext->ConnectionType == Bluetooth)
+	if (Connection == Bluetooth)
 	{
 		Output[0] = 0x20;
 		Output[1] = 0x07;
@@ -242,36 +322,29 @@ void UDeviceHIDManager::OutputDualShock(FDeviceContext* DeviceContext)
 	Output[8 + (Padding - 1)] = HidOut->FlashLigthbar.Bright_Time;
 	Output[9 + (Padding - 1)] = HidOut->FlashLigthbar.Toggle_Time;
 
-	if (DeviceContext->ConnectionType == Bluetooth)
+	if (Connection == Bluetooth)
 	{
-		const UINT32 CrcChecksum = Compute(DeviceContext->BufferOutput, 74);
-		DeviceContext->BufferOutput[0x4A] = static_cast<unsigned char>((CrcChecksum & 0x000000FF) >> 0UL);
-		DeviceContext->BufferOutput[0x4B] = static_cast<unsigned char>((CrcChecksum & 0x0000FF00) >> 8UL);
-		DeviceContext->BufferOutput[0x4C] = static_cast<unsigned char>((CrcChecksum & 0x00FF0000) >> 16UL);
-		DeviceContext->BufferOutput[0x4D] = static_cast<unsigned char>((CrcChecksum & 0xFF000000) >> 24UL);
+		const UINT32 CrcChecksum = Compute(Buffer, 74);
+		Buffer[0x4A] = static_cast<unsigned char>((CrcChecksum & 0x000000FF) >> 0UL);
+		Buffer[0x4B] = static_cast<unsigned char>((CrcChecksum & 0x0000FF00) >> 8UL);
+		Buffer[0x4C] = static_cast<unsigned char>((CrcChecksum & 0x00FF0000) >> 16UL);
+		Buffer[0x4D] = static_cast<unsigned char>((CrcChecksum & 0xFF000000) >> 24UL);
 	}
 	
-	const size_t OutputReportLength = DeviceContext->ConnectionType == Bluetooth ? 78 : 32;
-	
-	DWORD BytesWritten = 0;
-	if (!WriteFile(DeviceContext->Handle, DeviceContext->BufferOutput, OutputReportLength, &BytesWritten, nullptr))
-	{
-		UE_LOG(LogTemp, Error, TEXT("Failed DualShock to write output data to device. report %llu error Code: %d"), OutputReportLength, GetLastError());
-		FreeContext(DeviceContext);
-	}
+	return Connection == Bluetooth ? 78 : 32;
 }
 
-void UDeviceHIDManager::OutputDualSense(FDeviceContext* DeviceContext)
+uint32 UDeviceHIDManager::BuildOutputDualSense(const FOutputContext& OutputContext, const EDeviceConnection Connection, unsigned char* Buffer)
 {
-	const size_t Padding = DeviceContext->ConnectionType == Bluetooth ? 2 : 1;
-	DeviceContext->BufferOutput[0] = DeviceContext->ConnectionType == Bluetooth ? 0x31 : 0x02;
-	if (DeviceContext->ConnectionType == Bluetooth)
+	const size_t Padding = Connection == Bluetooth ? 2 : 1;
+	Buffer[0] = Connection == Bluetooth ? 0x31 : 0x02;
+	if (Connection == Bluetooth)
 	{
-		DeviceContext->BufferOutput[1] = 0x02;
+		Buffer[1] = 0x02;
 	}
 
-	FOutputContext* HidOut = &DeviceContext->Output;
-	unsigned char*  Output = &DeviceContext->BufferOutput[Padding];
+	const FOutputContext* HidOut = &OutputContext;
+	unsigned char*  Output = &Buffer[Padding];
 	Output[0] = HidOut->Feature.VibrationMode;
 	Output[1] = HidOut->Feature.FeatureMode;
 	Output[2] = HidOut->Rumbles.Left;
@@ -296,22 +369,16 @@ void UDeviceHIDManager::OutputDualSense(FDeviceContext* DeviceContext)
 	
 	SetTriggerEffects(&Output[10], HidOut->RightTrigger);
 	SetTriggerEffects(&Output[21], HidOut->LeftTrigger);
-	if (DeviceContext->ConnectionType == Bluetooth)
+	if (Connection == Bluetooth)
 	{
-		const UINT32 CrcChecksum = Compute(DeviceContext->BufferOutput, 74);
-		DeviceContext->BufferOutput[0x4A] = static_cast<unsigned char>((CrcChecksum & 0x000000FF) >> 0UL);
-		DeviceContext->BufferOutput[0x4B] = static_cast<unsigned char>((CrcChecksum & 0x0000FF00) >> 8UL);
-		DeviceContext->BufferOutput[0x4C] = static_cast<unsigned char>((CrcChecksum & 0x00FF0000) >> 16UL);
-		DeviceContext->BufferOutput[0x4D] = static_cast<unsigned char>((CrcChecksum & 0xFF000000) >> 24UL);
+		const UINT32 CrcChecksum = Compute(Buffer, 74);
+		Buffer[0x4A] = static_cast<unsigned char>((CrcChecksum & 0x000000FF) >> 0UL);
+		Buffer[0x4B] = static_cast<unsigned char>((CrcChecksum & 0x0000FF00) >> 8UL);
+		Buffer[0x4C] = static_cast<unsigned char>((CrcChecksum & 0x00FF0000) >> 16UL);
+		Buffer[0x4D] = static_cast<unsigned char>((CrcChecksum & 0xFF000000) >> 24UL);
 	}
 
-	const size_t OutputReportLength = DeviceContext->ConnectionType == Bluetooth ? 78 : 74;
-	DWORD BytesWritten = 0;
-	if (!WriteFile(DeviceContext->Handle, DeviceContext->BufferOutput, OutputReportLength, &BytesWritten, nullptr))
-	{
-		UE_LOG(LogTemp, Error, TEXT("Failed DualSense to write output data to device. report %llu Error Code: %d"), OutputReportLength, GetLastError());
-		FreeContext(DeviceContext);
-	}
+	return Connection == Bluetooth ? 78 : 74;
 }
 
 // for (size_t i = 0; i < 78; ++i)
@@ -320,8 +387,14 @@ void UDeviceHIDManager::OutputDualSense(FDeviceContext* DeviceContext)
 // 	UE_LOG(LogTemp, Log, TEXT("Buffer Byte[%02d]: 0x%02X"), i, DeviceContext->Buffer[i]);
 // }
 
-void UDeviceHIDManager::SetTriggerEffects(unsigned char* Trigger, FHapticTriggers& Effect)
+void UDeviceHIDManager::SetTriggerEffects(unsigned char* Trigger, const FHapticTriggers& Effect)
 {
+	if (Effect.bEncoded)
+	{
+		FMemory::Memcpy(Trigger, Effect.Encoded, SONY_GAMEPAD_TRIGGER_EFFECT_SIZE);
+		return;
+	}
+
 	Trigger[0x0] = Effect.Mode;
 
 	if (Effect.Mode == 0x01) // Continuous Resistance
@@ -6,6 +6,9 @@
 #include "Core/DualShock/DualShockLibrary.h"
 #include <Windows.h>
 #include "Core/DeviceHIDManager.h"
+#include "Core/Input/SonyGamepadStateRegistry.h"
+#include "Core/Input/SonyInputDecoder.h"
+#include "Core/Output/OutputScheduler.h"
 #include "InputCoreTypes.h"
 #include "Core/Structs/FOutputContext.h"
 #include "Helpers/ValidateHelpers.h"
@@ -21,14 +24,60 @@ void UDualShockLibrary::Settings(const FDualShockFeatureReport& Settings)
 bool UDualShockLibrary::InitializeLibrary(const FDeviceContext& Context)
 {
 	HIDDeviceContexts = Context;
+	if (!FOutputScheduler::Get().Register(ControllerID, Context.Handle, Context.DeviceType, Context.ConnectionType, Context.Output))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DualShock: output scheduler unavailable, writing reports synchronously."));
+	}
 	SetLightbar(FColor::Green, 0.0f, 0.0f);
 	UE_LOG(LogTemp, Log, TEXT("Initializing device model (DualShock 4)"));
+
+	const bool bIsBluetooth = Context.ConnectionType == Bluetooth;
+	InputReader = MakeUnique<FDeviceInputReader>(Context.Path, bIsBluetooth ? 547 : 64, 250.0f);
+	InputReader->SetStatePublisher(&FSonyInputDecoder::DecodeDualShock, Context.ConnectionType, Context.Calibration,
+	                               FSonyGamepadStateRegistry::GetBuffer(ControllerID), FSonyGamepadStateRegistry::GetHistory(ControllerID));
+	InputReader->SetLookProcessor(FSonyGamepadStateRegistry::GetLookProcessor(ControllerID));
+	InputReader->SetTouchTracker(FSonyGamepadStateRegistry::GetTouchTracker(ControllerID));
+	InputReader->SetAnalogConditioner(FSonyGamepadStateRegistry::GetAnalogConditioner(ControllerID));
+	InputReader->SetButtonRemapper(FSonyGamepadStateRegistry::GetButtonRemapper(ControllerID));
+	if (!InputReader->Start())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DualShock: input reader thread unavailable, reading reports synchronously."));
+		InputReader.Reset();
+	}
 	return true;
 }
 
 void UDualShockLibrary::ShutdownLibrary()
 {
-	ButtonStates.Reset();
+	FOutputScheduler::Get().Unregister(ControllerID);
+	InputReader.Reset();
+	InputState = FSonyGamepadInputState();
+	MotionFusion.Reset();
+	if (FInputStateBuffer* StateBuffer = FSonyGamepadStateRegistry::GetBuffer(ControllerID))
+	{
+		StateBuffer->Reset();
+	}
+	if (FGyroLookProcessor* LookProcessor = FSonyGamepadStateRegistry::GetLookProcessor(ControllerID))
+	{
+		LookProcessor->Reset();
+	}
+	if (FTouchTracker* TouchTracker = FSonyGamepadStateRegistry::GetTouchTracker(ControllerID))
+	{
+		TouchTracker->Reset();
+	}
+	if (FAnalogConditioner* AnalogConditioner = FSonyGamepadStateRegistry::GetAnalogConditioner(ControllerID))
+	{
+		AnalogConditioner->Reset();
+	}
+	if (FButtonRemapper* ButtonRemapper = FSonyGamepadStateRegistry::GetButtonRemapper(ControllerID))
+	{
+		// The reader thread is stopped, so no replaced profile is still announced.
+		ButtonRemapper->ReleaseRetired();
+	}
+	if (FInputPredictor* Predictor = FSonyGamepadStateRegistry::GetPredictor(ControllerID))
+	{
+		Predictor->Reset();
+	}
 	UDeviceHIDManager::FreeContext(&HIDDeviceContexts);
 }
 
@@ -51,167 +100,141 @@ void UDualShockLibrary::SendOut()
 		return;
 	}
 	
-	UDeviceHIDManager::OutputDualShock(&HIDDeviceContexts);
+	SendCommand(FOutputCommand(EOutputCommand::Flush));
 }
 
-void UDualShockLibrary::CheckButtonInput(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
-	const FPlatformUserId UserId, const FInputDeviceId InputDeviceId, const FName ButtonName,
-	const bool IsButtonPressed)
+void UDualShockLibrary::SendCommand(const FOutputCommand& Command)
 {
-	const bool PreviousState = ButtonStates.Contains(ButtonName) ? ButtonStates[ButtonName] : false;
-	if (IsButtonPressed && !PreviousState)
+	if (!HIDDeviceContexts.IsConnected)
 	{
-		InMessageHandler.Get().OnControllerButtonPressed(ButtonName, UserId, InputDeviceId, false);
+		return;
 	}
 
-	if (!IsButtonPressed && PreviousState)
+	if (!FOutputScheduler::Get().Enqueue(ControllerID, Command))
 	{
-		InMessageHandler.Get().OnControllerButtonReleased(ButtonName, UserId, InputDeviceId, false);
+		// Without the scheduler thread, the report is built and written from the calling thread.
+		Command.Apply(HIDDeviceContexts.Output);
+		UDeviceHIDManager::OutputDualShock(&HIDDeviceContexts);
 	}
-
-	ButtonStates.Add(ButtonName, IsButtonPressed);
 }
 
 bool UDualShockLibrary::UpdateInput(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
 	const FPlatformUserId UserId, const FInputDeviceId InputDeviceId)
 {
-	if (UDeviceHIDManager::GetDeviceInputState(&HIDDeviceContexts))
+	uint32 BufferSize = 0;
+	unsigned char* Buffer = GetInputBuffer(BufferSize);
+
+	if (!InputReader.IsValid())
 	{
-		const unsigned char* HIDInput;
-		if (HIDDeviceContexts.ConnectionType == Bluetooth)
+		if (!UDeviceHIDManager::GetDeviceInputState(&HIDDeviceContexts))
+		{
+			FOutputScheduler::Get().Unregister(ControllerID);
+			return false;
+		}
+
+		FSonyGamepadInputState State = InputState;
+		FSonyInputDecoder::DecodeDualShock(Buffer, HIDDeviceContexts.ConnectionType, HIDDeviceContexts.Calibration, State);
+		State.Timestamp = FPlatformTime::Seconds();
+		State.Sequence = InputState.Sequence + 1;
+		if (const FButtonRemapper* ButtonRemapper = FSonyGamepadStateRegistry::GetButtonRemapper(ControllerID))
+		{
+			State.Buttons = ButtonRemapper->Apply(State.Buttons);
+		}
+		if (FAnalogConditioner* AnalogConditioner = FSonyGamepadStateRegistry::GetAnalogConditioner(ControllerID))
 		{
-			HIDInput = &HIDDeviceContexts.BufferDS4[3];
+			AnalogConditioner->Apply(State);
 		}
-		else
+		FSonyInputDecoder::UpdateMotion(State, InputState.Timestamp, MotionFusion);
+		FTouchTracker* TouchTracker = FSonyGamepadStateRegistry::GetTouchTracker(ControllerID);
+		if (TouchTracker)
+		{
+			TouchTracker->Process(State);
+		}
+		ProcessInputReport(InMessageHandler, UserId, InputDeviceId, State);
+
+		// Without the reader thread, the state is published from here.
+		if (FInputStateBuffer* StateBuffer = FSonyGamepadStateRegistry::GetBuffer(ControllerID))
 		{
-			HIDInput = &HIDDeviceContexts.Buffer[1];
+			StateBuffer->Publish(State);
 		}
-		
-		// Triggers
-		const bool bLeftTriggerThreshold = HIDInput[0x05] & BTN_LEFT_TRIGGER;
-		const bool bRightTriggerThreshold = HIDInput[0x05] & BTN_RIGHT_TRIGGER;
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::LeftTriggerThreshold, bLeftTriggerThreshold);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::RightTriggerThreshold, bRightTriggerThreshold);
-
-		// Triggers Analog 1D
-		const float TriggerL = HIDInput[0x07] / 256.0f;
-		const float TriggerR = HIDInput[0x08] / 256.0f;
-		InMessageHandler.Get().OnControllerAnalog(FGamepadKeyNames::LeftTriggerAnalog, UserId, InputDeviceId, TriggerL);
-		InMessageHandler.Get().OnControllerAnalog(FGamepadKeyNames::RightTriggerAnalog, UserId, InputDeviceId, TriggerR);
-
-		// Analogs
-		const float LeftAnalogX = static_cast<char>(static_cast<short>(HIDInput[0x00] - 128));
-		const float LeftAnalogY = static_cast<char>(static_cast<short>(HIDInput[0x01] - 127) * -1);
-		InMessageHandler.Get().OnControllerAnalog(FGamepadKeyNames::LeftAnalogX, UserId, InputDeviceId, LeftAnalogX / 128.0f);
-		InMessageHandler.Get().OnControllerAnalog(FGamepadKeyNames::LeftAnalogY, UserId, InputDeviceId, LeftAnalogY / 128.0f);
-
-		const float RightAnalogX = static_cast<char>(static_cast<short>(HIDInput[0x02] - 128));
-		const float RightAnalogY = static_cast<char>(static_cast<short>(HIDInput[0x03] - 127) * -1);
-		InMessageHandler.Get().OnControllerAnalog(FGamepadKeyNames::RightAnalogX, UserId, InputDeviceId, RightAnalogX / 128.0f);
-		InMessageHandler.Get().OnControllerAnalog(FGamepadKeyNames::RightAnalogY, UserId, InputDeviceId, RightAnalogY / 128.0f);
-
-		uint8_t ButtonsMask = HIDInput[0x04] & 0xF0;
-		const bool bCross = ButtonsMask & BTN_CROSS;
-		const bool bSquare = ButtonsMask & BTN_SQUARE;
-		const bool bCircle = ButtonsMask & BTN_CIRCLE;
-		const bool bTriangle = ButtonsMask & BTN_TRIANGLE;
-
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::FaceButtonBottom, bCross);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::FaceButtonLeft, bSquare);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::FaceButtonRight, bCircle);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::FaceButtonTop, bTriangle);
-
-		switch (HIDInput[0x04] & 0x0F)
+		if (FInputSampleHistory* History = FSonyGamepadStateRegistry::GetHistory(ControllerID))
 		{
-			case 0x0:
-				ButtonsMask |= BTN_DPAD_UP;
-				break;
-			case 0x4:
-				ButtonsMask |= BTN_DPAD_DOWN;
-				break;
-			case 0x6:
-				ButtonsMask |= BTN_DPAD_LEFT;
-				break;
-			case 0x2:
-				ButtonsMask |= BTN_DPAD_RIGHT;
-				break;
-			case 0x5:
-				ButtonsMask |= BTN_DPAD_LEFT | BTN_DPAD_DOWN;
-				break;
-			case 0x7:
-				ButtonsMask |= BTN_DPAD_LEFT | BTN_DPAD_UP;
-				break;
-			case 0x1:
-				ButtonsMask |= BTN_DPAD_RIGHT | BTN_DPAD_UP;
-				break;
-			case 0x3:
-				ButtonsMask |= BTN_DPAD_RIGHT | BTN_DPAD_DOWN;
-				break;
-			default: ;
+			History->Push(State);
+		}
+		if (FGyroLookProcessor* LookProcessor = FSonyGamepadStateRegistry::GetLookProcessor(ControllerID))
+		{
+			LookProcessor->Process(State);
+		}
+		if (TouchTracker)
+		{
+			FSonyInputDecoder::DispatchGestures(InMessageHandler, UserId, InputDeviceId, *TouchTracker, EnableTouch);
 		}
-		const bool bDPadLeft = ButtonsMask & BTN_DPAD_LEFT;
-		const bool bDPadDown = ButtonsMask & BTN_DPAD_DOWN;
-		const bool bDPadRight = ButtonsMask & BTN_DPAD_RIGHT;
-		const bool bDPadUp = ButtonsMask & BTN_DPAD_UP;
-		
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::DPadUp, bDPadUp);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::DPadDown, bDPadDown);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::DPadLeft, bDPadLeft);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::DPadRight, bDPadRight);
-
-		// Shoulders
-		const bool bLeftShoulder = HIDInput[0x05] & BTN_LEFT_SHOLDER;
-		const bool bRightShoulder = HIDInput[0x05] & BTN_RIGHT_SHOLDER;
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::LeftShoulder, bLeftShoulder);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::RightShoulder, bRightShoulder);
-		
-		// Push Stick
-		const bool PushLeftStick = HIDInput[0x05] & BTN_LEFT_STICK;
-		const bool PushRightStick = HIDInput[0x05] & BTN_RIGHT_STICK;
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FName("PS_PushLeftStick"), PushLeftStick);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FName("PS_PushRightStick"), PushRightStick);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::LeftThumb, PushLeftStick);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::RightThumb, PushRightStick);
-
-		const bool Start = HIDInput[0x05] & BTN_START;
-		const bool Select = HIDInput[0x05] & BTN_SELECT;
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FName("PS_Menu"), Start);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FName("PS_Share"), Select);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::SpecialRight, Start);
-		CheckButtonInput(InMessageHandler, UserId, InputDeviceId, FGamepadKeyNames::SpecialLeft, Select);
-		
-		// UValidateHelpers::PrintBufferAsHex(HIDInput, 78);
 		return true;
 	}
-	return false;
+
+	if (InputReader->IsDeviceLost())
+	{
+		FOutputScheduler::Get().Unregister(ControllerID);
+		UDeviceHIDManager::FreeContext(&HIDDeviceContexts);
+		return false;
+	}
+
+	FSonyGamepadInputState State;
+	if (PollingPolicy == EPollingPolicy::NativeRate)
+	{
+		while (InputReader->PopNext(Buffer, BufferSize, nullptr, &State))
+		{
+			ProcessInputReport(InMessageHandler, UserId, InputDeviceId, State);
+		}
+	}
+	else if (PollingPolicy == EPollingPolicy::FixedRate)
+	{
+		while (InputReader->PopAtRate(FixedRateInterval, Buffer, BufferSize, nullptr, &State))
+		{
+			ProcessInputReport(InMessageHandler, UserId, InputDeviceId, State);
+		}
+	}
+	else if (InputReader->PopLatest(Buffer, BufferSize, nullptr, &State))
+	{
+		ProcessInputReport(InMessageHandler, UserId, InputDeviceId, State);
+	}
+
+	if (FTouchTracker* TouchTracker = FSonyGamepadStateRegistry::GetTouchTracker(ControllerID))
+	{
+		FSonyInputDecoder::DispatchGestures(InMessageHandler, UserId, InputDeviceId, *TouchTracker, EnableTouch);
+	}
+	return true;
+}
+
+void UDualShockLibrary::ProcessInputReport(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
+	const FPlatformUserId UserId, const FInputDeviceId InputDeviceId, const FSonyGamepadInputState& State)
+{
+	FSonyInputDecoder::DispatchEvents(InMessageHandler, UserId, InputDeviceId, HIDDeviceContexts.DeviceType, InputState, State, EnableTouch, EnableAccelerometerAndGyroscope);
+	InputState = State;
+	LevelBattery = State.Battery;
 }
 
 
 void UDualShockLibrary::SetVibration(const FForceFeedbackValues& Values)
 {
-	FOutputContext* HidOutput = &HIDDeviceContexts.Output;
 	const float LeftRumble = FMath::Max(Values.LeftLarge, Values.LeftSmall);
 	const float RightRumble = FMath::Max(Values.RightLarge, Values.RightSmall);
 
 	const unsigned char OutputLeft = static_cast<unsigned char>(UValidateHelpers::To255(LeftRumble));
 	const unsigned char OutputRight = static_cast<unsigned char>(UValidateHelpers::To255(RightRumble));
-	if (HidOutput->Rumbles.Left != OutputLeft || HidOutput->Rumbles.Right != OutputRight)
-	{
-		HidOutput->Rumbles = {OutputLeft, OutputRight};
-		SendOut();
-	}
+	FOutputCommand Command(EOutputCommand::Rumble);
+	Command.Rumbles = {OutputLeft, OutputRight};
+	SendCommand(Command);
 }
 
 void UDualShockLibrary::SetLightbar(FColor Color, float BrithnessTime, float ToggleTime)
 {
-	FOutputContext* HidOutput = &HIDDeviceContexts.Output;
-	HidOutput->Lightbar.R = Color.R;
-	HidOutput->Lightbar.G = Color.G;
-	HidOutput->Lightbar.B = Color.B;
+	FOutputCommand Command(EOutputCommand::Lightbar);
+	Command.Lightbar = {Color.R, Color.G, Color.B, 0};
 
-	HidOutput->FlashLigthbar.Bright_Time = static_cast<unsigned char>(UValidateHelpers::To255(BrithnessTime));
-	HidOutput->FlashLigthbar.Toggle_Time = static_cast<unsigned char>(UValidateHelpers::To255(ToggleTime));
-	SendOut();
+	Command.FlashLigthbar.Bright_Time = static_cast<unsigned char>(UValidateHelpers::To255(BrithnessTime));
+	Command.FlashLigthbar.Toggle_Time = static_cast<unsigned char>(UValidateHelpers::To255(ToggleTime));
+	SendCommand(Command);
 }
 
 void UDualShockLibrary::SetPlayerLed(ELedPlayerEnum Led, ELedBrightnessEnum Brightness)
@@ -239,6 +262,7 @@ void UDualShockLibrary::SetGyroscope(bool bIsGyroscope)
 
 void UDualShockLibrary::StopAll()
 {
+	FOutputScheduler::Get().StopRumble(ControllerID, 0);
 	SendOut();
 }
 
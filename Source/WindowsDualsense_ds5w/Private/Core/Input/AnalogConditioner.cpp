@@ -0,0 +1,141 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/AnalogConditioner.h"
+
+namespace
+{
+	/**
+	 * Squared stick distances covered by the radial table: a stick pushed into a corner reaches 2.
+	 */
+	constexpr float RadialTableRange = 2.0f;
+	constexpr float RadialTableScale = (ANALOG_CONDITIONER_TABLE_SIZE - 1) / RadialTableRange;
+
+	/**
+	 * Maps a deflection between 0 and 1 through a deadzone, an anti-deadzone and a response curve.
+	 *
+	 * @param bRescale True to rescale the deflection from the inner to the outer deadzone, false to only cut it below the inner one.
+	 */
+	float Shape(const float Deflection, const float Inner, const float Outer, const float AntiDeadzone, const float Exponent, const bool bRescale)
+	{
+		if (Deflection <= Inner || Deflection <= 0.0f)
+		{
+			return 0.0f;
+		}
+
+		const float Start = bRescale ? Inner : 0.0f;
+		const float Range = Outer - Start;
+		float Value = Range > UE_KINDA_SMALL_NUMBER ? FMath::Clamp((Deflection - Start) / Range, 0.0f, 1.0f) : 1.0f;
+		Value = FMath::Pow(Value, FMath::Max(Exponent, 0.1f));
+		return AntiDeadzone + (1.0f - AntiDeadzone) * Value;
+	}
+
+	/**
+	 * Index in the axial tables of a decoded stick axis. The decoders produce steps of 1/128, so the index is the raw value.
+	 */
+	int32 StickIndex(const double Value)
+	{
+		return FMath::Clamp(FMath::RoundToInt32(Value * 128.0) + 128, 0, ANALOG_CONDITIONER_TABLE_SIZE - 1);
+	}
+
+	/**
+	 * Index in the trigger table of a decoded trigger. The decoders produce steps of 1/256, so the index is the raw value.
+	 */
+	int32 TriggerIndex(const float Value)
+	{
+		return FMath::Clamp(FMath::RoundToInt32(Value * 256.0f), 0, ANALOG_CONDITIONER_TABLE_SIZE - 1);
+	}
+}
+
+FAnalogConditioner::FAnalogConditioner()
+{
+	Compile(FSonyGamepadAnalogSettings(), Tables);
+}
+
+void FAnalogConditioner::SetSettings(const FSonyGamepadAnalogSettings& InSettings)
+{
+	// Compiled on the calling thread, so the reader thread only copies the finished tables.
+	FTables Compiled;
+	Compile(InSettings, Compiled);
+
+	FScopeLock Lock(&SettingsLock);
+	PendingTables = Compiled;
+	bTablesDirty.store(true, std::memory_order_release);
+}
+
+void FAnalogConditioner::Compile(const FSonyGamepadAnalogSettings& InSettings, FTables& OutTables)
+{
+	const float StickOuter = FMath::Max(InSettings.StickOuterDeadzone, InSettings.StickInnerDeadzone);
+	const float TriggerOuter = FMath::Max(InSettings.TriggerOuterDeadzone, InSettings.TriggerInnerDeadzone);
+	const bool bAxialDeadzone = InSettings.StickDeadzoneType == ESonyGamepadDeadzone::Axial;
+	const bool bScaledRadial = InSettings.StickDeadzoneType == ESonyGamepadDeadzone::ScaledRadial;
+
+	for (int32 Index = 0; Index < ANALOG_CONDITIONER_TABLE_SIZE; ++Index)
+	{
+		const float Axis = (Index - 128) / 128.0f;
+		const float AxialInner = bAxialDeadzone ? InSettings.StickInnerDeadzone : 0.0f;
+		OutTables.StickAxial[Index] = FMath::Sign(Axis) * Shape(FMath::Abs(Axis), AxialInner, StickOuter,
+		                                                        InSettings.StickAntiDeadzone, InSettings.StickCurveExponent, true);
+
+		const float Distance = FMath::Sqrt(Index / RadialTableScale);
+		OutTables.StickRadial[Index] = Distance > 0.0f
+			                               ? Shape(Distance, InSettings.StickInnerDeadzone, StickOuter, InSettings.StickAntiDeadzone,
+			                                       InSettings.StickCurveExponent, bScaledRadial) / Distance
+			                               : 0.0f;
+
+		OutTables.Trigger[Index] = Shape(Index / 256.0f, InSettings.TriggerInnerDeadzone, TriggerOuter,
+		                                 InSettings.TriggerAntiDeadzone, InSettings.TriggerCurveExponent, true);
+	}
+
+	OutTables.StickDeadzoneType = InSettings.StickDeadzoneType;
+	OutTables.ChangeEpsilon = FMath::Max(InSettings.ChangeEpsilon, 0.0f);
+}
+
+void FAnalogConditioner::Apply(FSonyGamepadInputState& State)
+{
+	if (bTablesDirty.load(std::memory_order_acquire))
+	{
+		// SetSettings already compiled the curves, so picking them up is a plain copy of the tables.
+		// Only the report after a change pays for it.
+		FScopeLock Lock(&SettingsLock);
+		Tables = PendingTables;
+		bTablesDirty.store(false, std::memory_order_relaxed);
+	}
+
+	const FVector2D LeftStick = ConditionStick(FVector2D(State.LeftStick));
+	const FVector2D RightStick = ConditionStick(FVector2D(State.RightStick));
+	State.LeftStick = FVector2f(Hold(0, LeftStick.X), Hold(1, LeftStick.Y));
+	State.RightStick = FVector2f(Hold(2, RightStick.X), Hold(3, RightStick.Y));
+	State.LeftTrigger = Hold(4, Tables.Trigger[TriggerIndex(State.LeftTrigger)]);
+	State.RightTrigger = Hold(5, Tables.Trigger[TriggerIndex(State.RightTrigger)]);
+}
+
+FVector2D FAnalogConditioner::ConditionStick(const FVector2D& Stick) const
+{
+	if (Tables.StickDeadzoneType == ESonyGamepadDeadzone::None || Tables.StickDeadzoneType == ESonyGamepadDeadzone::Axial)
+	{
+		return FVector2D(Tables.StickAxial[StickIndex(Stick.X)], Tables.StickAxial[StickIndex(Stick.Y)]);
+	}
+
+	// Interpolated between the two nearest entries, the squared distance is too coarse near the center otherwise.
+	const float Position = FMath::Min(static_cast<float>(Stick.SizeSquared()) * RadialTableScale, ANALOG_CONDITIONER_TABLE_SIZE - 1.0f);
+	const int32 Index = FMath::Min(static_cast<int32>(Position), ANALOG_CONDITIONER_TABLE_SIZE - 2);
+	const float Factor = FMath::Lerp(Tables.StickRadial[Index], Tables.StickRadial[Index + 1], Position - Index);
+	return FVector2D(FMath::Clamp(Stick.X * Factor, -1.0, 1.0), FMath::Clamp(Stick.Y * Factor, -1.0, 1.0));
+}
+
+float FAnalogConditioner::Hold(const int32 Axis, const float Value)
+{
+	// Rest and full deflection always go through, so a released stick never stays slightly off center.
+	if (FMath::Abs(Value - Held[Axis]) > Tables.ChangeEpsilon || Value == 0.0f || FMath::Abs(Value) >= 1.0f)
+	{
+		Held[Axis] = Value;
+	}
+	return Held[Axis];
+}
+
+void FAnalogConditioner::Reset()
+{
+	FMemory::Memzero(Held, sizeof(Held));
+}
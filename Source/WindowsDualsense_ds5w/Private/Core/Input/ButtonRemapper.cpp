@@ -0,0 +1,78 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/ButtonRemapper.h"
+
+void FButtonRemapper::SetProfile(const FSonyGamepadButtonRemap& Profile)
+{
+	// The bits each physical button sets once remapped.
+	uint32 Targets[32];
+	for (int32 Bit = 0; Bit < 32; ++Bit)
+	{
+		Targets[Bit] = 1u << Bit;
+	}
+	for (const TPair<ESonyGamepadButton, ESonyGamepadButton>& Pair : Profile.Remap)
+	{
+		if (Pair.Key < ESonyGamepadButton::Count && Pair.Value < ESonyGamepadButton::Count)
+		{
+			Targets[static_cast<uint8>(Pair.Key)] = 1u << static_cast<uint8>(Pair.Value);
+		}
+	}
+	for (const ESonyGamepadButton Button : Profile.Disabled)
+	{
+		if (Button < ESonyGamepadButton::Count)
+		{
+			Targets[static_cast<uint8>(Button)] = 0;
+		}
+	}
+
+	TUniquePtr<FTable> Table = MakeUnique<FTable>();
+	for (int32 Byte = 0; Byte < 4; ++Byte)
+	{
+		for (uint32 Value = 0; Value < 256; ++Value)
+		{
+			uint32 Remapped = 0;
+			for (uint32 Bits = Value; Bits; Bits &= Bits - 1)
+			{
+				Remapped |= Targets[Byte * 8 + FMath::CountTrailingZeros(Bits)];
+			}
+			Table->Bytes[Byte][Value] = Remapped;
+		}
+	}
+
+	Publish(MoveTemp(Table));
+}
+
+void FButtonRemapper::ClearProfile()
+{
+	Publish(nullptr);
+}
+
+void FButtonRemapper::Publish(TUniquePtr<FTable> Table)
+{
+	FScopeLock Lock(&TablesLock);
+	Active.store(Table.Get(), std::memory_order_seq_cst);
+	if (Current.IsValid())
+	{
+		Retired.Add(MoveTemp(Current));
+	}
+	Current = MoveTemp(Table);
+	ReclaimRetired();
+}
+
+void FButtonRemapper::ReleaseRetired()
+{
+	FScopeLock Lock(&TablesLock);
+	ReclaimRetired();
+}
+
+void FButtonRemapper::ReclaimRetired()
+{
+	// Active no longer points to a retired table, so Apply can only still read the one it announced.
+	const FTable* Announced = InUse.load(std::memory_order_seq_cst);
+	Retired.RemoveAll([Announced](const TUniquePtr<FTable>& Table)
+	{
+		return Table.Get() != Announced;
+	});
+}
@@ -0,0 +1,279 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/DeviceInputReader.h"
+
+#include "HAL/RunnableThread.h"
+#include "CoreGlobals.h"
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <windows.h>
+#include <hidsdi.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+
+FDeviceInputReader::FDeviceInputReader(const wchar_t* DevicePath, const uint32 InReportLength, const float NominalReportRate)
+	: Handle(INVALID_HANDLE_VALUE)
+	, ReportLength(FMath::Min<uint32>(InReportLength, SONY_GAMEPAD_MAX_REPORT_SIZE))
+	, ReportInterval(NominalReportRate > 0.0f ? 1.0f / NominalReportRate : 0.0f)
+	, Thread(nullptr)
+{
+	memcpy_s(Path, sizeof(Path), DevicePath, sizeof(Path));
+}
+
+FDeviceInputReader::~FDeviceInputReader()
+{
+	if (Thread)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (Handle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(Handle);
+		Handle = INVALID_HANDLE_VALUE;
+	}
+}
+
+bool FDeviceInputReader::Start()
+{
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		return false;
+	}
+
+	Handle = CreateFileW(
+		Path,
+		GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, NULL, nullptr
+	);
+
+	if (Handle == INVALID_HANDLE_VALUE)
+	{
+		UE_LOG(LogTemp, Error, TEXT("InputReader: Failed to open device handle for %s"), Path);
+		return false;
+	}
+
+	HidD_FlushQueue(Handle);
+	Thread = FRunnableThread::Create(this, TEXT("SonyGamepadInputReader"), 0, TPri_AboveNormal);
+	return Thread != nullptr;
+}
+
+uint32 FDeviceInputReader::Run()
+{
+	unsigned char Scratch[SONY_GAMEPAD_MAX_REPORT_SIZE];
+	double LastArrival = 0.0;
+	FSonyGamepadInputState State;
+	FMotionFusion Fusion;
+
+	while (!bStopping.load(std::memory_order_relaxed))
+	{
+		DWORD BytesRead = 0;
+		if (!ReadFile(Handle, Scratch, ReportLength, &BytesRead, nullptr))
+		{
+			if (!bStopping.load(std::memory_order_relaxed))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("InputReader: read failed, Error: %d"), GetLastError());
+				bDeviceLost.store(true, std::memory_order_release);
+			}
+			break;
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		if (LastArrival > 0.0)
+		{
+			// Exponential moving average, so jitter on Bluetooth does not make the rate flicker.
+			const float Interval = ReportInterval.load(std::memory_order_relaxed);
+			const float Measured = static_cast<float>(Now - LastArrival);
+			ReportInterval.store(Interval > 0.0f ? Interval + (Measured - Interval) * 0.05f : Measured, std::memory_order_relaxed);
+		}
+		LastArrival = Now;
+
+		if (Decoder)
+		{
+			const double PreviousTimestamp = State.Timestamp;
+			Decoder(Scratch, Connection, Calibration, State);
+			State.Timestamp = Now;
+			State.Sequence = static_cast<uint32>(WriteIndex.load(std::memory_order_relaxed));
+			if (ButtonRemapper)
+			{
+				State.Buttons = ButtonRemapper->Apply(State.Buttons);
+			}
+			if (AnalogConditioner)
+			{
+				AnalogConditioner->Apply(State);
+			}
+			FSonyInputDecoder::UpdateMotion(State, PreviousTimestamp, Fusion);
+			if (TouchTracker)
+			{
+				TouchTracker->Process(State);
+			}
+		}
+
+		Push(Scratch, BytesRead, Now, State);
+
+		if (Decoder && StateBuffer)
+		{
+			StateBuffer->Publish(State);
+		}
+		if (Decoder && History)
+		{
+			History->Push(State);
+		}
+		if (Decoder && LookProcessor)
+		{
+			LookProcessor->Process(State);
+		}
+	}
+
+	return 0;
+}
+
+void FDeviceInputReader::Stop()
+{
+	bStopping.store(true, std::memory_order_relaxed);
+	if (Handle != INVALID_HANDLE_VALUE)
+	{
+		// Unblocks the pending ReadFile so the thread can exit.
+		CancelIoEx(Handle, nullptr);
+	}
+}
+
+void FDeviceInputReader::Push(const unsigned char* Data, const uint32 Length, const double Timestamp, const FSonyGamepadInputState& State)
+{
+	const uint64 Index = WriteIndex.load(std::memory_order_relaxed);
+	FSlot& Slot = Slots[Index & (SONY_GAMEPAD_REPORT_RING_SIZE - 1)];
+
+	Slot.Version.fetch_add(1, std::memory_order_acq_rel);
+	memcpy(Slot.Report.Data, Data, Length);
+	Slot.Report.Length = Length;
+	Slot.Report.Timestamp = Timestamp;
+	Slot.Report.FrameNumber = GFrameCounter;
+	Slot.Report.Sequence = Index;
+	Slot.Report.State = State;
+	Slot.Version.fetch_add(1, std::memory_order_release);
+
+	WriteIndex.store(Index + 1, std::memory_order_release);
+}
+
+bool FDeviceInputReader::PopNext(unsigned char* OutBuffer, const uint32 BufferSize, double* OutTimestamp, FSonyGamepadInputState* OutState)
+{
+	const uint64 Write = WriteIndex.load(std::memory_order_acquire);
+	if (Write - ReadIndex > SONY_GAMEPAD_REPORT_RING_SIZE)
+	{
+		Overruns += Write - ReadIndex - SONY_GAMEPAD_REPORT_RING_SIZE;
+		ReadIndex = Write - SONY_GAMEPAD_REPORT_RING_SIZE;
+	}
+
+	while (ReadIndex < Write)
+	{
+		const uint64 Index = ReadIndex++;
+		const FSlot& Slot = Slots[Index & (SONY_GAMEPAD_REPORT_RING_SIZE - 1)];
+
+		const uint32 VersionBefore = Slot.Version.load(std::memory_order_acquire);
+		if (VersionBefore & 1)
+		{
+			continue;
+		}
+
+		const uint32 Length = FMath::Min(Slot.Report.Length, BufferSize);
+		memcpy(OutBuffer, Slot.Report.Data, Length);
+		const double Timestamp = Slot.Report.Timestamp;
+		const uint64 FrameNumber = Slot.Report.FrameNumber;
+		const uint64 Sequence = Slot.Report.Sequence;
+		if (OutState)
+		{
+			*OutState = Slot.Report.State;
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Slot.Version.load(std::memory_order_relaxed) != VersionBefore || Sequence != Index)
+		{
+			// The reader thread lapped the ring while the slot was copied.
+			++Overruns;
+			continue;
+		}
+
+		RecordLatency(Timestamp, FrameNumber);
+		if (OutTimestamp)
+		{
+			*OutTimestamp = Timestamp;
+		}
+		return true;
+	}
+
+	return false;
+}
+
+bool FDeviceInputReader::PopLatest(unsigned char* OutBuffer, const uint32 BufferSize, double* OutTimestamp, FSonyGamepadInputState* OutState)
+{
+	const uint64 Write = WriteIndex.load(std::memory_order_acquire);
+	if (Write > 0 && Write - 1 > ReadIndex)
+	{
+		ReadIndex = Write - 1;
+	}
+
+	return PopNext(OutBuffer, BufferSize, OutTimestamp, OutState);
+}
+
+bool FDeviceInputReader::PopAtRate(const double Interval, unsigned char* OutBuffer, const uint32 BufferSize, double* OutTimestamp, FSonyGamepadInputState* OutState)
+{
+	const uint64 Write = WriteIndex.load(std::memory_order_acquire);
+	if (Write - ReadIndex > SONY_GAMEPAD_REPORT_RING_SIZE)
+	{
+		Overruns += Write - ReadIndex - SONY_GAMEPAD_REPORT_RING_SIZE;
+		ReadIndex = Write - SONY_GAMEPAD_REPORT_RING_SIZE;
+	}
+
+	// Half a report interval of slack, so the jitter of the arrival times does not skip the report due at the sampling time.
+	const double Tolerance = 0.5 * ReportInterval.load(std::memory_order_relaxed);
+	while (ReadIndex < Write)
+	{
+		const FSlot& Slot = Slots[ReadIndex & (SONY_GAMEPAD_REPORT_RING_SIZE - 1)];
+		const uint32 Version = Slot.Version.load(std::memory_order_acquire);
+		if (!(Version & 1) && Slot.Report.Timestamp + Tolerance >= NextSampleTime)
+		{
+			break;
+		}
+		++ReadIndex;
+	}
+
+	double Timestamp = 0.0;
+	if (!PopNext(OutBuffer, BufferSize, &Timestamp, OutState))
+	{
+		return false;
+	}
+
+	NextSampleTime += Interval;
+	if (NextSampleTime <= Timestamp)
+	{
+		// After a gap in the reports, or on the first sample, the grid restarts from this report.
+		NextSampleTime = Timestamp + Interval;
+	}
+
+	if (OutTimestamp)
+	{
+		*OutTimestamp = Timestamp;
+	}
+	return true;
+}
+
+void FDeviceInputReader::RecordLatency(const double Timestamp, const uint64 FrameNumber)
+{
+	const float Ms = static_cast<float>((FPlatformTime::Seconds() - Timestamp) * 1000.0);
+	const uint64 Frames = GFrameCounter > FrameNumber ? GFrameCounter - FrameNumber : 0;
+
+	LatencySumMs += Ms;
+	LatencySumFrames += static_cast<double>(Frames);
+	Latency.Samples++;
+	Latency.LastMs = Ms;
+	Latency.MaxMs = FMath::Max(Latency.MaxMs, Ms);
+	Latency.AverageMs = static_cast<float>(LatencySumMs / Latency.Samples);
+	Latency.AverageFrames = static_cast<float>(LatencySumFrames / Latency.Samples);
+
+	if (Latency.Samples == MAX_int32)
+	{
+		// Restart the averages long before the sums lose precision.
+		ResetLatencyStats();
+	}
+}
@@ -0,0 +1,175 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/GyroLookProcessor.h"
+
+namespace
+{
+	uint64 PackDelta(const float Yaw, const float Pitch)
+	{
+		uint32 YawBits;
+		uint32 PitchBits;
+		FMemory::Memcpy(&YawBits, &Yaw, sizeof(float));
+		FMemory::Memcpy(&PitchBits, &Pitch, sizeof(float));
+		return static_cast<uint64>(YawBits) | (static_cast<uint64>(PitchBits) << 32);
+	}
+
+	FVector2f UnpackDelta(const uint64 Packed)
+	{
+		const uint32 YawBits = static_cast<uint32>(Packed);
+		const uint32 PitchBits = static_cast<uint32>(Packed >> 32);
+		FVector2f Delta;
+		FMemory::Memcpy(&Delta.X, &YawBits, sizeof(float));
+		FMemory::Memcpy(&Delta.Y, &PitchBits, sizeof(float));
+		return Delta;
+	}
+
+	/**
+	 * Eases the flick in and out, so the turn is fast but does not look like a cut.
+	 */
+	float EaseFlick(const float Progress)
+	{
+		return 1.0f - FMath::Square(1.0f - Progress);
+	}
+}
+
+void FGyroLookProcessor::SetSettings(const FSonyGamepadGyroLookSettings& InSettings)
+{
+	FScopeLock Lock(&SettingsLock);
+	PendingSettings = InSettings;
+	bSettingsDirty.store(true, std::memory_order_release);
+}
+
+void FGyroLookProcessor::Process(const FSonyGamepadInputState& State)
+{
+	if (bSettingsDirty.load(std::memory_order_acquire))
+	{
+		// SetSettings may run on the game thread while this report is processed. The copy taken here
+		// keeps the sensitivity and flick stick settings consistent for the whole report.
+		FScopeLock Lock(&SettingsLock);
+		Settings = PendingSettings;
+		bSettingsDirty.store(false, std::memory_order_relaxed);
+	}
+
+	const float DeltaTime = LastTimestamp > 0.0 ? static_cast<float>(FMath::Clamp(State.Timestamp - LastTimestamp, 0.0, 0.05)) : 0.0f;
+	LastTimestamp = State.Timestamp;
+	if (!Settings.bEnabled || DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	const FVector3f Rate = State.AngularVelocity * (180.0f / UE_PI);
+
+	// Positive yaw turns right, which is a negative rotation around the vertical axis.
+	float YawRate = -Rate.Y;
+	const float PitchRate = Rate.X;
+	if (Settings.Space != ESonyGamepadGyroSpace::Local)
+	{
+		const FVector3f Up = -State.GetGravity().GetUnsafeNormal();
+		const float WorldYaw = FVector3f::DotProduct(Rate, Up);
+		if (Settings.Space == ESonyGamepadGyroSpace::World)
+		{
+			YawRate = -WorldYaw;
+		}
+		else
+		{
+			// Mostly around gravity, but never faster than the local yaw and roll combined, so a
+			// controller held upright still turns the camera by rolling it.
+			constexpr float YawRelaxFactor = 1.41f;
+			const float LocalYawRoll = FMath::Sqrt(Rate.Y * Rate.Y + Rate.Z * Rate.Z);
+			YawRate = -FMath::Sign(WorldYaw) * FMath::Min(FMath::Abs(WorldYaw) * YawRelaxFactor, LocalYawRoll);
+		}
+	}
+
+	const float Speed = FMath::Sqrt(YawRate * YawRate + PitchRate * PitchRate);
+	const float Acceleration = Settings.FastSpeed > Settings.SlowSpeed
+		                           ? FMath::Clamp((Speed - Settings.SlowSpeed) / (Settings.FastSpeed - Settings.SlowSpeed), 0.0f, 1.0f)
+		                           : (Speed >= Settings.FastSpeed ? 1.0f : 0.0f);
+	const float Sensitivity = Settings.Sensitivity * FMath::Lerp(1.0f, Settings.AccelerationMultiplier, Acceleration);
+
+	float Yaw = YawRate * Sensitivity * DeltaTime;
+	const float Pitch = PitchRate * Sensitivity * Settings.PitchScale * DeltaTime * (Settings.bInvertPitch ? -1.0f : 1.0f);
+	if (Settings.bFlickStick)
+	{
+		Yaw += ProcessFlickStick(FVector2D(State.RightStick), DeltaTime);
+	}
+
+	Accumulate(Yaw, Pitch);
+}
+
+float FGyroLookProcessor::ProcessFlickStick(const FVector2D& Stick, const float DeltaTime)
+{
+	float Yaw = 0.0f;
+	const float Magnitude = Stick.Size();
+	const float StickAngle = FMath::RadiansToDegrees(FMath::Atan2(Stick.X, Stick.Y));
+
+	if (Magnitude >= Settings.FlickThreshold)
+	{
+		if (!bFlickActive)
+		{
+			// Pushing the stick starts a turn towards its direction, relative to where the camera faces.
+			bFlickActive = true;
+			FlickTarget = StickAngle;
+			FlickElapsed = 0.0f;
+		}
+		else
+		{
+			// Rotating the held stick turns the camera by the same angle.
+			Yaw += FMath::FindDeltaAngleDegrees(FlickStickAngle, StickAngle);
+		}
+		FlickStickAngle = StickAngle;
+	}
+	else if (Magnitude < Settings.FlickThreshold - 0.1f)
+	{
+		// Released with some hysteresis, so a stick resting on the threshold does not flick repeatedly.
+		bFlickActive = false;
+	}
+
+	if (FlickTarget != 0.0f)
+	{
+		const float Previous = Settings.FlickTime > 0.0f ? EaseFlick(FMath::Min(FlickElapsed / Settings.FlickTime, 1.0f)) : 0.0f;
+		FlickElapsed += DeltaTime;
+		const float Progress = Settings.FlickTime > 0.0f ? FMath::Min(FlickElapsed / Settings.FlickTime, 1.0f) : 1.0f;
+		Yaw += FlickTarget * (EaseFlick(Progress) - Previous);
+		if (Progress >= 1.0f)
+		{
+			FlickTarget = 0.0f;
+		}
+	}
+
+	return Yaw;
+}
+
+FVector2D FGyroLookProcessor::ConsumeDelta()
+{
+	const FVector2f Delta = UnpackDelta(PackedDelta.exchange(0, std::memory_order_acq_rel));
+	return FVector2D(Delta);
+}
+
+void FGyroLookProcessor::Reset()
+{
+	PackedDelta.store(0, std::memory_order_relaxed);
+	LastTimestamp = 0.0;
+	bFlickActive = false;
+	FlickTarget = 0.0f;
+	FlickElapsed = 0.0f;
+}
+
+void FGyroLookProcessor::Accumulate(const float Yaw, const float Pitch)
+{
+	if (Yaw == 0.0f && Pitch == 0.0f)
+	{
+		return;
+	}
+
+	uint64 Expected = PackedDelta.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		const FVector2f Current = UnpackDelta(Expected);
+		if (PackedDelta.compare_exchange_weak(Expected, PackDelta(Current.X + Yaw, Current.Y + Pitch), std::memory_order_release, std::memory_order_relaxed))
+		{
+			return;
+		}
+	}
+}
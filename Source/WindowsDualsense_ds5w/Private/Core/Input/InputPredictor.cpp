@@ -0,0 +1,254 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/InputPredictor.h"
+
+#include "Core/Enums/EDeviceCommons.h"
+
+namespace
+{
+	constexpr ESonyGamepadChannel PredictedChannels[] = {
+		ESonyGamepadChannel::LeftStickX, ESonyGamepadChannel::LeftStickY,
+		ESonyGamepadChannel::RightStickX, ESonyGamepadChannel::RightStickY,
+		ESonyGamepadChannel::GyroscopeX, ESonyGamepadChannel::GyroscopeY, ESonyGamepadChannel::GyroscopeZ
+	};
+
+	/**
+	 * First channel of each group of the statistics: left stick, right stick and gyroscope.
+	 */
+	constexpr int32 GroupFirst[] = {0, 2, 4};
+	constexpr int32 GroupSize[] = {2, 2, 3};
+
+	bool IsGyroscope(const int32 Channel)
+	{
+		return Channel >= 4;
+	}
+
+	/**
+	 * Length of the difference of a group of channels, converted to the unit of the statistics.
+	 */
+	float GroupDistance(const int32 Group, const float* A, const float* B)
+	{
+		float SquaredSum = 0.0f;
+		for (int32 Channel = GroupFirst[Group]; Channel < GroupFirst[Group] + GroupSize[Group]; ++Channel)
+		{
+			SquaredSum += FMath::Square(A[Channel] - B[Channel]);
+		}
+		const float Distance = FMath::Sqrt(SquaredSum);
+		return Group == 2 ? Distance / GYRO_RAW_PER_DEGREE_S : Distance;
+	}
+}
+
+void FInputPredictor::SetSettings(const FSonyGamepadPredictionSettings& InSettings)
+{
+	FScopeLock ScopeLock(&Lock);
+	Settings = InSettings;
+	Settings.FitSamples = FMath::Clamp(Settings.FitSamples, 2, WindowSize);
+}
+
+bool FInputPredictor::Predict(const FInputSampleHistory& History, const FSonyGamepadInputState& Latest, const double TargetTime,
+                              FSonyGamepadInputState& OutState)
+{
+	FScopeLock ScopeLock(&Lock);
+	OutState = Latest;
+
+	// Samples are consumed even while disabled, so the statistics only ever see fresh input.
+	Ingest(History);
+	if (!Settings.bEnabled || WindowCount < 2)
+	{
+		return false;
+	}
+
+	const int32 Newest = WindowCount - 1;
+	const double NewestTime = WindowTimes[Newest];
+	const int32 NumSamples = FMath::Min(Settings.FitSamples, WindowCount);
+
+	float Predicted[NumChannels];
+	float Baseline[NumChannels];
+	for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+	{
+		const FSonyGamepadChannelPrediction& ChannelSettings = GetChannelSettings(Channel);
+		const float Lead = static_cast<float>(FMath::Clamp(TargetTime - NewestTime, 0.0, static_cast<double>(ChannelSettings.Horizon)));
+		const float MaxCorrection = IsGyroscope(Channel) ? ChannelSettings.MaxCorrection * GYRO_RAW_PER_DEGREE_S : ChannelSettings.MaxCorrection;
+		const float Correction = FMath::Clamp(FitSlope(Channel, NumSamples) * Lead, -MaxCorrection, MaxCorrection);
+
+		Baseline[Channel] = WindowValues[Channel][Newest];
+		Predicted[Channel] = Baseline[Channel] + Correction;
+		if (!IsGyroscope(Channel))
+		{
+			Predicted[Channel] = FMath::Clamp(Predicted[Channel], -1.0f, 1.0f);
+		}
+	}
+
+	OutState.LeftStick = FVector2f(Predicted[0], Predicted[1]);
+	OutState.RightStick = FVector2f(Predicted[2], Predicted[3]);
+	// Applied as a delta, so the bias the sensor fusion removed from the angular velocity stays removed.
+	const FVector3f GyroscopeDelta(Predicted[4] - Baseline[4], Predicted[5] - Baseline[5], Predicted[6] - Baseline[6]);
+	OutState.AngularVelocity += GyroscopeDelta * (UE_PI / 180.0f / GYRO_RAW_PER_DEGREE_S);
+
+	if (!Pending.bValid && TargetTime > NewestTime)
+	{
+		Pending.TargetTime = TargetTime;
+		FMemory::Memcpy(Pending.Predicted, Predicted, sizeof(Predicted));
+		FMemory::Memcpy(Pending.Baseline, Baseline, sizeof(Baseline));
+		Pending.bValid = true;
+	}
+	return true;
+}
+
+void FInputPredictor::Ingest(const FInputSampleHistory& History)
+{
+	const FInputSampleSpan Span = History.ReadSince(Cursor);
+	for (int32 Segment = 0; Segment < Span.NumSegments(); ++Segment)
+	{
+		const TArrayView<const double> Timestamps = Span.GetTimestamps(Segment);
+		TArrayView<const float> Channels[NumChannels];
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Channels[Channel] = Span.GetChannel(PredictedChannels[Channel], Segment);
+		}
+
+		// Every sample goes through the window, the one right after the target time of the pending prediction evaluates it.
+		for (int32 Index = 0; Index < Timestamps.Num(); ++Index)
+		{
+			float Values[NumChannels];
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Values[Channel] = Channels[Channel][Index];
+			}
+			AddSample(Timestamps[Index], Values);
+		}
+	}
+
+	if (Span.Num > 0 && !Span.IsValid())
+	{
+		// The writer lapped the samples while they were copied, start over from the next ones.
+		WindowCount = 0;
+		Pending.bValid = false;
+	}
+}
+
+void FInputPredictor::AddSample(const double Timestamp, const float (&Values)[NumChannels])
+{
+	if (WindowCount == WindowSize)
+	{
+		FMemory::Memmove(&WindowTimes[0], &WindowTimes[1], sizeof(double) * (WindowSize - 1));
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			FMemory::Memmove(&WindowValues[Channel][0], &WindowValues[Channel][1], sizeof(float) * (WindowSize - 1));
+		}
+		--WindowCount;
+	}
+
+	WindowTimes[WindowCount] = Timestamp;
+	for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+	{
+		WindowValues[Channel][WindowCount] = Values[Channel];
+	}
+	++WindowCount;
+
+	Evaluate();
+}
+
+void FInputPredictor::Evaluate()
+{
+	const int32 Newest = WindowCount - 1;
+	if (!Pending.bValid || WindowTimes[Newest] < Pending.TargetTime)
+	{
+		return;
+	}
+
+	// The reported value at the target time, interpolated between the samples around it.
+	float Actual[NumChannels];
+	const double Span = Newest > 0 ? WindowTimes[Newest] - WindowTimes[Newest - 1] : 0.0;
+	const float Alpha = Span > 0.0 ? static_cast<float>(FMath::Clamp((Pending.TargetTime - WindowTimes[Newest - 1]) / Span, 0.0, 1.0)) : 1.0f;
+	for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+	{
+		Actual[Channel] = Newest > 0 ? FMath::Lerp(WindowValues[Channel][Newest - 1], WindowValues[Channel][Newest], Alpha) : WindowValues[Channel][Newest];
+	}
+
+	for (int32 Group = 0; Group < UE_ARRAY_COUNT(Errors); ++Group)
+	{
+		Errors[Group].Add(GroupDistance(Group, Pending.Predicted, Actual), GroupDistance(Group, Pending.Baseline, Actual));
+	}
+	Pending.bValid = false;
+}
+
+float FInputPredictor::FitSlope(const int32 Channel, const int32 NumSamples) const
+{
+	// Least squares on times relative to the newest sample, which keeps the sums well conditioned.
+	const int32 First = WindowCount - NumSamples;
+	const double Origin = WindowTimes[WindowCount - 1];
+	double SumT = 0.0;
+	double SumV = 0.0;
+	double SumTT = 0.0;
+	double SumTV = 0.0;
+	for (int32 Index = First; Index < WindowCount; ++Index)
+	{
+		const double T = WindowTimes[Index] - Origin;
+		const double V = WindowValues[Channel][Index];
+		SumT += T;
+		SumV += V;
+		SumTT += T * T;
+		SumTV += T * V;
+	}
+
+	const double Denominator = NumSamples * SumTT - SumT * SumT;
+	return Denominator > UE_DOUBLE_SMALL_NUMBER ? static_cast<float>((NumSamples * SumTV - SumT * SumV) / Denominator) : 0.0f;
+}
+
+const FSonyGamepadChannelPrediction& FInputPredictor::GetChannelSettings(const int32 Channel) const
+{
+	return Channel < 2 ? Settings.LeftStick : (Channel < 4 ? Settings.RightStick : Settings.Gyroscope);
+}
+
+FSonyGamepadPredictionStats FInputPredictor::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	FSonyGamepadPredictionStats Stats;
+	Stats.LeftStick = Errors[0].ToError();
+	Stats.RightStick = Errors[1].ToError();
+	Stats.Gyroscope = Errors[2].ToError();
+	return Stats;
+}
+
+void FInputPredictor::ResetStats()
+{
+	FScopeLock ScopeLock(&Lock);
+	for (FErrorAccumulator& Accumulator : Errors)
+	{
+		Accumulator = FErrorAccumulator();
+	}
+	Pending.bValid = false;
+}
+
+void FInputPredictor::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	WindowCount = 0;
+	Pending.bValid = false;
+}
+
+void FInputPredictor::FErrorAccumulator::Add(const float Error, const float BaselineError)
+{
+	++Samples;
+	SumAbsolute += Error;
+	SumSquares += static_cast<double>(Error) * Error;
+	SumBaseline += BaselineError;
+	Max = FMath::Max(Max, Error);
+}
+
+FSonyGamepadPredictionError FInputPredictor::FErrorAccumulator::ToError() const
+{
+	FSonyGamepadPredictionError Error;
+	Error.Samples = Samples;
+	Error.Max = Max;
+	if (Samples > 0)
+	{
+		Error.MeanAbsolute = static_cast<float>(SumAbsolute / Samples);
+		Error.RootMeanSquare = static_cast<float>(FMath::Sqrt(SumSquares / Samples));
+		Error.BaselineMeanAbsolute = static_cast<float>(SumBaseline / Samples);
+	}
+	return Error;
+}
@@ -0,0 +1,143 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/InputSampleHistory.h"
+
+namespace
+{
+	constexpr int32 NumChannels = static_cast<uint8>(ESonyGamepadChannel::Count);
+	constexpr uint64 HistoryMask = SONY_GAMEPAD_HISTORY_SIZE - 1;
+}
+
+int32 FInputSampleSpan::NumSegments() const
+{
+	if (Num == 0)
+	{
+		return 0;
+	}
+
+	return GetSegmentLength(0) < Num ? 2 : 1;
+}
+
+TArrayView<const float> FInputSampleSpan::GetChannel(const ESonyGamepadChannel Channel, const int32 Segment) const
+{
+	check(Segment < NumSegments());
+	return TArrayView<const float>(&History->Channels[static_cast<uint8>(Channel)][GetSegmentOffset(Segment)], GetSegmentLength(Segment));
+}
+
+TArrayView<const double> FInputSampleSpan::GetTimestamps(const int32 Segment) const
+{
+	check(Segment < NumSegments());
+	return TArrayView<const double>(&History->Timestamps[GetSegmentOffset(Segment)], GetSegmentLength(Segment));
+}
+
+bool FInputSampleSpan::IsValid() const
+{
+	// The writer is at most writing the slot of index WriteIndex, which holds sample WriteIndex - SIZE.
+	return History && History->GetWriteIndex() - First < SONY_GAMEPAD_HISTORY_SIZE;
+}
+
+int32 FInputSampleSpan::GetSegmentOffset(const int32 Segment) const
+{
+	return Segment == 0 ? static_cast<int32>(First & HistoryMask) : 0;
+}
+
+int32 FInputSampleSpan::GetSegmentLength(const int32 Segment) const
+{
+	const int32 FirstLength = FMath::Min(Num, SONY_GAMEPAD_HISTORY_SIZE - static_cast<int32>(First & HistoryMask));
+	return Segment == 0 ? FirstLength : Num - FirstLength;
+}
+
+void FInputSampleHistory::Push(const FSonyGamepadInputState& State)
+{
+	const uint64 Index = WriteIndex.load(std::memory_order_relaxed);
+	const uint64 Slot = Index & HistoryMask;
+
+	Timestamps[Slot] = State.Timestamp;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::LeftStickX)][Slot] = State.LeftStick.X;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::LeftStickY)][Slot] = State.LeftStick.Y;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::RightStickX)][Slot] = State.RightStick.X;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::RightStickY)][Slot] = State.RightStick.Y;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::LeftTrigger)][Slot] = State.LeftTrigger;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::RightTrigger)][Slot] = State.RightTrigger;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::GyroscopeX)][Slot] = State.Gyroscope.X;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::GyroscopeY)][Slot] = State.Gyroscope.Y;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::GyroscopeZ)][Slot] = State.Gyroscope.Z;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::AccelerometerX)][Slot] = State.Accelerometer.X;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::AccelerometerY)][Slot] = State.Accelerometer.Y;
+	Channels[static_cast<uint8>(ESonyGamepadChannel::AccelerometerZ)][Slot] = State.Accelerometer.Z;
+
+	WriteIndex.store(Index + 1, std::memory_order_release);
+}
+
+FInputSampleSpan FInputSampleHistory::ReadSince(uint64& Cursor) const
+{
+	const uint64 Write = GetWriteIndex();
+	// One slot stays out of reach, it is the one the writer fills next.
+	const uint64 Oldest = Write > SONY_GAMEPAD_HISTORY_SIZE - 1 ? Write - (SONY_GAMEPAD_HISTORY_SIZE - 1) : 0;
+
+	FInputSampleSpan Span;
+	Span.History = this;
+	Span.First = FMath::Clamp(Cursor, Oldest, Write);
+	Span.Num = static_cast<int32>(Write - Span.First);
+	Cursor = Write;
+	return Span;
+}
+
+int32 FInputSampleResampler::Resample(const FInputSampleHistory& History, const float RateHz)
+{
+	Timestamps.Reset();
+	for (TArray<float>& Channel : Channels)
+	{
+		Channel.Reset();
+	}
+
+	const FInputSampleSpan Span = History.ReadSince(Cursor);
+	if (RateHz <= 0.0f)
+	{
+		return 0;
+	}
+
+	const double Step = 1.0 / RateHz;
+	for (int32 Segment = 0; Segment < Span.NumSegments(); ++Segment)
+	{
+		const TArrayView<const double> Times = Span.GetTimestamps(Segment);
+		TArrayView<const float> Values[NumChannels];
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Values[Channel] = Span.GetChannel(static_cast<ESonyGamepadChannel>(Channel), Segment);
+		}
+
+		for (int32 Sample = 0; Sample < Times.Num(); ++Sample)
+		{
+			const double Time = Times[Sample];
+			if (!bHasPrevious || Time - NextTime > 1.0)
+			{
+				// First sample, or a gap of more than a second: restart the grid instead of filling it.
+				NextTime = Time;
+			}
+			else if (Time > PreviousTime)
+			{
+				for (; NextTime <= Time; NextTime += Step)
+				{
+					const float Alpha = static_cast<float>((NextTime - PreviousTime) / (Time - PreviousTime));
+					Timestamps.Add(NextTime);
+					for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+					{
+						Channels[Channel].Add(FMath::Lerp(Previous[Channel], Values[Channel][Sample], Alpha));
+					}
+				}
+			}
+
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Previous[Channel] = Values[Channel][Sample];
+			}
+			PreviousTime = Time;
+			bHasPrevious = true;
+		}
+	}
+
+	return Timestamps.Num();
+}
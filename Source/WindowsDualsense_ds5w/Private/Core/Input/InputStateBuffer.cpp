@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/InputStateBuffer.h"
+
+void FInputStateBuffer::Publish(const FSonyGamepadInputState& State)
+{
+	const uint32 Index = (Latest.load(std::memory_order_relaxed) + 1) % 3;
+	FSlot& Slot = Slots[Index];
+
+	Slot.Version.fetch_add(1, std::memory_order_acq_rel);
+	Slot.State = State;
+	Slot.Version.fetch_add(1, std::memory_order_release);
+
+	Latest.store(Index, std::memory_order_release);
+	bHasState.store(true, std::memory_order_release);
+}
+
+bool FInputStateBuffer::Read(FSonyGamepadInputState& OutState) const
+{
+	if (!bHasState.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	for (;;)
+	{
+		const FSlot& Slot = Slots[Latest.load(std::memory_order_acquire)];
+		const uint32 VersionBefore = Slot.Version.load(std::memory_order_acquire);
+		if (VersionBefore & 1)
+		{
+			// The writer lapped the buffer and is writing this slot, the next one is complete.
+			FPlatformProcess::YieldThread();
+			continue;
+		}
+
+		OutState = Slot.State;
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Slot.Version.load(std::memory_order_relaxed) == VersionBefore)
+		{
+			return true;
+		}
+	}
+}
@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/MotionFusion.h"
+
+#include "Core/Enums/EDeviceCommons.h"
+
+namespace
+{
+	/**
+	 * Up axis of the world frame. The accelerometer reads +1 g on Y when the controller lies flat,
+	 * so the orientation is the identity in that pose.
+	 */
+	const VectorRegister4Float WorldUp = MakeVectorRegisterFloat(0.0f, 1.0f, 0.0f, 0.0f);
+
+	/**
+	 * Range of accelerometer magnitudes, in g, trusted as a gravity measurement. Outside of it the
+	 * controller is being shaken or swung, and only the gyroscope drives the orientation.
+	 */
+	constexpr float MinTrustedGravity = 0.8f;
+	constexpr float MaxTrustedGravity = 1.2f;
+}
+
+FMotionFusion::FMotionFusion()
+	: Orientation(GlobalVectorConstants::Float0001)
+	, IntegralError(GlobalVectorConstants::FloatZero)
+	, ProportionalGain(0.5f)
+	, IntegralGain(0.01f)
+	, bAligned(false)
+{
+}
+
+void FMotionFusion::Reset()
+{
+	Orientation = GlobalVectorConstants::Float0001;
+	IntegralError = GlobalVectorConstants::FloatZero;
+	bAligned = false;
+}
+
+void FMotionFusion::Update(FSonyGamepadInputState& State, const float DeltaTime)
+{
+	const FVector3f& GyroRaw = State.Gyroscope;
+	const FVector3f& AccelRaw = State.Accelerometer;
+	const VectorRegister4Float Gyro = VectorMultiply(VectorLoadFloat3_W0(&GyroRaw.X), VectorSetFloat1(UE_PI / (180.0f * GYRO_RAW_PER_DEGREE_S)));
+	const VectorRegister4Float Accel = VectorMultiply(VectorLoadFloat3_W0(&AccelRaw.X), VectorSetFloat1(1.0f / ACCEL_RAW_PER_G));
+	const float AccelSquared = VectorDot3Scalar(Accel, Accel);
+	const bool bTrustAccel = AccelSquared > MinTrustedGravity * MinTrustedGravity && AccelSquared < MaxTrustedGravity * MaxTrustedGravity;
+
+	if (!bAligned && bTrustAccel)
+	{
+		// Starts from the measured gravity, instead of converging slowly from the identity.
+		const FQuat4f Initial = FQuat4f::FindBetweenNormals(AccelRaw.GetSafeNormal(), FVector3f(0.0f, 1.0f, 0.0f));
+		Orientation = MakeVectorRegisterFloat(Initial.X, Initial.Y, Initial.Z, Initial.W);
+		bAligned = true;
+	}
+
+	VectorRegister4Float Rate = VectorAdd(Gyro, IntegralError);
+	if (bAligned && DeltaTime > 0.0f)
+	{
+		if (bTrustAccel)
+		{
+			// The error is the rotation between the measured and the estimated gravity, in the device frame.
+			const VectorRegister4Float Measured = VectorMultiply(Accel, VectorReciprocalSqrt(VectorSetFloat1(AccelSquared)));
+			const VectorRegister4Float Estimated = VectorQuaternionInverseRotateVector(Orientation, WorldUp);
+			const VectorRegister4Float Error = VectorCross(Measured, Estimated);
+
+			IntegralError = VectorMultiplyAdd(Error, VectorSetFloat1(IntegralGain * DeltaTime), IntegralError);
+			Rate = VectorMultiplyAdd(Error, VectorSetFloat1(ProportionalGain), VectorAdd(Gyro, IntegralError));
+		}
+
+		// q' = q + 1/2 * q * (w, 0) * dt
+		const VectorRegister4Float Derivative = VectorQuaternionMultiply2(Orientation, Rate);
+		Orientation = VectorNormalizeQuaternion(VectorMultiplyAdd(Derivative, VectorSetFloat1(0.5f * DeltaTime), Orientation));
+	}
+
+	// The gravity and the linear acceleration follow from these two and the accelerometer, see FSonyGamepadInputState.
+	VectorStore(Orientation, &State.Orientation.X);
+	VectorStoreFloat3(VectorAdd(Gyro, IntegralError), &State.AngularVelocity.X);
+}
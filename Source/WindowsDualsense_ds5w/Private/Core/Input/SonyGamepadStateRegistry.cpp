@@ -0,0 +1,89 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/SonyGamepadStateRegistry.h"
+
+FInputStateBuffer FSonyGamepadStateRegistry::Buffers[SONY_GAMEPAD_MAX_STATE_SLOTS];
+FInputSampleHistory FSonyGamepadStateRegistry::Histories[SONY_GAMEPAD_MAX_STATE_SLOTS];
+FGyroLookProcessor FSonyGamepadStateRegistry::LookProcessors[SONY_GAMEPAD_MAX_STATE_SLOTS];
+FTouchTracker FSonyGamepadStateRegistry::TouchTrackers[SONY_GAMEPAD_MAX_STATE_SLOTS];
+FAnalogConditioner FSonyGamepadStateRegistry::AnalogConditioners[SONY_GAMEPAD_MAX_STATE_SLOTS];
+FButtonRemapper FSonyGamepadStateRegistry::ButtonRemappers[SONY_GAMEPAD_MAX_STATE_SLOTS];
+FInputPredictor FSonyGamepadStateRegistry::Predictors[SONY_GAMEPAD_MAX_STATE_SLOTS];
+
+FInputStateBuffer* FSonyGamepadStateRegistry::GetBuffer(const int32 ControllerId)
+{
+	if (ControllerId < 0 || ControllerId >= SONY_GAMEPAD_MAX_STATE_SLOTS)
+	{
+		return nullptr;
+	}
+
+	return &Buffers[ControllerId];
+}
+
+bool FSonyGamepadStateRegistry::GetLatestState(const int32 ControllerId, FSonyGamepadInputState& OutState)
+{
+	const FInputStateBuffer* Buffer = GetBuffer(ControllerId);
+	return Buffer && Buffer->Read(OutState);
+}
+
+FInputSampleHistory* FSonyGamepadStateRegistry::GetHistory(const int32 ControllerId)
+{
+	if (ControllerId < 0 || ControllerId >= SONY_GAMEPAD_MAX_STATE_SLOTS)
+	{
+		return nullptr;
+	}
+
+	return &Histories[ControllerId];
+}
+
+FGyroLookProcessor* FSonyGamepadStateRegistry::GetLookProcessor(const int32 ControllerId)
+{
+	if (ControllerId < 0 || ControllerId >= SONY_GAMEPAD_MAX_STATE_SLOTS)
+	{
+		return nullptr;
+	}
+
+	return &LookProcessors[ControllerId];
+}
+
+FTouchTracker* FSonyGamepadStateRegistry::GetTouchTracker(const int32 ControllerId)
+{
+	if (ControllerId < 0 || ControllerId >= SONY_GAMEPAD_MAX_STATE_SLOTS)
+	{
+		return nullptr;
+	}
+
+	return &TouchTrackers[ControllerId];
+}
+
+FAnalogConditioner* FSonyGamepadStateRegistry::GetAnalogConditioner(const int32 ControllerId)
+{
+	if (ControllerId < 0 || ControllerId >= SONY_GAMEPAD_MAX_STATE_SLOTS)
+	{
+		return nullptr;
+	}
+
+	return &AnalogConditioners[ControllerId];
+}
+
+FButtonRemapper* FSonyGamepadStateRegistry::GetButtonRemapper(const int32 ControllerId)
+{
+	if (ControllerId < 0 || ControllerId >= SONY_GAMEPAD_MAX_STATE_SLOTS)
+	{
+		return nullptr;
+	}
+
+	return &ButtonRemappers[ControllerId];
+}
+
+FInputPredictor* FSonyGamepadStateRegistry::GetPredictor(const int32 ControllerId)
+{
+	if (ControllerId < 0 || ControllerId >= SONY_GAMEPAD_MAX_STATE_SLOTS)
+	{
+		return nullptr;
+	}
+
+	return &Predictors[ControllerId];
+}
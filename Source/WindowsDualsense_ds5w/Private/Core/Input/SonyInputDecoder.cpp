@@ -0,0 +1,379 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/SonyInputDecoder.h"
+
+#include "Core/Enums/EDeviceCommons.h"
+#include "Core/SonyGamepadKeyNames.h"
+#include "InputCoreTypes.h"
+
+namespace
+{
+	constexpr uint32 ButtonBit(const ESonyGamepadButton Button)
+	{
+		return 1u << static_cast<uint8>(Button);
+	}
+
+	/**
+	 * Key names sent for each bit of the button word. Some buttons are also sent under the
+	 * native gamepad name, so games using FGamepadKeyNames work out of the box.
+	 */
+	struct FButtonKeys
+	{
+		FName Primary;
+		FName Alias;
+	};
+
+	const FButtonKeys* GetButtonKeys()
+	{
+		static const FButtonKeys Keys[static_cast<uint8>(ESonyGamepadButton::Count)] = {
+			{FGamepadKeyNames::FaceButtonBottom, NAME_None},
+			{FGamepadKeyNames::FaceButtonLeft, NAME_None},
+			{FGamepadKeyNames::FaceButtonRight, NAME_None},
+			{FGamepadKeyNames::FaceButtonTop, NAME_None},
+			{FGamepadKeyNames::DPadUp, NAME_None},
+			{FGamepadKeyNames::DPadDown, NAME_None},
+			{FGamepadKeyNames::DPadLeft, NAME_None},
+			{FGamepadKeyNames::DPadRight, NAME_None},
+			{FGamepadKeyNames::LeftShoulder, NAME_None},
+			{FGamepadKeyNames::RightShoulder, NAME_None},
+			{FGamepadKeyNames::LeftTriggerThreshold, NAME_None},
+			{FGamepadKeyNames::RightTriggerThreshold, NAME_None},
+			{FSonyGamepadKeyNames::PushLeftStick, FGamepadKeyNames::LeftThumb},
+			{FSonyGamepadKeyNames::PushRightStick, FGamepadKeyNames::RightThumb},
+			{FSonyGamepadKeyNames::Menu, FGamepadKeyNames::SpecialRight},
+			{FSonyGamepadKeyNames::Share, FGamepadKeyNames::SpecialLeft},
+			{FSonyGamepadKeyNames::PlayStationButton, NAME_None},
+			{FSonyGamepadKeyNames::TouchButton, NAME_None},
+			{FSonyGamepadKeyNames::Mic, NAME_None},
+			{FSonyGamepadKeyNames::FunctionL, NAME_None},
+			{FSonyGamepadKeyNames::FunctionR, NAME_None},
+			{FSonyGamepadKeyNames::PaddleL, NAME_None},
+			{FSonyGamepadKeyNames::PaddleR, NAME_None},
+			{FGamepadKeyNames::LeftStickUp, NAME_None},
+			{FGamepadKeyNames::LeftStickDown, NAME_None},
+			{FGamepadKeyNames::LeftStickLeft, NAME_None},
+			{FGamepadKeyNames::LeftStickRight, NAME_None},
+			{FGamepadKeyNames::RightStickUp, NAME_None},
+			{FGamepadKeyNames::RightStickDown, NAME_None},
+			{FGamepadKeyNames::RightStickLeft, NAME_None},
+			{FGamepadKeyNames::RightStickRight, NAME_None},
+		};
+		return Keys;
+	}
+
+	/**
+	 * Position of a finger as the values of its axis keys: -1 to 1 from left to right and from bottom
+	 * to top, like a stick, and 0 when the finger is lifted.
+	 *
+	 * @param Height Height of the touchpad of the device, which differs between models.
+	 */
+	FVector2f GetTouchAxes(const FSonyGamepadTouch& Touch, const float Height)
+	{
+		if (!Touch.bDown)
+		{
+			return FVector2f::ZeroVector;
+		}
+		return FVector2f(Touch.X / TOUCHPAD_WIDTH * 2.0f - 1.0f, 1.0f - Touch.Y / Height * 2.0f);
+	}
+
+	/**
+	 * Device Y turns the other way than a yaw to the right, so the gyro and tilt axis keys both flip it.
+	 */
+	FVector3f ToPitchYawRoll(const FVector3f& DeviceAxes)
+	{
+		return FVector3f(DeviceAxes.X, -DeviceAxes.Y, DeviceAxes.Z);
+	}
+
+	/**
+	 * Angular velocity as the values of the gyro axis keys, in degrees per second: pitch up, yaw right and roll.
+	 */
+	FVector3f GetGyroAxes(const FSonyGamepadInputState& State)
+	{
+		return ToPitchYawRoll(State.AngularVelocity * (180.0f / UE_PI));
+	}
+
+	/**
+	 * Orientation as the values of the tilt axis keys, in degrees, with the signs of GetGyroAxes.
+	 */
+	FVector3f GetTiltAxes(const FSonyGamepadInputState& State)
+	{
+		return ToPitchYawRoll(FVector3f(State.Orientation.Euler()));
+	}
+}
+
+void FSonyInputDecoder::DecodeDualSense(const unsigned char* Report, const EDeviceConnection Connection, const FImuCalibration& Calibration, FSonyGamepadInputState& OutState)
+{
+	const unsigned char* HIDInput = &Report[Connection == Bluetooth ? 2 : 1];
+
+	OutState.LeftStick = FVector2f(DecodeAxis(HIDInput[0x00], false), DecodeAxis(HIDInput[0x01], true));
+	OutState.RightStick = FVector2f(DecodeAxis(HIDInput[0x02], false), DecodeAxis(HIDInput[0x03], true));
+	OutState.LeftTrigger = HIDInput[0x04] / 256.0f;
+	OutState.RightTrigger = HIDInput[0x05] / 256.0f;
+
+	uint32 Buttons = DecodeButtons(HIDInput[0x07], HIDInput[0x08], HIDInput[0x09]);
+	Buttons |= DecodeDualSenseButtons(HIDInput[0x09]);
+	Buttons |= DecodeStickDirections(OutState.LeftStick, OutState.RightStick);
+	OutState.Buttons = static_cast<int32>(Buttons);
+
+	DecodeTouch(&HIDInput[0x20], OutState.Touch1);
+	DecodeTouch(&HIDInput[0x24], OutState.Touch2);
+
+	DecodeImu(&HIDInput[15], Calibration, OutState);
+
+	OutState.Battery = static_cast<uint8>(((HIDInput[0x34] & 0x0F) * 100) / 8);
+}
+
+void FSonyInputDecoder::DecodeDualShock(const unsigned char* Report, const EDeviceConnection Connection, const FImuCalibration& Calibration, FSonyGamepadInputState& OutState)
+{
+	const unsigned char* HIDInput = &Report[Connection == Bluetooth ? 3 : 1];
+
+	OutState.LeftStick = FVector2f(DecodeAxis(HIDInput[0x00], false), DecodeAxis(HIDInput[0x01], true));
+	OutState.RightStick = FVector2f(DecodeAxis(HIDInput[0x02], false), DecodeAxis(HIDInput[0x03], true));
+	OutState.LeftTrigger = HIDInput[0x07] / 256.0f;
+	OutState.RightTrigger = HIDInput[0x08] / 256.0f;
+
+	uint32 Buttons = DecodeButtons(HIDInput[0x04], HIDInput[0x05], HIDInput[0x06]);
+	Buttons |= DecodeStickDirections(OutState.LeftStick, OutState.RightStick);
+	OutState.Buttons = static_cast<int32>(Buttons);
+
+	DecodeTouch(&HIDInput[34], OutState.Touch1);
+	DecodeTouch(&HIDInput[38], OutState.Touch2);
+
+	DecodeImu(&HIDInput[12], Calibration, OutState);
+
+	// Low nibble of the status byte holds the battery level in tenths.
+	OutState.Battery = static_cast<uint8>(FMath::Min((HIDInput[29] & 0x0F) * 10 + 5, 100));
+}
+
+void FSonyInputDecoder::UpdateMotion(FSonyGamepadInputState& State, const double PreviousTimestamp, FMotionFusion& Fusion)
+{
+	// Caps the step, so a stall of the reader does not turn into a jump of the orientation.
+	const double DeltaTime = PreviousTimestamp > 0.0 ? FMath::Clamp(State.Timestamp - PreviousTimestamp, 0.0, 0.05) : 0.0;
+	Fusion.Update(State, static_cast<float>(DeltaTime));
+}
+
+void FSonyInputDecoder::DispatchEvents(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
+                                       const FPlatformUserId UserId, const FInputDeviceId InputDeviceId, const EDeviceType DeviceType,
+                                       const FSonyGamepadInputState& Previous, const FSonyGamepadInputState& Current,
+                                       const bool bTouch, const bool bMotion)
+{
+	FGenericApplicationMessageHandler& Handler = InMessageHandler.Get();
+
+	// The conditioner holds an axis until it moves by more than the change epsilon, so an exact
+	// comparison is enough to only send the axes that moved.
+	auto SendAnalog = [&](const FName& Key, const float Before, const float After)
+	{
+		if (After != Before)
+		{
+			Handler.OnControllerAnalog(Key, UserId, InputDeviceId, After);
+		}
+	};
+	SendAnalog(FGamepadKeyNames::LeftAnalogX, Previous.LeftStick.X, Current.LeftStick.X);
+	SendAnalog(FGamepadKeyNames::LeftAnalogY, Previous.LeftStick.Y, Current.LeftStick.Y);
+	SendAnalog(FGamepadKeyNames::RightAnalogX, Previous.RightStick.X, Current.RightStick.X);
+	SendAnalog(FGamepadKeyNames::RightAnalogY, Previous.RightStick.Y, Current.RightStick.Y);
+	SendAnalog(FGamepadKeyNames::LeftTriggerAnalog, Previous.LeftTrigger, Current.LeftTrigger);
+	SendAnalog(FGamepadKeyNames::RightTriggerAnalog, Previous.RightTrigger, Current.RightTrigger);
+
+	// Only the buttons whose bit flipped since the previous state generate an event.
+	const FButtonKeys* Keys = GetButtonKeys();
+	uint32 Changed = static_cast<uint32>(Previous.Buttons ^ Current.Buttons);
+	while (Changed)
+	{
+		const uint32 Index = FMath::CountTrailingZeros(Changed);
+		Changed &= Changed - 1;
+
+		const bool bPressed = (static_cast<uint32>(Current.Buttons) >> Index) & 1;
+		for (const FName& Key : {Keys[Index].Primary, Keys[Index].Alias})
+		{
+			if (Key.IsNone())
+			{
+				continue;
+			}
+
+			if (bPressed)
+			{
+				Handler.OnControllerButtonPressed(Key, UserId, InputDeviceId, false);
+			}
+			else
+			{
+				Handler.OnControllerButtonReleased(Key, UserId, InputDeviceId, false);
+			}
+		}
+	}
+
+	if (bTouch)
+	{
+		// Events are only sent on transitions. The touch index is the slot of the finger, the device id
+		// of the contact only tells a finger lifted and put back between two states apart.
+		const FSonyGamepadTouch* PreviousTouches[2] = {&Previous.Touch1, &Previous.Touch2};
+		const FSonyGamepadTouch* CurrentTouches[2] = {&Current.Touch1, &Current.Touch2};
+		for (int32 Index = 0; Index < 2; ++Index)
+		{
+			const FSonyGamepadTouch& Before = *PreviousTouches[Index];
+			const FSonyGamepadTouch& After = *CurrentTouches[Index];
+			const bool bNewContact = After.bDown && (!Before.bDown || Before.Id != After.Id);
+
+			if (Before.bDown && (!After.bDown || bNewContact))
+			{
+				Handler.OnTouchEnded(Before.GetPosition(), Index, UserId, InputDeviceId);
+			}
+
+			if (bNewContact)
+			{
+				Handler.OnTouchStarted(nullptr, After.GetPosition(), 1.0f, Index, UserId, InputDeviceId);
+			}
+			else if (After.bDown && (After.X != Before.X || After.Y != Before.Y))
+			{
+				Handler.OnTouchMoved(After.GetPosition(), 1.0f, Index, UserId, InputDeviceId);
+			}
+		}
+
+		const float Height = DeviceType == DualShock4 ? TOUCHPAD_HEIGHT_DUALSHOCK4 : TOUCHPAD_HEIGHT;
+		const FVector2f Touch1Before = GetTouchAxes(Previous.Touch1, Height);
+		const FVector2f Touch1After = GetTouchAxes(Current.Touch1, Height);
+		const FVector2f Touch2Before = GetTouchAxes(Previous.Touch2, Height);
+		const FVector2f Touch2After = GetTouchAxes(Current.Touch2, Height);
+		SendAnalog(FSonyGamepadKeyNames::Touch1X, Touch1Before.X, Touch1After.X);
+		SendAnalog(FSonyGamepadKeyNames::Touch1Y, Touch1Before.Y, Touch1After.Y);
+		SendAnalog(FSonyGamepadKeyNames::Touch2X, Touch2Before.X, Touch2After.X);
+		SendAnalog(FSonyGamepadKeyNames::Touch2Y, Touch2Before.Y, Touch2After.Y);
+	}
+
+	if (bMotion)
+	{
+		const FVector3f Gravity = Current.GetGravity();
+		const FVector Tilt = FVector(Current.Orientation.Euler());
+		Handler.OnMotionDetected(Tilt, FVector(Current.AngularVelocity), FVector(Gravity), FVector(Current.GetLinearAcceleration()), UserId, InputDeviceId);
+
+		// The same values as axis keys, which Enhanced Input binds directly. The paired 2D keys are
+		// assembled by the engine from these events.
+		const FVector3f GyroBefore = GetGyroAxes(Previous);
+		const FVector3f GyroAfter = GetGyroAxes(Current);
+		SendAnalog(FSonyGamepadKeyNames::GyroPitch, GyroBefore.X, GyroAfter.X);
+		SendAnalog(FSonyGamepadKeyNames::GyroYaw, GyroBefore.Y, GyroAfter.Y);
+		SendAnalog(FSonyGamepadKeyNames::GyroRoll, GyroBefore.Z, GyroAfter.Z);
+
+		const FVector3f TiltBefore = GetTiltAxes(Previous);
+		const FVector3f TiltAfter = GetTiltAxes(Current);
+		SendAnalog(FSonyGamepadKeyNames::TiltPitch, TiltBefore.X, TiltAfter.X);
+		SendAnalog(FSonyGamepadKeyNames::TiltYaw, TiltBefore.Y, TiltAfter.Y);
+		SendAnalog(FSonyGamepadKeyNames::TiltRoll, TiltBefore.Z, TiltAfter.Z);
+
+		const FVector3f GravityBefore = Previous.GetGravity() / STANDARD_GRAVITY;
+		const FVector3f GravityAfter = Gravity / STANDARD_GRAVITY;
+		SendAnalog(FSonyGamepadKeyNames::GravityX, GravityBefore.X, GravityAfter.X);
+		SendAnalog(FSonyGamepadKeyNames::GravityY, GravityBefore.Y, GravityAfter.Y);
+		SendAnalog(FSonyGamepadKeyNames::GravityZ, GravityBefore.Z, GravityAfter.Z);
+	}
+}
+
+void FSonyInputDecoder::DispatchGestures(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
+                                         const FPlatformUserId UserId, const FInputDeviceId InputDeviceId,
+                                         FTouchTracker& Tracker, const bool bTouch)
+{
+	FName Gesture;
+	while (Tracker.PopGesture(Gesture))
+	{
+		if (bTouch)
+		{
+			// Gestures are instantaneous, so each one is a press immediately followed by a release.
+			InMessageHandler->OnControllerButtonPressed(Gesture, UserId, InputDeviceId, false);
+			InMessageHandler->OnControllerButtonReleased(Gesture, UserId, InputDeviceId, false);
+		}
+	}
+}
+
+uint32 FSonyInputDecoder::DecodeButtons(const uint8 FaceAndHat, const uint8 Shoulders, const uint8 Special)
+{
+	uint32 Buttons = 0;
+	Buttons |= (FaceAndHat & BTN_CROSS) ? ButtonBit(ESonyGamepadButton::Cross) : 0;
+	Buttons |= (FaceAndHat & BTN_SQUARE) ? ButtonBit(ESonyGamepadButton::Square) : 0;
+	Buttons |= (FaceAndHat & BTN_CIRCLE) ? ButtonBit(ESonyGamepadButton::Circle) : 0;
+	Buttons |= (FaceAndHat & BTN_TRIANGLE) ? ButtonBit(ESonyGamepadButton::Triangle) : 0;
+
+	// The hat switch reports the direction clockwise from up, 8 meaning released.
+	static constexpr uint32 HatDirections[8] = {
+		ButtonBit(ESonyGamepadButton::DPadUp),
+		ButtonBit(ESonyGamepadButton::DPadUp) | ButtonBit(ESonyGamepadButton::DPadRight),
+		ButtonBit(ESonyGamepadButton::DPadRight),
+		ButtonBit(ESonyGamepadButton::DPadDown) | ButtonBit(ESonyGamepadButton::DPadRight),
+		ButtonBit(ESonyGamepadButton::DPadDown),
+		ButtonBit(ESonyGamepadButton::DPadDown) | ButtonBit(ESonyGamepadButton::DPadLeft),
+		ButtonBit(ESonyGamepadButton::DPadLeft),
+		ButtonBit(ESonyGamepadButton::DPadUp) | ButtonBit(ESonyGamepadButton::DPadLeft),
+	};
+	const uint8 Hat = FaceAndHat & 0x0F;
+	Buttons |= Hat < 8 ? HatDirections[Hat] : 0;
+
+	Buttons |= (Shoulders & BTN_LEFT_SHOLDER) ? ButtonBit(ESonyGamepadButton::LeftShoulder) : 0;
+	Buttons |= (Shoulders & BTN_RIGHT_SHOLDER) ? ButtonBit(ESonyGamepadButton::RightShoulder) : 0;
+	Buttons |= (Shoulders & BTN_LEFT_TRIGGER) ? ButtonBit(ESonyGamepadButton::LeftTrigger) : 0;
+	Buttons |= (Shoulders & BTN_RIGHT_TRIGGER) ? ButtonBit(ESonyGamepadButton::RightTrigger) : 0;
+	Buttons |= (Shoulders & BTN_LEFT_STICK) ? ButtonBit(ESonyGamepadButton::LeftThumb) : 0;
+	Buttons |= (Shoulders & BTN_RIGHT_STICK) ? ButtonBit(ESonyGamepadButton::RightThumb) : 0;
+	Buttons |= (Shoulders & BTN_START) ? ButtonBit(ESonyGamepadButton::Menu) : 0;
+	Buttons |= (Shoulders & BTN_SELECT) ? ButtonBit(ESonyGamepadButton::Share) : 0;
+
+	Buttons |= (Special & BTN_PLAYSTATION_LOGO) ? ButtonBit(ESonyGamepadButton::PlayStation) : 0;
+	Buttons |= (Special & BTN_PAD_BUTTON) ? ButtonBit(ESonyGamepadButton::TouchPad) : 0;
+	return Buttons;
+}
+
+uint32 FSonyInputDecoder::DecodeDualSenseButtons(const uint8 Special)
+{
+	uint32 Buttons = 0;
+	Buttons |= (Special & BTN_MIC_BUTTON) ? ButtonBit(ESonyGamepadButton::Mic) : 0;
+	Buttons |= (Special & BTN_FN1) ? ButtonBit(ESonyGamepadButton::FunctionL) : 0;
+	Buttons |= (Special & BTN_FN2) ? ButtonBit(ESonyGamepadButton::FunctionR) : 0;
+	Buttons |= (Special & BTN_PADDLE_LEFT) ? ButtonBit(ESonyGamepadButton::PaddleL) : 0;
+	Buttons |= (Special & BTN_PADDLE_RIGHT) ? ButtonBit(ESonyGamepadButton::PaddleR) : 0;
+	return Buttons;
+}
+
+uint32 FSonyInputDecoder::DecodeStickDirections(const FVector2f& LeftStick, const FVector2f& RightStick)
+{
+	constexpr float Threshold = 0.5f;
+
+	uint32 Buttons = 0;
+	Buttons |= LeftStick.Y > Threshold ? ButtonBit(ESonyGamepadButton::LeftStickUp) : 0;
+	Buttons |= LeftStick.Y < -Threshold ? ButtonBit(ESonyGamepadButton::LeftStickDown) : 0;
+	Buttons |= LeftStick.X < -Threshold ? ButtonBit(ESonyGamepadButton::LeftStickLeft) : 0;
+	Buttons |= LeftStick.X > Threshold ? ButtonBit(ESonyGamepadButton::LeftStickRight) : 0;
+	Buttons |= RightStick.Y > Threshold ? ButtonBit(ESonyGamepadButton::RightStickUp) : 0;
+	Buttons |= RightStick.Y < -Threshold ? ButtonBit(ESonyGamepadButton::RightStickDown) : 0;
+	Buttons |= RightStick.X < -Threshold ? ButtonBit(ESonyGamepadButton::RightStickLeft) : 0;
+	Buttons |= RightStick.X > Threshold ? ButtonBit(ESonyGamepadButton::RightStickRight) : 0;
+	return Buttons;
+}
+
+void FSonyInputDecoder::DecodeTouch(const unsigned char* Data, FSonyGamepadTouch& OutTouch)
+{
+	// Contact byte (bit 7 set when not touching, id in the low bits), then 12-bit X and 12-bit Y.
+	OutTouch.Id = Data[0] & 0x7F;
+	OutTouch.bDown = (Data[0] & 0x80) == 0;
+	OutTouch.X = static_cast<int16>(Data[1] | ((Data[2] & 0x0F) << 8));
+	OutTouch.Y = static_cast<int16>((Data[2] >> 4) | (Data[3] << 4));
+}
+
+void FSonyInputDecoder::DecodeImu(const unsigned char* Data, const FImuCalibration& Calibration, FSonyGamepadInputState& OutState)
+{
+	// Three little-endian words of gyroscope, then three of accelerometer.
+	int32 Axes[IMU_CALIBRATION_AXES];
+	for (int32 Axis = 0; Axis < IMU_CALIBRATION_AXES; ++Axis)
+	{
+		Axes[Axis] = Calibration.Apply(Axis, static_cast<int16>(Data[Axis * 2] | (Data[Axis * 2 + 1] << 8)));
+	}
+
+	OutState.Gyroscope = FVector3f(Axes[0], Axes[1], Axes[2]);
+	OutState.Accelerometer = FVector3f(Axes[3], Axes[4], Axes[5]);
+}
+
+float FSonyInputDecoder::DecodeAxis(const unsigned char Value, const bool bInvert)
+{
+	// Centered on 128, Y grows downwards on the device.
+	const int32 Centered = bInvert ? 127 - Value : Value - 128;
+	return Centered / 128.0f;
+}
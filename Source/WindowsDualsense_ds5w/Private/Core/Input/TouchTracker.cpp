@@ -0,0 +1,194 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Input/TouchTracker.h"
+
+#include "Core/SonyGamepadKeyNames.h"
+
+namespace
+{
+	/**
+	 * Thresholds of the gestures, in seconds and in touchpad units (the DualSense pad is 1920 units wide).
+	 */
+	constexpr double TapMaxDuration = 0.25;
+	constexpr float TapMaxTravel = 60.0f;
+	constexpr double SwipeMaxDuration = 0.6;
+	constexpr float SwipeMinDistance = 400.0f;
+	constexpr float PinchMinChange = 250.0f;
+	/**
+	 * Weight of the latest report in the smoothed velocity of a contact.
+	 */
+	constexpr float VelocitySmoothing = 0.5f;
+
+	uint64 PackVelocity(const FVector2D& Velocity)
+	{
+		const float X = static_cast<float>(Velocity.X);
+		const float Y = static_cast<float>(Velocity.Y);
+		uint32 XBits;
+		uint32 YBits;
+		FMemory::Memcpy(&XBits, &X, sizeof(float));
+		FMemory::Memcpy(&YBits, &Y, sizeof(float));
+		return static_cast<uint64>(XBits) | (static_cast<uint64>(YBits) << 32);
+	}
+
+	FVector2D UnpackVelocity(const uint64 Packed)
+	{
+		const uint32 XBits = static_cast<uint32>(Packed);
+		const uint32 YBits = static_cast<uint32>(Packed >> 32);
+		float X;
+		float Y;
+		FMemory::Memcpy(&X, &XBits, sizeof(float));
+		FMemory::Memcpy(&Y, &YBits, sizeof(float));
+		return FVector2D(X, Y);
+	}
+}
+
+void FTouchTracker::Process(const FSonyGamepadInputState& State)
+{
+	UpdateContact(Contacts[0], State.Touch1, State.Timestamp);
+	UpdateContact(Contacts[1], State.Touch2, State.Timestamp);
+	PackedVelocities[0].store(PackVelocity(Contacts[0].Velocity), std::memory_order_relaxed);
+	PackedVelocities[1].store(PackVelocity(Contacts[1].Velocity), std::memory_order_relaxed);
+
+	const int32 Fingers = (Contacts[0].bDown ? 1 : 0) + (Contacts[1].bDown ? 1 : 0);
+	if (Fingers > 0 && !bGestureActive)
+	{
+		bGestureActive = true;
+		bPinchRecognized = false;
+		GestureStartTime = State.Timestamp;
+		PinchStartDistance = 0.0f;
+		MaxFingers = 0;
+		for (FContact& Contact : Contacts)
+		{
+			Contact.bInGesture = Contact.bDown;
+		}
+	}
+
+	if (!bGestureActive)
+	{
+		return;
+	}
+
+	MaxFingers = FMath::Max(MaxFingers, Fingers);
+	if (Fingers == 2)
+	{
+		const float Distance = FVector2D::Distance(Contacts[0].LastPosition, Contacts[1].LastPosition);
+		if (PinchStartDistance <= 0.0f)
+		{
+			PinchStartDistance = Distance;
+		}
+		else if (!bPinchRecognized && FMath::Abs(Distance - PinchStartDistance) >= PinchMinChange)
+		{
+			Gestures.Enqueue(Distance > PinchStartDistance ? FSonyGamepadKeyNames::TouchPinchOut : FSonyGamepadKeyNames::TouchPinchIn);
+			bPinchRecognized = true;
+		}
+	}
+	else if (Fingers == 0)
+	{
+		RecognizeEnd(State.Timestamp);
+		bGestureActive = false;
+	}
+}
+
+FVector2D FTouchTracker::GetContactVelocity(const int32 Contact) const
+{
+	if (Contact < 0 || Contact >= static_cast<int32>(UE_ARRAY_COUNT(PackedVelocities)))
+	{
+		return FVector2D::ZeroVector;
+	}
+	return UnpackVelocity(PackedVelocities[Contact].load(std::memory_order_relaxed));
+}
+
+void FTouchTracker::Reset()
+{
+	for (FContact& Contact : Contacts)
+	{
+		Contact = FContact();
+	}
+	for (std::atomic<uint64>& Velocity : PackedVelocities)
+	{
+		Velocity.store(0, std::memory_order_relaxed);
+	}
+
+	FName Discarded;
+	while (Gestures.Dequeue(Discarded))
+	{
+	}
+	bGestureActive = false;
+}
+
+void FTouchTracker::UpdateContact(FContact& Contact, const FSonyGamepadTouch& Touch, const double Timestamp)
+{
+	if (!Touch.bDown)
+	{
+		Contact.bDown = false;
+		Contact.Velocity = FVector2D::ZeroVector;
+		return;
+	}
+
+	const FVector2D Position = Touch.GetPosition();
+	if (!Contact.bDown || Contact.Id != Touch.Id)
+	{
+		// A new finger, or a new contact id after the finger was lifted and put back between two reports.
+		Contact.bDown = true;
+		Contact.bInGesture = true;
+		Contact.Id = Touch.Id;
+		Contact.StartPosition = Position;
+		Contact.LastPosition = Position;
+		Contact.Velocity = FVector2D::ZeroVector;
+		Contact.Travel = 0.0f;
+	}
+	else
+	{
+		const double DeltaTime = Timestamp - Contact.LastTime;
+		if (DeltaTime > 0.0)
+		{
+			const FVector2D Instant = (Position - Contact.LastPosition) / DeltaTime;
+			Contact.Velocity = FMath::Lerp(Contact.Velocity, Instant, VelocitySmoothing);
+		}
+		Contact.Travel += FVector2D::Distance(Position, Contact.LastPosition);
+		Contact.LastPosition = Position;
+	}
+
+	Contact.LastTime = Timestamp;
+}
+
+void FTouchTracker::RecognizeEnd(const double Timestamp)
+{
+	if (bPinchRecognized)
+	{
+		return;
+	}
+
+	float MaxTravel = 0.0f;
+	FVector2D Displacement = FVector2D::ZeroVector;
+	for (const FContact& Contact : Contacts)
+	{
+		if (Contact.bInGesture)
+		{
+			MaxTravel = FMath::Max(MaxTravel, Contact.Travel);
+			Displacement = Contact.LastPosition - Contact.StartPosition;
+		}
+	}
+
+	const double Duration = Timestamp - GestureStartTime;
+	if (Duration <= TapMaxDuration && MaxTravel <= TapMaxTravel)
+	{
+		Gestures.Enqueue(MaxFingers >= 2 ? FSonyGamepadKeyNames::TouchTwoFingerTap : FSonyGamepadKeyNames::TouchTap);
+		return;
+	}
+
+	if (MaxFingers == 1 && Duration <= SwipeMaxDuration && Displacement.Size() >= SwipeMinDistance)
+	{
+		// The touchpad Y axis grows downwards.
+		if (FMath::Abs(Displacement.X) >= FMath::Abs(Displacement.Y))
+		{
+			Gestures.Enqueue(Displacement.X > 0.0 ? FSonyGamepadKeyNames::TouchSwipeRight : FSonyGamepadKeyNames::TouchSwipeLeft);
+		}
+		else
+		{
+			Gestures.Enqueue(Displacement.Y > 0.0 ? FSonyGamepadKeyNames::TouchSwipeDown : FSonyGamepadKeyNames::TouchSwipeUp);
+		}
+	}
+}
@@ -0,0 +1,460 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Output/HapticClip.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+
+namespace
+{
+	constexpr uint32 HeaderSize = 32;
+	constexpr uint32 SeekEntrySize = 8;
+	constexpr uint8 KeyFrameFlag = 0x80;
+
+	void WriteU8(TArray<uint8>& Out, const uint8 Value)
+	{
+		Out.Add(Value);
+	}
+
+	void WriteU16(TArray<uint8>& Out, const uint16 Value)
+	{
+		Out.Add(static_cast<uint8>(Value));
+		Out.Add(static_cast<uint8>(Value >> 8));
+	}
+
+	void WriteU32(TArray<uint8>& Out, const uint32 Value)
+	{
+		for (int32 Shift = 0; Shift < 32; Shift += 8)
+		{
+			Out.Add(static_cast<uint8>(Value >> Shift));
+		}
+	}
+
+	void PatchU32(TArray<uint8>& Out, const int32 At, const uint32 Value)
+	{
+		for (int32 Byte = 0; Byte < 4; ++Byte)
+		{
+			Out[At + Byte] = static_cast<uint8>(Value >> (8 * Byte));
+		}
+	}
+
+	void WriteVarint(TArray<uint8>& Out, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(static_cast<uint8>(Value | 0x80));
+			Value >>= 7;
+		}
+		Out.Add(static_cast<uint8>(Value));
+	}
+
+	void WriteDelta(TArray<uint8>& Out, const uint8 Previous, const uint8 Value)
+	{
+		const int32 Delta = static_cast<int32>(Value) - static_cast<int32>(Previous);
+		WriteVarint(Out, static_cast<uint32>((Delta << 1) ^ (Delta >> 31)));
+	}
+
+	void WriteTrigger(TArray<uint8>& Out, const FHapticTriggers& Trigger)
+	{
+		WriteU8(Out, Trigger.Mode);
+		WriteU8(Out, Trigger.Frequency);
+		WriteU8(Out, Trigger.Amplitude);
+		WriteU8(Out, Trigger.Strengths.Period);
+		WriteVarint(Out, Trigger.Strengths.ActiveZones);
+		WriteVarint(Out, Trigger.Strengths.TimeAndRatio);
+		WriteVarint(Out, Trigger.Strengths.StrengthZones);
+	}
+
+	bool IsSameTrigger(const FHapticTriggers& A, const FHapticTriggers& B)
+	{
+		return A.Mode == B.Mode && A.Frequency == B.Frequency && A.Amplitude == B.Amplitude &&
+			A.Strengths.Period == B.Strengths.Period && A.Strengths.ActiveZones == B.Strengths.ActiveZones &&
+			A.Strengths.TimeAndRatio == B.Strengths.TimeAndRatio && A.Strengths.StrengthZones == B.Strengths.StrengthZones;
+	}
+
+	/**
+	 * Bounds-checked reader over the clip data; any read past the end fails the whole frame.
+	 */
+	struct FByteReader
+	{
+		const uint8* Data;
+		uint32 End;
+		uint32 Offset;
+
+		bool ReadU8(uint8& Out)
+		{
+			if (Offset >= End)
+			{
+				return false;
+			}
+			Out = Data[Offset++];
+			return true;
+		}
+
+		bool ReadVarint(uint64& Out)
+		{
+			Out = 0;
+			for (int32 Shift = 0; Shift < 64; Shift += 7)
+			{
+				uint8 Byte;
+				if (!ReadU8(Byte))
+				{
+					return false;
+				}
+				Out |= static_cast<uint64>(Byte & 0x7F) << Shift;
+				if ((Byte & 0x80) == 0)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool ReadDelta(unsigned char& InOutValue)
+		{
+			uint64 Encoded;
+			if (!ReadVarint(Encoded))
+			{
+				return false;
+			}
+			const int32 Delta = static_cast<int32>(Encoded >> 1) ^ -static_cast<int32>(Encoded & 1);
+			InOutValue = static_cast<unsigned char>(static_cast<int32>(InOutValue) + Delta);
+			return true;
+		}
+
+		bool ReadTrigger(FHapticTriggers& Out)
+		{
+			uint64 ActiveZones, TimeAndRatio, StrengthZones;
+			if (!ReadU8(Out.Mode) || !ReadU8(Out.Frequency) || !ReadU8(Out.Amplitude) || !ReadU8(Out.Strengths.Period) ||
+				!ReadVarint(ActiveZones) || !ReadVarint(TimeAndRatio) || !ReadVarint(StrengthZones))
+			{
+				return false;
+			}
+			Out.Strengths.ActiveZones = static_cast<uint32>(ActiveZones);
+			Out.Strengths.TimeAndRatio = static_cast<uint32>(TimeAndRatio);
+			Out.Strengths.StrengthZones = StrengthZones;
+			return true;
+		}
+	};
+
+	uint32 ReadU32(const uint8* Data)
+	{
+		return Data[0] | (Data[1] << 8) | (Data[2] << 16) | (static_cast<uint32>(Data[3]) << 24);
+	}
+
+	uint8 LerpByte(const uint8 A, const uint8 B, const float Alpha)
+	{
+		return static_cast<uint8>(FMath::RoundToInt(FMath::Lerp(static_cast<float>(A), static_cast<float>(B), Alpha)));
+	}
+}
+
+FHapticClip::~FHapticClip()
+{
+	delete MappedRegion;
+	delete MappedFile;
+}
+
+TSharedPtr<const FHapticClip> FHapticClip::Open(const FString& Filename)
+{
+	IMappedFileHandle* MappedFile = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename);
+	if (!MappedFile)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HapticClip: Failed to map %s."), *Filename);
+		return nullptr;
+	}
+
+	TSharedRef<FHapticClip> Clip = MakeShareable(new FHapticClip());
+	Clip->MappedFile = MappedFile;
+	Clip->MappedRegion = MappedFile->MapRegion(0, MappedFile->GetFileSize());
+	if (!Clip->MappedRegion || !Clip->Initialize(Clip->MappedRegion->GetMappedPtr(), Clip->MappedRegion->GetMappedSize()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HapticClip: %s is not a valid haptic clip."), *Filename);
+		return nullptr;
+	}
+	return Clip;
+}
+
+TSharedPtr<const FHapticClip> FHapticClip::FromMemory(TArray<uint8>&& Data)
+{
+	TSharedRef<FHapticClip> Clip = MakeShareable(new FHapticClip());
+	Clip->Memory = MoveTemp(Data);
+	if (!Clip->Initialize(Clip->Memory.GetData(), Clip->Memory.Num()))
+	{
+		return nullptr;
+	}
+	return Clip;
+}
+
+bool FHapticClip::Initialize(const uint8* InData, const int64 InSize)
+{
+	if (!InData || InSize < HeaderSize || InSize > MAX_uint32 || ReadU32(InData) != SONY_GAMEPAD_HAPTIC_CLIP_MAGIC)
+	{
+		return false;
+	}
+
+	const uint16 Version = static_cast<uint16>(InData[4] | (InData[5] << 8));
+	if (Version == 0 || Version > SONY_GAMEPAD_HAPTIC_CLIP_VERSION)
+	{
+		return false;
+	}
+
+	Data = InData;
+	Size = InSize;
+	Channels = static_cast<EHapticClipChannel>(InData[6]) & EHapticClipChannel::All;
+	DurationMs = ReadU32(InData + 8);
+	FrameCount = ReadU32(InData + 12);
+	SeekCount = ReadU32(InData + 16);
+	SeekTableOffset = ReadU32(InData + 20);
+	FramesOffset = ReadU32(InData + 24);
+	FramesEnd = FramesOffset + ReadU32(InData + 28);
+
+	const bool bFramesValid = FramesOffset >= HeaderSize && FramesOffset <= FramesEnd && FramesEnd <= Size;
+	const bool bSeekTableValid = SeekTableOffset >= HeaderSize && static_cast<uint64>(SeekTableOffset) + static_cast<uint64>(SeekCount) * SeekEntrySize <= static_cast<uint64>(Size);
+	if (!bFramesValid || !bSeekTableValid || (FrameCount > 0 && SeekCount == 0))
+	{
+		return false;
+	}
+
+	for (uint32 Index = 0; Index < SeekCount; ++Index)
+	{
+		const uint32 Offset = ReadU32(Data + SeekTableOffset + Index * SeekEntrySize + 4);
+		if (Offset < FramesOffset || Offset >= FramesEnd)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32 FHapticClip::FindKeyFrame(const uint32 TimeMs) const
+{
+	// Last entry at or before the time; the first one when the time is before the first frame.
+	uint32 Low = 0;
+	uint32 High = SeekCount;
+	while (High - Low > 1)
+	{
+		const uint32 Middle = (Low + High) / 2;
+		if (ReadU32(Data + SeekTableOffset + Middle * SeekEntrySize) <= TimeMs)
+		{
+			Low = Middle;
+		}
+		else
+		{
+			High = Middle;
+		}
+	}
+	return ReadU32(Data + SeekTableOffset + Low * SeekEntrySize + 4);
+}
+
+void FHapticClip::Encode(const TArray<FHapticClipFrame>& Frames, const EHapticClipChannel Channels, uint32 DurationMs, TArray<uint8>& OutData)
+{
+	OutData.Reset();
+	WriteU32(OutData, SONY_GAMEPAD_HAPTIC_CLIP_MAGIC);
+	WriteU16(OutData, SONY_GAMEPAD_HAPTIC_CLIP_VERSION);
+	WriteU8(OutData, static_cast<uint8>(Channels & EHapticClipChannel::All));
+	WriteU8(OutData, 0);
+	if (Frames.Num() > 0)
+	{
+		DurationMs = FMath::Max(DurationMs, Frames.Last().TimeMs);
+	}
+	WriteU32(OutData, DurationMs);
+	WriteU32(OutData, Frames.Num());
+	// Seek count, seek table offset, frames offset and frames size, patched below.
+	const int32 Patch = OutData.Num();
+	WriteU32(OutData, 0);
+	WriteU32(OutData, 0);
+	WriteU32(OutData, 0);
+	WriteU32(OutData, 0);
+
+	TArray<TPair<uint32, uint32>> SeekTable;
+	// Key frames are coded against a zero frame, so they decode on their own after a seek.
+	const FHapticClipFrame Zero;
+	const uint32 FramesOffset = OutData.Num();
+	const FHapticClipFrame* Previous = nullptr;
+	for (int32 Index = 0; Index < Frames.Num(); ++Index)
+	{
+		const FHapticClipFrame& Frame = Frames[Index];
+		const bool bKeyFrame = Index % SONY_GAMEPAD_HAPTIC_CLIP_KEY_INTERVAL == 0;
+		uint8 Mask = 0;
+		if (bKeyFrame)
+		{
+			Mask = static_cast<uint8>(Channels & EHapticClipChannel::All) | KeyFrameFlag;
+			SeekTable.Emplace(Frame.TimeMs, OutData.Num());
+		}
+		else
+		{
+			if (EnumHasAnyFlags(Channels, EHapticClipChannel::Rumble) &&
+				(Frame.Rumbles.Left != Previous->Rumbles.Left || Frame.Rumbles.Right != Previous->Rumbles.Right))
+			{
+				Mask |= static_cast<uint8>(EHapticClipChannel::Rumble);
+			}
+			if (EnumHasAnyFlags(Channels, EHapticClipChannel::Lightbar) &&
+				(Frame.Lightbar.R != Previous->Lightbar.R || Frame.Lightbar.G != Previous->Lightbar.G || Frame.Lightbar.B != Previous->Lightbar.B))
+			{
+				Mask |= static_cast<uint8>(EHapticClipChannel::Lightbar);
+			}
+			if (EnumHasAnyFlags(Channels, EHapticClipChannel::LeftTrigger) && !IsSameTrigger(Frame.LeftTrigger, Previous->LeftTrigger))
+			{
+				Mask |= static_cast<uint8>(EHapticClipChannel::LeftTrigger);
+			}
+			if (EnumHasAnyFlags(Channels, EHapticClipChannel::RightTrigger) && !IsSameTrigger(Frame.RightTrigger, Previous->RightTrigger))
+			{
+				Mask |= static_cast<uint8>(EHapticClipChannel::RightTrigger);
+			}
+		}
+
+		const FHapticClipFrame& Base = bKeyFrame ? Zero : *Previous;
+		WriteU8(OutData, Mask);
+		WriteVarint(OutData, bKeyFrame ? Frame.TimeMs : Frame.TimeMs - FMath::Min(Frame.TimeMs, Base.TimeMs));
+		if (Mask & static_cast<uint8>(EHapticClipChannel::Rumble))
+		{
+			WriteDelta(OutData, Base.Rumbles.Left, Frame.Rumbles.Left);
+			WriteDelta(OutData, Base.Rumbles.Right, Frame.Rumbles.Right);
+		}
+		if (Mask & static_cast<uint8>(EHapticClipChannel::Lightbar))
+		{
+			WriteDelta(OutData, Base.Lightbar.R, Frame.Lightbar.R);
+			WriteDelta(OutData, Base.Lightbar.G, Frame.Lightbar.G);
+			WriteDelta(OutData, Base.Lightbar.B, Frame.Lightbar.B);
+		}
+		if (Mask & static_cast<uint8>(EHapticClipChannel::LeftTrigger))
+		{
+			WriteTrigger(OutData, Frame.LeftTrigger);
+		}
+		if (Mask & static_cast<uint8>(EHapticClipChannel::RightTrigger))
+		{
+			WriteTrigger(OutData, Frame.RightTrigger);
+		}
+		Previous = &Frame;
+	}
+
+	const uint32 FramesSize = OutData.Num() - FramesOffset;
+	const uint32 SeekTableOffset = OutData.Num();
+	for (const TPair<uint32, uint32>& Entry : SeekTable)
+	{
+		WriteU32(OutData, Entry.Key);
+		WriteU32(OutData, Entry.Value);
+	}
+
+	PatchU32(OutData, Patch, SeekTable.Num());
+	PatchU32(OutData, Patch + 4, SeekTableOffset);
+	PatchU32(OutData, Patch + 8, FramesOffset);
+	PatchU32(OutData, Patch + 12, FramesSize);
+}
+
+FHapticClipReader::FHapticClipReader(const TSharedRef<const FHapticClip>& InClip)
+	: Clip(InClip)
+{
+}
+
+bool FHapticClipReader::Sample(const double TimeMs, FHapticClipFrame& OutFrame)
+{
+	if (Clip->FrameCount == 0)
+	{
+		OutFrame = FHapticClipFrame();
+		return true;
+	}
+
+	const uint32 Time = static_cast<uint32>(FMath::Clamp(TimeMs, 0.0, static_cast<double>(MAX_uint32)));
+	if (!bPositioned || Time < Previous.TimeMs)
+	{
+		if (!Seek(Time))
+		{
+			return false;
+		}
+	}
+
+	while (bHasNext && Next.TimeMs <= Time)
+	{
+		Previous = Next;
+		bHasNext = Offset < Clip->FramesEnd;
+		if (bHasNext && !ReadFrame(Next))
+		{
+			return false;
+		}
+	}
+
+	OutFrame = Previous;
+	OutFrame.TimeMs = Time;
+	if (bHasNext && Next.TimeMs > Previous.TimeMs && Time > Previous.TimeMs)
+	{
+		const float Alpha = static_cast<float>((TimeMs - Previous.TimeMs) / (Next.TimeMs - Previous.TimeMs));
+		OutFrame.Rumbles.Left = LerpByte(Previous.Rumbles.Left, Next.Rumbles.Left, Alpha);
+		OutFrame.Rumbles.Right = LerpByte(Previous.Rumbles.Right, Next.Rumbles.Right, Alpha);
+		OutFrame.Lightbar.R = LerpByte(Previous.Lightbar.R, Next.Lightbar.R, Alpha);
+		OutFrame.Lightbar.G = LerpByte(Previous.Lightbar.G, Next.Lightbar.G, Alpha);
+		OutFrame.Lightbar.B = LerpByte(Previous.Lightbar.B, Next.Lightbar.B, Alpha);
+	}
+	return true;
+}
+
+bool FHapticClipReader::Seek(const uint32 TimeMs)
+{
+	bPositioned = false;
+	Offset = Clip->FindKeyFrame(TimeMs);
+	if (!ReadFrame(Previous))
+	{
+		return false;
+	}
+
+	bHasNext = Offset < Clip->FramesEnd;
+	if (bHasNext)
+	{
+		Next = Previous;
+		if (!ReadFrame(Next))
+		{
+			return false;
+		}
+	}
+	bPositioned = true;
+	return true;
+}
+
+bool FHapticClipReader::ReadFrame(FHapticClipFrame& InOutFrame)
+{
+	FByteReader Reader{Clip->Data, Clip->FramesEnd, Offset};
+	uint8 Mask;
+	uint64 Time;
+	if (!Reader.ReadU8(Mask) || !Reader.ReadVarint(Time))
+	{
+		return false;
+	}
+
+	if (Mask & KeyFrameFlag)
+	{
+		InOutFrame = FHapticClipFrame();
+		InOutFrame.TimeMs = static_cast<uint32>(Time);
+	}
+	else
+	{
+		InOutFrame.TimeMs += static_cast<uint32>(Time);
+	}
+
+	bool bValid = true;
+	if (Mask & static_cast<uint8>(EHapticClipChannel::Rumble))
+	{
+		bValid &= Reader.ReadDelta(InOutFrame.Rumbles.Left) && Reader.ReadDelta(InOutFrame.Rumbles.Right);
+	}
+	if (Mask & static_cast<uint8>(EHapticClipChannel::Lightbar))
+	{
+		bValid &= Reader.ReadDelta(InOutFrame.Lightbar.R) && Reader.ReadDelta(InOutFrame.Lightbar.G) && Reader.ReadDelta(InOutFrame.Lightbar.B);
+	}
+	if (Mask & static_cast<uint8>(EHapticClipChannel::LeftTrigger))
+	{
+		bValid &= Reader.ReadTrigger(InOutFrame.LeftTrigger);
+	}
+	if (Mask & static_cast<uint8>(EHapticClipChannel::RightTrigger))
+	{
+		bValid &= Reader.ReadTrigger(InOutFrame.RightTrigger);
+	}
+	if (!bValid)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HapticClip: Corrupt frame at offset %u."), Offset);
+		return false;
+	}
+
+	Offset = Reader.Offset;
+	return true;
+}
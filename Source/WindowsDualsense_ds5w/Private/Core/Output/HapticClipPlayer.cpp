@@ -0,0 +1,194 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Output/HapticClipPlayer.h"
+
+#include "Core/Output/RumbleSequencer.h"
+
+namespace
+{
+	unsigned char BlendByte(const unsigned char From, const unsigned char To, const float Weight)
+	{
+		return static_cast<unsigned char>(FMath::RoundToInt(FMath::Lerp(static_cast<float>(From), static_cast<float>(To), Weight)));
+	}
+}
+
+void FHapticClipPlayer::Play(const FHapticClipPlayback& Playback)
+{
+	FRequest Request;
+	Request.Type = ERequest::Play;
+	Request.Playback = Playback;
+	Request.Time = FPlatformTime::Seconds();
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+void FHapticClipPlayer::Stop(const float FadeOut)
+{
+	FRequest Request;
+	Request.Type = ERequest::Stop;
+	Request.Time = FPlatformTime::Seconds();
+	Request.Value = FMath::Max(FadeOut, 0.0f);
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+void FHapticClipPlayer::Seek(const double Position)
+{
+	FRequest Request;
+	Request.Type = ERequest::Seek;
+	Request.Time = FPlatformTime::Seconds();
+	Request.Value = FMath::Max(Position, 0.0);
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+bool FHapticClipPlayer::Evaluate(const double Now, FOutputContext& InOutOutput, FRumbles& OutRumbles, double& OutNextTime)
+{
+	FRequest Request;
+	while (Requests.Dequeue(Request))
+	{
+		switch (Request.Type)
+		{
+		case ERequest::Play:
+			if (!Request.Playback.Clip.IsValid())
+			{
+				break;
+			}
+			if (Current.IsActive() && Request.Playback.CrossFade > 0.0f)
+			{
+				Fading = MoveTemp(Current);
+				Fading.FadeOutStart = Request.Playback.StartTime;
+				Fading.FadeOutTime = Request.Playback.CrossFade;
+			}
+			else
+			{
+				Fading = FVoice();
+			}
+			Current = FVoice();
+			Current.Playback = MoveTemp(Request.Playback);
+			Current.Reader = MakeUnique<FHapticClipReader>(Current.Playback.Clip.ToSharedRef());
+			break;
+		case ERequest::Stop:
+			if (Current.IsActive() && Request.Value > 0.0)
+			{
+				Fading = MoveTemp(Current);
+				Fading.FadeOutStart = Request.Time;
+				Fading.FadeOutTime = Request.Value;
+			}
+			Current = FVoice();
+			break;
+		case ERequest::Seek:
+			if (Current.IsActive())
+			{
+				Current.Playback.StartPosition = Request.Value;
+				Current.Playback.StartTime = Request.Time;
+				// Already faded in, a seek is not a new start.
+				Current.Playback.CrossFade = 0.0f;
+			}
+			break;
+		}
+	}
+
+	float Left = 0.0f;
+	float Right = 0.0f;
+	bool bSounding = false;
+	double NextStart = TNumericLimits<double>::Max();
+	// The fading clip first, so the current one blends over it.
+	for (FVoice* Voice : {&Fading, &Current})
+	{
+		if (!Voice->IsActive())
+		{
+			continue;
+		}
+		if (Now < Voice->Playback.StartTime)
+		{
+			NextStart = FMath::Min(NextStart, Voice->Playback.StartTime);
+			continue;
+		}
+
+		FHapticClipFrame Frame;
+		if (!SampleVoice(*Voice, Now, Frame))
+		{
+			*Voice = FVoice();
+			continue;
+		}
+
+		bSounding = true;
+		const float Weight = GetWeight(*Voice, Now);
+		const EHapticClipChannel Channels = Voice->Reader->GetClip().GetChannels();
+		// On the channels the current clip also drives, the fading clip goes in at full weight and the
+		// current clip fades in over it, so the fade is not applied twice. Its own fade out only shows
+		// on the channels nothing replaces, e.g. after a Stop.
+		const EHapticClipChannel Replaced = Voice == &Fading && Current.IsActive() ? Current.Reader->GetClip().GetChannels() : EHapticClipChannel::None;
+		auto GetChannelWeight = [Weight, Replaced](const EHapticClipChannel Channel)
+		{
+			return EnumHasAnyFlags(Replaced, Channel) ? 1.0f : Weight;
+		};
+		if (EnumHasAnyFlags(Channels, EHapticClipChannel::Rumble))
+		{
+			const float RumbleWeight = GetChannelWeight(EHapticClipChannel::Rumble);
+			Left = FMath::Lerp(Left, static_cast<float>(Frame.Rumbles.Left), RumbleWeight);
+			Right = FMath::Lerp(Right, static_cast<float>(Frame.Rumbles.Right), RumbleWeight);
+		}
+		if (EnumHasAnyFlags(Channels, EHapticClipChannel::Lightbar))
+		{
+			const float LightbarWeight = GetChannelWeight(EHapticClipChannel::Lightbar);
+			InOutOutput.Lightbar.R = BlendByte(InOutOutput.Lightbar.R, Frame.Lightbar.R, LightbarWeight);
+			InOutOutput.Lightbar.G = BlendByte(InOutOutput.Lightbar.G, Frame.Lightbar.G, LightbarWeight);
+			InOutOutput.Lightbar.B = BlendByte(InOutOutput.Lightbar.B, Frame.Lightbar.B, LightbarWeight);
+		}
+		// Trigger effects can not be blended, the clip with the most weight drives them.
+		if (GetChannelWeight(EHapticClipChannel::LeftTrigger) >= 0.5f && EnumHasAnyFlags(Channels, EHapticClipChannel::LeftTrigger))
+		{
+			InOutOutput.LeftTrigger = Frame.LeftTrigger;
+		}
+		if (GetChannelWeight(EHapticClipChannel::RightTrigger) >= 0.5f && EnumHasAnyFlags(Channels, EHapticClipChannel::RightTrigger))
+		{
+			InOutOutput.RightTrigger = Frame.RightTrigger;
+		}
+	}
+
+	OutRumbles.Left = static_cast<unsigned char>(FMath::RoundToInt(Left));
+	OutRumbles.Right = static_cast<unsigned char>(FMath::RoundToInt(Right));
+
+	const double NextSample = (FMath::FloorToDouble(Now * SONY_GAMEPAD_RUMBLE_SAMPLE_RATE) + 1.0) / SONY_GAMEPAD_RUMBLE_SAMPLE_RATE;
+	OutNextTime = bSounding ? FMath::Min(NextSample, NextStart) : NextStart;
+	return Current.IsActive() || Fading.IsActive();
+}
+
+void FHapticClipPlayer::Reset()
+{
+	Requests.Empty();
+	Current = FVoice();
+	Fading = FVoice();
+}
+
+float FHapticClipPlayer::GetWeight(const FVoice& Voice, const double Now)
+{
+	const double Elapsed = Now - Voice.Playback.StartTime;
+	double Weight = Voice.Playback.CrossFade > 0.0f ? FMath::Clamp(Elapsed / Voice.Playback.CrossFade, 0.0, 1.0) : 1.0;
+	if (Voice.FadeOutStart >= 0.0)
+	{
+		Weight *= Voice.FadeOutTime > 0.0 ? FMath::Clamp(1.0 - (Now - Voice.FadeOutStart) / Voice.FadeOutTime, 0.0, 1.0) : 0.0;
+	}
+	return static_cast<float>(Weight);
+}
+
+bool FHapticClipPlayer::SampleVoice(FVoice& Voice, const double Now, FHapticClipFrame& OutFrame)
+{
+	if (Voice.FadeOutStart >= 0.0 && Now >= Voice.FadeOutStart + Voice.FadeOutTime)
+	{
+		return false;
+	}
+
+	const double Duration = Voice.Reader->GetClip().GetDurationMs() / 1000.0;
+	double Position = Voice.Playback.StartPosition + (Now - Voice.Playback.StartTime);
+	if (Position >= Duration)
+	{
+		if (!Voice.Playback.bLoop || Duration <= 0.0)
+		{
+			return false;
+		}
+		Position = FMath::Fmod(Position, Duration);
+	}
+	return Voice.Reader->Sample(Position * 1000.0, OutFrame);
+}
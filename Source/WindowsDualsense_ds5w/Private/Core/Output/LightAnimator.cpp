@@ -0,0 +1,313 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Output/LightAnimator.h"
+
+#include "Core/Output/RumbleSequencer.h"
+
+namespace
+{
+	/**
+	 * Number of player LEDs, from PLAYER_LED_LEFT (bit 0) to PLAYER_LED_RIGHT (bit 4).
+	 */
+	constexpr int32 PlayerLedCount = 5;
+
+	unsigned char LerpByte(const unsigned char From, const unsigned char To, const float Alpha)
+	{
+		return static_cast<unsigned char>(FMath::RoundToInt(FMath::Lerp(static_cast<float>(From), static_cast<float>(To), Alpha)));
+	}
+
+	FColor LerpColor(const FColor& From, const FColor& To, const float Alpha)
+	{
+		return FColor(LerpByte(From.R, To.R, Alpha), LerpByte(From.G, To.G, Alpha), LerpByte(From.B, To.B, Alpha));
+	}
+
+	float Ease(const ESonyGamepadLightEasing Easing, const float Alpha)
+	{
+		switch (Easing)
+		{
+		case ESonyGamepadLightEasing::EaseIn:
+			return Alpha * Alpha;
+		case ESonyGamepadLightEasing::EaseOut:
+			return 1.0f - (1.0f - Alpha) * (1.0f - Alpha);
+		case ESonyGamepadLightEasing::EaseInOut:
+			return Alpha * Alpha * (3.0f - 2.0f * Alpha);
+		case ESonyGamepadLightEasing::Step:
+			return 0.0f;
+		default:
+			return Alpha;
+		}
+	}
+
+	int32 GetPatternSteps(const ESonyGamepadPlayerLedPattern Pattern)
+	{
+		switch (Pattern)
+		{
+		case ESonyGamepadPlayerLedPattern::Chase:
+			return PlayerLedCount;
+		case ESonyGamepadPlayerLedPattern::Bounce:
+			return 2 * (PlayerLedCount - 1);
+		case ESonyGamepadPlayerLedPattern::Fill:
+			return PlayerLedCount + 1;
+		default:
+			return 2;
+		}
+	}
+}
+
+void FLightAnimator::PlayLightbar(const FSonyGamepadLightbarAnimation& Animation, const double StartTime)
+{
+	FRequest Request;
+	Request.Type = ERequest::PlayLightbar;
+	Request.Lightbar = Animation;
+	// Sorted here, so the output thread does not.
+	Request.Lightbar.Keys.StableSort([](const FSonyGamepadLightbarKey& A, const FSonyGamepadLightbarKey& B) { return A.Time < B.Time; });
+	Request.Time = StartTime;
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+void FLightAnimator::StopLightbar()
+{
+	FRequest Request;
+	Request.Type = ERequest::StopLightbar;
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+void FLightAnimator::SetLightbarValue(const float Value)
+{
+	FRequest Request;
+	Request.Type = ERequest::SetLightbarValue;
+	Request.Time = FPlatformTime::Seconds();
+	Request.Value = Value;
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+void FLightAnimator::PlayPlayerLed(const FSonyGamepadPlayerLedAnimation& Animation, const double StartTime)
+{
+	FRequest Request;
+	Request.Type = ERequest::PlayPlayerLed;
+	Request.PlayerLed = Animation;
+	Request.Time = StartTime;
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+void FLightAnimator::StopPlayerLed()
+{
+	FRequest Request;
+	Request.Type = ERequest::StopPlayerLed;
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+bool FLightAnimator::Evaluate(const double Now, FOutputContext& InOutOutput, double& OutNextTime, bool& bOutChanged)
+{
+	FRequest Request;
+	while (Requests.Dequeue(Request))
+	{
+		switch (Request.Type)
+		{
+		case ERequest::PlayLightbar:
+			Lightbar = MoveTemp(Request.Lightbar);
+			LightbarStart = Request.Time;
+			bLightbarActive = true;
+			break;
+		case ERequest::StopLightbar:
+			bLightbarActive = false;
+			break;
+		case ERequest::SetLightbarValue:
+			ValueFrom = GetLightbarValue(Request.Time);
+			ValueTo = Request.Value;
+			ValueTime = Request.Time;
+			break;
+		case ERequest::PlayPlayerLed:
+			PlayerLed = Request.PlayerLed;
+			PlayerLedStart = Request.Time;
+			bPlayerLedActive = true;
+			break;
+		case ERequest::StopPlayerLed:
+			bPlayerLedActive = false;
+			break;
+		}
+	}
+
+	double NextLightbar = TNumericLimits<double>::Max();
+	double NextPlayerLed = TNumericLimits<double>::Max();
+	const bool bLightbar = bLightbarActive && EvaluateLightbar(Now, InOutOutput.Lightbar, NextLightbar);
+	const bool bPlayerLed = bPlayerLedActive && EvaluatePlayerLed(Now, InOutOutput.PlayerLed, NextPlayerLed);
+	bLightbarActive = bLightbar;
+	bPlayerLedActive = bPlayerLed;
+	OutNextTime = FMath::Min(NextLightbar, NextPlayerLed);
+
+	const FLightbar& Color = InOutOutput.Lightbar;
+	const FPlayerLed& Leds = InOutOutput.PlayerLed;
+	bOutChanged = Color.R != LastLightbar.R || Color.G != LastLightbar.G || Color.B != LastLightbar.B || Color.A != LastLightbar.A
+		|| Leds.Led != LastPlayerLed.Led || Leds.Brightness != LastPlayerLed.Brightness;
+	LastLightbar = Color;
+	LastPlayerLed = Leds;
+	return bLightbar || bPlayerLed;
+}
+
+void FLightAnimator::Reset()
+{
+	Requests.Empty();
+	bLightbarActive = false;
+	bPlayerLedActive = false;
+	ValueFrom = 1.0f;
+	ValueTo = 1.0f;
+	ValueTime = 0.0;
+	LastLightbar = FLightbar();
+	LastPlayerLed = FPlayerLed();
+}
+
+bool FLightAnimator::EvaluateLightbar(const double Now, FLightbar& InOutLightbar, double& OutNextTime)
+{
+	if (Now < LightbarStart)
+	{
+		OutNextTime = LightbarStart;
+		return true;
+	}
+
+	const double Elapsed = Now - LightbarStart;
+	if ((Lightbar.Duration > 0.0f && Elapsed >= Lightbar.Duration) || (Lightbar.Mode == ESonyGamepadLightbarMode::Gradient && Lightbar.Keys.Num() == 0))
+	{
+		return false;
+	}
+
+	// The color only needs to be computed as often as the update rate, on a grid anchored at the start.
+	const double Step = 1.0 / FMath::Clamp<double>(Lightbar.UpdateRate, 1.0, SONY_GAMEPAD_RUMBLE_SAMPLE_RATE);
+	double Next = LightbarStart + (FMath::FloorToDouble(Elapsed / Step) + 1.0) * Step;
+	const double Period = FMath::Max(Lightbar.Period, 0.01f);
+	const double Phase = FMath::Fmod(Elapsed, Period);
+	FColor Color = FColor::Black;
+	switch (Lightbar.Mode)
+	{
+	case ESonyGamepadLightbarMode::Gradient:
+		{
+			float Position;
+			if (Lightbar.bDrivenByValue)
+			{
+				Position = GetLightbarValue(Now);
+				if (Now >= ValueTime + Lightbar.ValueBlendTime)
+				{
+					// Holds until a new value is set, which wakes the thread.
+					Next = TNumericLimits<double>::Max();
+				}
+			}
+			else
+			{
+				const float Last = Lightbar.Keys.Last().Time;
+				Position = static_cast<float>(Elapsed);
+				if (Lightbar.bLoop && Last > 0.0f)
+				{
+					Position = FMath::Fmod(Position, Last);
+				}
+				else if (Position >= Last)
+				{
+					Next = TNumericLimits<double>::Max();
+				}
+			}
+			Color = SampleGradient(Lightbar.Keys, Position);
+		}
+		break;
+	case ESonyGamepadLightbarMode::Pulse:
+		{
+			const double OnTime = Period * FMath::Clamp(Lightbar.DutyCycle, 0.0f, 1.0f);
+			const bool bOn = Phase < OnTime;
+			Color = bOn ? Lightbar.Color : Lightbar.SecondColor;
+			// Switches at the exact edge rather than on the grid.
+			Next = Now - Phase + (bOn ? OnTime : Period);
+		}
+		break;
+	case ESonyGamepadLightbarMode::Breathe:
+		{
+			const float Alpha = 0.5f - 0.5f * FMath::Cos(static_cast<float>(2.0 * PI * Phase / Period));
+			Color = LerpColor(Lightbar.SecondColor, Lightbar.Color, Alpha);
+		}
+		break;
+	case ESonyGamepadLightbarMode::Rainbow:
+		{
+			const FLinearColor Hsv(static_cast<float>(360.0 * Phase / Period), FMath::Clamp(Lightbar.Saturation, 0.0f, 1.0f), FMath::Clamp(Lightbar.Brightness, 0.0f, 1.0f));
+			Color = Hsv.HSVToLinearRGB().ToFColor(false);
+		}
+		break;
+	}
+
+	InOutLightbar.R = Color.R;
+	InOutLightbar.G = Color.G;
+	InOutLightbar.B = Color.B;
+	OutNextTime = Lightbar.Duration > 0.0f ? FMath::Min(Next, LightbarStart + Lightbar.Duration) : Next;
+	return true;
+}
+
+bool FLightAnimator::EvaluatePlayerLed(const double Now, FPlayerLed& InOutPlayerLed, double& OutNextTime)
+{
+	if (Now < PlayerLedStart)
+	{
+		OutNextTime = PlayerLedStart;
+		return true;
+	}
+
+	const double Elapsed = Now - PlayerLedStart;
+	if (PlayerLed.Duration > 0.0f && Elapsed >= PlayerLed.Duration)
+	{
+		return false;
+	}
+
+	const int32 Steps = GetPatternSteps(PlayerLed.Pattern);
+	const double StepTime = FMath::Max(PlayerLed.Period, 0.01f) / Steps;
+	const double Index = FMath::FloorToDouble(Elapsed / StepTime);
+	const int32 Step = static_cast<int32>(FMath::Fmod(Index, static_cast<double>(Steps)));
+	unsigned char Led;
+	switch (PlayerLed.Pattern)
+	{
+	case ESonyGamepadPlayerLedPattern::Chase:
+		Led = static_cast<unsigned char>(1 << Step);
+		break;
+	case ESonyGamepadPlayerLedPattern::Bounce:
+		Led = static_cast<unsigned char>(1 << (Step < PlayerLedCount ? Step : Steps - Step));
+		break;
+	case ESonyGamepadPlayerLedPattern::Fill:
+		Led = static_cast<unsigned char>((1 << Step) - 1);
+		break;
+	default:
+		Led = Step == 0 ? static_cast<unsigned char>(PlayerLed.Led) : 0;
+		break;
+	}
+
+	InOutPlayerLed.Led = Led;
+	InOutPlayerLed.Brightness = static_cast<unsigned char>(PlayerLed.Brightness);
+	const double Next = PlayerLedStart + (Index + 1.0) * StepTime;
+	OutNextTime = PlayerLed.Duration > 0.0f ? FMath::Min(Next, PlayerLedStart + PlayerLed.Duration) : Next;
+	return true;
+}
+
+float FLightAnimator::GetLightbarValue(const double Now) const
+{
+	const double BlendTime = Lightbar.ValueBlendTime;
+	if (BlendTime <= 0.0 || Now >= ValueTime + BlendTime)
+	{
+		return ValueTo;
+	}
+	return FMath::Lerp(ValueFrom, ValueTo, static_cast<float>(FMath::Clamp((Now - ValueTime) / BlendTime, 0.0, 1.0)));
+}
+
+FColor FLightAnimator::SampleGradient(const TArray<FSonyGamepadLightbarKey>& Keys, const float Position)
+{
+	if (Position <= Keys[0].Time)
+	{
+		return Keys[0].Color;
+	}
+
+	for (int32 Index = 0; Index + 1 < Keys.Num(); ++Index)
+	{
+		const FSonyGamepadLightbarKey& Key = Keys[Index];
+		const FSonyGamepadLightbarKey& NextKey = Keys[Index + 1];
+		if (Position < NextKey.Time)
+		{
+			const float Span = NextKey.Time - Key.Time;
+			const float Alpha = Span > 0.0f ? (Position - Key.Time) / Span : 1.0f;
+			return LerpColor(Key.Color, NextKey.Color, Ease(Key.Easing, Alpha));
+		}
+	}
+	return Keys.Last().Color;
+}
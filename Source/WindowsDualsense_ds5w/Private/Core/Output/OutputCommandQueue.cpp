@@ -0,0 +1,146 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Output/OutputCommandQueue.h"
+
+#include "Core/Output/RumbleMixer.h"
+#include "Core/Output/TriggerEffects.h"
+#include "Core/Output/TriggerStack.h"
+
+void FOutputCommand::Apply(FOutputContext& Output) const
+{
+	switch (Type)
+	{
+	case EOutputCommand::Rumble:
+		Output.Rumbles = Rumbles;
+		break;
+	case EOutputCommand::Lightbar:
+		Output.Lightbar = Lightbar;
+		Output.FlashLigthbar = FlashLigthbar;
+		break;
+	case EOutputCommand::PlayerLed:
+		Output.PlayerLed = PlayerLed;
+		break;
+	case EOutputCommand::MicLed:
+		Output.MicLight = MicLight;
+		break;
+	case EOutputCommand::AudioVolume:
+		Output.Audio.HeadsetVolume = Audio.HeadsetVolume;
+		Output.Audio.SpeakerVolume = Audio.SpeakerVolume;
+		Output.Audio.MicVolume = Audio.MicVolume;
+		Output.Audio.MicStatus = Audio.MicStatus;
+		break;
+	case EOutputCommand::AudioMode:
+		Output.Audio.Mode = Audio.Mode;
+		break;
+	case EOutputCommand::VibrationMode:
+		Output.Feature.VibrationMode = Feature.VibrationMode;
+		break;
+	case EOutputCommand::FeatureMode:
+		Output.Feature.FeatureMode = Feature.FeatureMode;
+		break;
+	case EOutputCommand::Softness:
+		Output.Feature.SoftRumbleReduce = Feature.SoftRumbleReduce;
+		Output.Feature.TriggerSoftnessLevel = Feature.TriggerSoftnessLevel;
+		break;
+	case EOutputCommand::LeftTrigger:
+		Output.LeftTrigger = Trigger;
+		break;
+	case EOutputCommand::RightTrigger:
+		Output.RightTrigger = Trigger;
+		break;
+	case EOutputCommand::LeftTriggerFrequency:
+		FTriggerEffects::SetFrequency(Output.LeftTrigger, Trigger.Frequency);
+		break;
+	case EOutputCommand::RightTriggerFrequency:
+		FTriggerEffects::SetFrequency(Output.RightTrigger, Trigger.Frequency);
+		break;
+	default:
+		break;
+	}
+}
+
+uint64 FOutputCommandQueue::Enqueue(FOutputCommand Command)
+{
+	Command.Sequence = NextSequence.fetch_add(1, std::memory_order_relaxed);
+	Command.Timestamp = FPlatformTime::Seconds();
+	Commands.Enqueue(MoveTemp(Command));
+	return Command.Sequence;
+}
+
+int32 FOutputCommandQueue::Drain(FOutputContext& Output, FRumbleMixer& Mixer, FTriggerStack& Triggers, double& OutOldestTimestamp, bool& bOutBarrier,
+                                 bool& bOutFlush)
+{
+	int32 Count = 0;
+	bOutBarrier = false;
+	bOutFlush = false;
+
+	FOutputCommand Command;
+	while (Commands.Dequeue(Command))
+	{
+		if (Count == 0 || Command.Timestamp < OutOldestTimestamp)
+		{
+			OutOldestTimestamp = Command.Timestamp;
+		}
+		++Count;
+
+		// A producer that was preempted between stamping and queueing lands behind newer commands.
+		// Rumble sources and trigger layers are ordered apart, so one never drops the value of another.
+		uint64& LastApplied = Applied[GetSlot(Command)];
+		if (Command.Sequence > LastApplied)
+		{
+			LastApplied = Command.Sequence;
+			switch (Command.Type)
+			{
+			case EOutputCommand::Rumble:
+				Mixer.Set(Command.RumbleSource, Command.Rumbles);
+				break;
+			case EOutputCommand::LeftTrigger:
+			case EOutputCommand::RightTrigger:
+				Triggers.Set(Command.Type == EOutputCommand::RightTrigger, Command.TriggerLayer, Command.Trigger, Command.Timestamp);
+				break;
+			case EOutputCommand::LeftTriggerFrequency:
+			case EOutputCommand::RightTriggerFrequency:
+				Triggers.SetFrequency(Command.Type == EOutputCommand::RightTriggerFrequency, Command.TriggerLayer.Layer, Command.Trigger.Frequency);
+				break;
+			default:
+				Command.Apply(Output);
+				break;
+			}
+			bOutFlush |= Command.Type == EOutputCommand::Flush;
+		}
+
+		if (Command.bBarrier)
+		{
+			bOutBarrier = true;
+			break;
+		}
+	}
+	return Count;
+}
+
+void FOutputCommandQueue::Discard()
+{
+	Commands.Empty();
+}
+
+int32 FOutputCommandQueue::GetSlot(const FOutputCommand& Command)
+{
+	constexpr int32 Types = static_cast<int32>(EOutputCommand::Count);
+	constexpr int32 Sources = static_cast<int32>(ESonyGamepadRumbleSource::Count);
+	constexpr int32 Layers = static_cast<int32>(ESonyGamepadTriggerLayer::Count);
+	switch (Command.Type)
+	{
+	case EOutputCommand::Rumble:
+		return Types + FMath::Min(static_cast<int32>(Command.RumbleSource), Sources - 1);
+	case EOutputCommand::LeftTrigger:
+	case EOutputCommand::RightTrigger:
+	case EOutputCommand::LeftTriggerFrequency:
+	case EOutputCommand::RightTriggerFrequency:
+		return Types + Sources + (static_cast<int32>(Command.Type) - static_cast<int32>(EOutputCommand::LeftTrigger)) * Layers
+			+ FMath::Min(static_cast<int32>(Command.TriggerLayer.Layer), Layers - 1);
+	default:
+		return static_cast<int32>(Command.Type);
+	}
+}
@@ -0,0 +1,830 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Output/OutputScheduler.h"
+
+#include "HAL/Event.h"
+#include "HAL/RunnableThread.h"
+#include "Core/DeviceHIDManager.h"
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <windows.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+
+namespace
+{
+	/**
+	 * Longest the thread sleeps when nothing is pending. Submissions wake it earlier.
+	 */
+	constexpr uint32 IdleWaitMs = 100;
+
+	void MarkSection(ESonyOutputSection* ByteSections, const int32 First, const int32 Num, const ESonyOutputSection Section)
+	{
+		for (int32 Index = First; Index < First + Num && Index < SONY_GAMEPAD_MAX_OUTPUT_REPORT_SIZE; ++Index)
+		{
+			ByteSections[Index] = Section;
+		}
+	}
+
+	bool IsValidId(const int32 ControllerId)
+	{
+		return ControllerId >= 0 && ControllerId < SONY_GAMEPAD_MAX_STATE_SLOTS;
+	}
+}
+
+FOutputScheduler& FOutputScheduler::Get()
+{
+	static FOutputScheduler Scheduler;
+	return Scheduler;
+}
+
+FOutputScheduler::FOutputScheduler()
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	UsbBucket.Configure(Budget.Usb);
+	BluetoothBucket.Configure(Budget.Bluetooth);
+}
+
+FOutputScheduler::~FOutputScheduler()
+{
+	Shutdown();
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
+
+bool FOutputScheduler::Register(const int32 ControllerId, void* DeviceHandle, const EDeviceType DeviceType, const EDeviceConnection Connection,
+                                const FOutputContext& InitialOutput)
+{
+	if (!IsValidId(ControllerId) || !DeviceHandle || DeviceHandle == INVALID_HANDLE_VALUE || bStopping.load(std::memory_order_relaxed))
+	{
+		return false;
+	}
+
+	if (!Thread)
+	{
+		if (!FPlatformProcess::SupportsMultithreading())
+		{
+			return false;
+		}
+
+		Thread = FRunnableThread::Create(this, TEXT("SonyGamepadOutputScheduler"), 0, TPri_AboveNormal);
+		if (!Thread)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("OutputScheduler: thread unavailable, reports are written synchronously."));
+			return false;
+		}
+	}
+
+	// The scheduler owns its own handle, so the library can close or free its context at any time.
+	HANDLE Duplicate = nullptr;
+	if (!DuplicateHandle(GetCurrentProcess(), DeviceHandle, GetCurrentProcess(), &Duplicate, 0, false, DUPLICATE_SAME_ACCESS))
+	{
+		UE_LOG(LogTemp, Error, TEXT("OutputScheduler: Failed to duplicate the handle of controller %d. Error Code: %d"), ControllerId, GetLastError());
+		return false;
+	}
+
+	Unregister(ControllerId);
+
+	FScopeLock ScopeLock(&Lock);
+	FDevice& Device = Devices[ControllerId];
+	ResetDevice(Device);
+	Device.Handle = Duplicate;
+	Device.Output = InitialOutput;
+	Device.DeviceType = DeviceType;
+	Device.Connection = Connection;
+	BuildSectionMap(Device);
+	// Commands and rumbles queued while the controller was away belong to the previous device.
+	Device.Commands.Discard();
+	Device.Rumble.Reset();
+	Device.Clips.Reset();
+	Device.Mixer.Reset();
+	Device.Triggers.Reset();
+	Device.Timelines.Reset();
+	Device.Lights.Reset();
+	Device.bRegistered.store(true, std::memory_order_release);
+	return true;
+}
+
+void FOutputScheduler::Unregister(const int32 ControllerId)
+{
+	if (!IsValidId(ControllerId))
+	{
+		return;
+	}
+
+	void* Handle;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FDevice& Device = Devices[ControllerId];
+		Device.bRegistered.store(false, std::memory_order_release);
+		Handle = Device.Handle;
+		Device.Handle = nullptr;
+		ResetDevice(Device);
+		Device.Rumble.Reset();
+		Device.Clips.Reset();
+		Device.Timelines.Reset();
+		Device.Lights.Reset();
+	}
+
+	if (Handle)
+	{
+		// Waits for the write in progress, which may be to this device.
+		FScopeLock WriteScope(&WriteLock);
+		CloseHandle(Handle);
+	}
+}
+
+bool FOutputScheduler::Enqueue(const int32 ControllerId, const FOutputCommand& Command)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	Devices[ControllerId].Commands.Enqueue(Command);
+	WakeEvent->Trigger();
+	return true;
+}
+
+int32 FOutputScheduler::Broadcast(const FSonyGamepadBroadcastTarget& Target, const TConstArrayView<FOutputCommand> Commands)
+{
+	if (Commands.Num() == 0)
+	{
+		return 0;
+	}
+
+	int32 Count = 0;
+	for (int32 ControllerId = 0; ControllerId < SONY_GAMEPAD_MAX_STATE_SLOTS; ++ControllerId)
+	{
+		FDevice& Device = Devices[ControllerId];
+		if (!Device.bRegistered.load(std::memory_order_acquire))
+		{
+			continue;
+		}
+
+		const bool bSelected = Target.Scope == ESonyGamepadBroadcastScope::Team
+			                       ? Device.Team.load(std::memory_order_relaxed) == Target.Team
+			                       : Target.Scope != ESonyGamepadBroadcastScope::Mask || (Target.Mask & (1 << ControllerId)) != 0;
+		if (!bSelected)
+		{
+			continue;
+		}
+
+		// Stamped here, so a command queued directly after the broadcast still overrides it.
+		for (const FOutputCommand& Command : Commands)
+		{
+			Device.Commands.Enqueue(Command);
+		}
+		// Set after the commands, so the scheduler thread that sees it also drains them.
+		Device.bBroadcastPending.store(true, std::memory_order_release);
+		++Count;
+	}
+	if (Count > 0)
+	{
+		WakeEvent->Trigger();
+	}
+	return Count;
+}
+
+void FOutputScheduler::SetTeam(const int32 ControllerId, const int32 Team)
+{
+	if (IsValidId(ControllerId))
+	{
+		Devices[ControllerId].Team.store(Team, std::memory_order_relaxed);
+	}
+}
+
+uint32 FOutputScheduler::PlayRumble(const int32 ControllerId, const FRumblePlayback& Playback)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return 0;
+	}
+
+	const uint32 Handle = Devices[ControllerId].Rumble.Play(Playback);
+	WakeEvent->Trigger();
+	return Handle;
+}
+
+void FOutputScheduler::StopRumble(const int32 ControllerId, const uint32 Handle)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	Devices[ControllerId].Rumble.Stop(Handle);
+	WakeEvent->Trigger();
+}
+
+bool FOutputScheduler::PlayClip(const int32 ControllerId, const FHapticClipPlayback& Playback)
+{
+	if (!IsValidId(ControllerId) || !Playback.Clip.IsValid() || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	Devices[ControllerId].Clips.Play(Playback);
+	WakeEvent->Trigger();
+	return true;
+}
+
+void FOutputScheduler::StopClip(const int32 ControllerId, const float FadeOut)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	Devices[ControllerId].Clips.Stop(FadeOut);
+	WakeEvent->Trigger();
+}
+
+void FOutputScheduler::SeekClip(const int32 ControllerId, const double Position)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	Devices[ControllerId].Clips.Seek(Position);
+	WakeEvent->Trigger();
+}
+
+bool FOutputScheduler::PlayTriggerTimeline(const int32 ControllerId, const FTriggerTimelinePlayback& Playback)
+{
+	if (!IsValidId(ControllerId) || !Playback.Timeline.IsValid() || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	Devices[ControllerId].Timelines.Play(Playback);
+	WakeEvent->Trigger();
+	return true;
+}
+
+void FOutputScheduler::StopTriggerTimeline(const int32 ControllerId)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	Devices[ControllerId].Timelines.Stop();
+	WakeEvent->Trigger();
+}
+
+bool FOutputScheduler::PlayLightbarAnimation(const int32 ControllerId, const FSonyGamepadLightbarAnimation& Animation, const double StartTime)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	Devices[ControllerId].Lights.PlayLightbar(Animation, StartTime);
+	WakeEvent->Trigger();
+	return true;
+}
+
+void FOutputScheduler::StopLightbarAnimation(const int32 ControllerId)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	Devices[ControllerId].Lights.StopLightbar();
+	WakeEvent->Trigger();
+}
+
+void FOutputScheduler::SetLightbarAnimationValue(const int32 ControllerId, const float Value)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	Devices[ControllerId].Lights.SetLightbarValue(Value);
+	WakeEvent->Trigger();
+}
+
+bool FOutputScheduler::PlayPlayerLedAnimation(const int32 ControllerId, const FSonyGamepadPlayerLedAnimation& Animation, const double StartTime)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	Devices[ControllerId].Lights.PlayPlayerLed(Animation, StartTime);
+	WakeEvent->Trigger();
+	return true;
+}
+
+void FOutputScheduler::StopPlayerLedAnimation(const int32 ControllerId)
+{
+	if (!IsValidId(ControllerId) || !Devices[ControllerId].bRegistered.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	Devices[ControllerId].Lights.StopPlayerLed();
+	WakeEvent->Trigger();
+}
+
+void FOutputScheduler::SetAdapter(const int32 ControllerId, const int32 AdapterId)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (IsValidId(ControllerId))
+	{
+		Devices[ControllerId].AdapterId = AdapterId;
+	}
+}
+
+void FOutputScheduler::SetBudget(const FSonyGamepadOutputBudget& InBudget)
+{
+	FScopeLock ScopeLock(&Lock);
+	Budget = InBudget;
+	UsbBucket.Configure(Budget.Usb);
+	BluetoothBucket.Configure(Budget.Bluetooth);
+	for (TPair<int32, FTokenBucket>& Pair : AdapterBuckets)
+	{
+		Pair.Value.Configure(Budget.BluetoothAdapter);
+	}
+}
+
+void FOutputScheduler::SetRumbleMix(const FSonyGamepadRumbleMix& InRumbleMix)
+{
+	FScopeLock ScopeLock(&Lock);
+	RumbleMix = InRumbleMix;
+	for (FDevice& Device : Devices)
+	{
+		if (Device.Handle)
+		{
+			// Remixed with the new settings even if no source changes.
+			Device.bSequencing = true;
+		}
+	}
+	WakeEvent->Trigger();
+}
+
+FSonyGamepadOutputStats FOutputScheduler::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	FSonyGamepadOutputStats Result = Stats;
+	Result.AverageQueueDelayMs = Stats.SentReports > 0 ? static_cast<float>(TotalQueueDelay / Stats.SentReports * 1000.0) : 0.0f;
+	return Result;
+}
+
+TArray<FSonyGamepadRumbleSourceStats> FOutputScheduler::GetRumbleStats(const int32 ControllerId) const
+{
+	TArray<FSonyGamepadRumbleSourceStats> Result;
+	FScopeLock ScopeLock(&Lock);
+	if (IsValidId(ControllerId) && Devices[ControllerId].Handle)
+	{
+		Devices[ControllerId].Mixer.GetStats(Result);
+	}
+	return Result;
+}
+
+void FOutputScheduler::ResetStats()
+{
+	FScopeLock ScopeLock(&Lock);
+	Stats = FSonyGamepadOutputStats();
+	TotalQueueDelay = 0.0;
+	for (FDevice& Device : Devices)
+	{
+		Device.Mixer.ResetStats();
+	}
+}
+
+void FOutputScheduler::Shutdown()
+{
+	bStopping.store(true, std::memory_order_relaxed);
+	if (Thread)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	for (FDevice& Device : Devices)
+	{
+		Device.bRegistered.store(false, std::memory_order_release);
+		if (Device.Handle)
+		{
+			CloseHandle(Device.Handle);
+			Device.Handle = nullptr;
+		}
+		ResetDevice(Device);
+	}
+}
+
+uint32 FOutputScheduler::Run()
+{
+	while (!bStopping.load(std::memory_order_relaxed))
+	{
+		const double Wait = ServePending();
+		WakeEvent->Wait(FMath::Clamp<uint32>(static_cast<uint32>(FMath::CeilToDouble(Wait * 1000.0)), 1, IdleWaitMs));
+	}
+	return 0;
+}
+
+void FOutputScheduler::Stop()
+{
+	bStopping.store(true, std::memory_order_relaxed);
+	WakeEvent->Trigger();
+}
+
+double FOutputScheduler::ServePending()
+{
+	struct FWrite
+	{
+		unsigned char Report[SONY_GAMEPAD_MAX_OUTPUT_REPORT_SIZE];
+		void* Handle;
+		uint32 Length;
+		int32 ControllerId;
+		double PendingSince;
+		bool bSucceeded;
+	};
+
+	FScopeLock WriteScope(&WriteLock);
+	TArray<FWrite, TInlineAllocator<SONY_GAMEPAD_MAX_STATE_SLOTS>> Writes;
+	double Wait = IdleWaitMs / 1000.0;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const double Now = FPlatformTime::Seconds();
+		UsbBucket.Refill(Now);
+		BluetoothBucket.Refill(Now);
+		for (TPair<int32, FTokenBucket>& Pair : AdapterBuckets)
+		{
+			Pair.Value.Refill(Now);
+		}
+
+		// Every broadcast of this pass shares one group, so effects sent in a row also start together.
+		uint32 PassSyncGroup = 0;
+		TArray<int32, TInlineAllocator<SONY_GAMEPAD_MAX_STATE_SLOTS>> Order;
+		for (int32 ControllerId = 0; ControllerId < SONY_GAMEPAD_MAX_STATE_SLOTS; ++ControllerId)
+		{
+			FDevice& Device = Devices[ControllerId];
+			if (!Device.Handle)
+			{
+				continue;
+			}
+			// A controller behind a barrier applies the broadcast after this pass, it can not be held with the others.
+			const bool bBroadcast = Device.bBroadcastPending.exchange(false, std::memory_order_acquire);
+			if (!Device.bBarrier)
+			{
+				if (bBroadcast)
+				{
+					PassSyncGroup = PassSyncGroup != 0 ? PassSyncGroup : NextSyncGroup();
+					Device.SyncGroup = PassSyncGroup;
+				}
+				UpdateDevice(Device, Now);
+			}
+			if (Device.bPending)
+			{
+				Order.Add(ControllerId);
+			}
+			else
+			{
+				// The broadcast changed nothing on this controller, there is nothing to hold.
+				Device.SyncGroup = 0;
+			}
+			if (Device.bSequencing || Device.bAnimating)
+			{
+				Wait = FMath::Min(Wait, FMath::Max(Device.NextSample - Now, 0.0));
+			}
+		}
+		Order.Sort([this](const int32 A, const int32 B)
+		{
+			const int32 PriorityA = GetPriority(Devices[A].PendingSections);
+			const int32 PriorityB = GetPriority(Devices[B].PendingSections);
+			return PriorityA != PriorityB ? PriorityA < PriorityB : Devices[A].LastServed < Devices[B].LastServed;
+		});
+
+		auto Defer = [this](FDevice& Device)
+		{
+			if (!Device.bDeferred)
+			{
+				Device.bDeferred = true;
+				++Stats.DeferredUpdates;
+			}
+		};
+		auto Serve = [this, &Writes, &Wait, &Defer, Now](const int32 ControllerId)
+		{
+			FDevice& Device = Devices[ControllerId];
+			const bool bBluetooth = Device.Connection == Bluetooth;
+			FTokenBucket& Transport = bBluetooth ? BluetoothBucket : UsbBucket;
+			FTokenBucket* Adapter = bBluetooth ? &GetAdapterBucket(Device.AdapterId) : nullptr;
+			if (Transport.Tokens < 1.0f || (Adapter && Adapter->Tokens < 1.0f))
+			{
+				Defer(Device);
+				Wait = FMath::Min(Wait, FMath::Max(Transport.GetTimeUntilToken(), Adapter ? Adapter->GetTimeUntilToken() : 0.0));
+				return;
+			}
+
+			Transport.Tokens -= 1.0f;
+			if (Adapter)
+			{
+				Adapter->Tokens -= 1.0f;
+			}
+
+			FWrite& Write = Writes.AddDefaulted_GetRef();
+			FMemory::Memcpy(Write.Report, Device.Report, Device.ReportLength);
+			Write.Handle = Device.Handle;
+			Write.Length = Device.ReportLength;
+			Write.ControllerId = ControllerId;
+			Write.PendingSince = Device.PendingSince;
+			Device.bPending = false;
+			Device.bBarrier = false;
+			Device.SyncGroup = 0;
+			Device.LastServed = Now;
+		};
+
+		for (const int32 ControllerId : Order)
+		{
+			FDevice& Device = Devices[ControllerId];
+			if (!Device.bPending)
+			{
+				// Already written with its broadcast.
+				continue;
+			}
+			if (Device.SyncGroup == 0)
+			{
+				Serve(ControllerId);
+				continue;
+			}
+
+			// The reports of a broadcast wait for each other, then go out back to back.
+			const uint32 SyncGroup = Device.SyncGroup;
+			if (const double GroupWait = GetSyncGroupWait(SyncGroup); GroupWait > 0.0)
+			{
+				Defer(Device);
+				Wait = FMath::Min(Wait, GroupWait);
+				continue;
+			}
+			for (const int32 Member : Order)
+			{
+				if (Devices[Member].bPending && Devices[Member].SyncGroup == SyncGroup)
+				{
+					Serve(Member);
+				}
+			}
+		}
+
+		for (const FDevice& Device : Devices)
+		{
+			if (Device.Handle && !Device.bBarrier && !Device.Commands.IsEmpty())
+			{
+				// Commands left behind a barrier that was just served.
+				Wait = 0.0;
+			}
+		}
+	}
+
+	for (FWrite& Write : Writes)
+	{
+		DWORD BytesWritten = 0;
+		Write.bSucceeded = WriteFile(Write.Handle, Write.Report, Write.Length, &BytesWritten, nullptr) != 0;
+		if (!Write.bSucceeded)
+		{
+			UE_LOG(LogTemp, Error, TEXT("OutputScheduler: Failed to write output data to controller %d. report %u Error Code: %d"), Write.ControllerId, Write.Length, GetLastError());
+		}
+	}
+
+	if (Writes.Num() > 0)
+	{
+		FScopeLock ScopeLock(&Lock);
+		const double Now = FPlatformTime::Seconds();
+		for (const FWrite& Write : Writes)
+		{
+			if (!Write.bSucceeded)
+			{
+				++Stats.FailedWrites;
+				continue;
+			}
+
+			const double Delay = Now - Write.PendingSince;
+			++Stats.SentReports;
+			TotalQueueDelay += Delay;
+			Stats.MaxQueueDelayMs = FMath::Max(Stats.MaxQueueDelayMs, static_cast<float>(Delay * 1000.0));
+		}
+	}
+	return Wait;
+}
+
+int32 FOutputScheduler::GetPriority(const ESonyOutputSection Sections)
+{
+	if (EnumHasAnyFlags(Sections, ESonyOutputSection::Rumble | ESonyOutputSection::Triggers))
+	{
+		return 0;
+	}
+	if (EnumHasAnyFlags(Sections, ESonyOutputSection::Lightbar | ESonyOutputSection::PlayerLed | ESonyOutputSection::MicLed))
+	{
+		return 1;
+	}
+	return 2;
+}
+
+void FOutputScheduler::BuildSectionMap(FDevice& Device)
+{
+	// Offsets match UDeviceHIDManager::BuildOutputDualSense and BuildOutputDualShock.
+	const int32 Padding = Device.Connection == Bluetooth ? 2 : 1;
+	MarkSection(Device.ByteSections, 0, SONY_GAMEPAD_MAX_OUTPUT_REPORT_SIZE, ESonyOutputSection::Other);
+	if (Device.DeviceType == DualShock4)
+	{
+		const int32 Base = Padding + 3 + (Padding - 1);
+		MarkSection(Device.ByteSections, Base, 2, ESonyOutputSection::Rumble);
+		MarkSection(Device.ByteSections, Base + 2, 5, ESonyOutputSection::Lightbar);
+	}
+	else
+	{
+		MarkSection(Device.ByteSections, Padding + 2, 2, ESonyOutputSection::Rumble);
+		MarkSection(Device.ByteSections, Padding + 4, 4, ESonyOutputSection::Audio);
+		MarkSection(Device.ByteSections, Padding + 8, 1, ESonyOutputSection::MicLed);
+		MarkSection(Device.ByteSections, Padding + 9, 1, ESonyOutputSection::Audio);
+		MarkSection(Device.ByteSections, Padding + 10, 22, ESonyOutputSection::Triggers);
+		// Toggled on every report, so it would make every report look changed.
+		MarkSection(Device.ByteSections, Padding + 38, 1, ESonyOutputSection::None);
+		MarkSection(Device.ByteSections, Padding + 42, 2, ESonyOutputSection::PlayerLed);
+		MarkSection(Device.ByteSections, Padding + 44, 3, ESonyOutputSection::Lightbar);
+	}
+	if (Device.Connection == Bluetooth)
+	{
+		// The checksum changes with any other byte.
+		MarkSection(Device.ByteSections, 0x4A, 4, ESonyOutputSection::None);
+	}
+}
+
+void FOutputScheduler::ResetDevice(FDevice& Device)
+{
+	Device.ReportLength = 0;
+	Device.AdapterId = 0;
+	Device.PendingSections = ESonyOutputSection::None;
+	Device.LastServed = 0.0;
+	Device.bPending = false;
+	Device.bDeferred = false;
+	Device.bBarrier = false;
+	Device.bSequencing = false;
+	Device.bAnimating = false;
+	Device.SyncGroup = 0;
+	Device.bBroadcastPending.store(false, std::memory_order_relaxed);
+}
+
+void FOutputScheduler::UpdateDevice(FDevice& Device, const double Now)
+{
+	double OldestCommand = Now;
+	bool bBarrier = false;
+	bool bFlush = false;
+	const int32 Drained = Device.Commands.Drain(Device.Output, Device.Mixer, Device.Triggers, OldestCommand, bBarrier, bFlush);
+
+	// Clips and rumbles are mixed over a copy, so the state set by the commands comes back when they end.
+	FOutputContext Mixed = Device.Output;
+	FRumbles Extra[SONY_GAMEPAD_RUMBLE_SOURCES];
+	double NextTimeline = 0.0;
+	double NextTrigger = 0.0;
+	double NextRumble = 0.0;
+	double NextClip = 0.0;
+	double NextLights = 0.0;
+	bool bLightsChanged = false;
+	const bool bWasSequencing = Device.bSequencing;
+	const bool bTimeline = Device.Timelines.Evaluate(Now, Device.Triggers, NextTimeline);
+	const bool bTriggers = Device.Triggers.Resolve(Now, Mixed.LeftTrigger, Mixed.RightTrigger, NextTrigger);
+	// Animated before the clips, so a clip that drives the lightbar blends over the animation.
+	const bool bLights = Device.Lights.Evaluate(Now, Mixed, NextLights, bLightsChanged);
+	const bool bClips = Device.Clips.Evaluate(Now, Mixed, Extra[static_cast<int32>(ESonyGamepadRumbleSource::Cinematic)], NextClip);
+	const bool bRumbles = Device.Rumble.Evaluate(Now, Extra[static_cast<int32>(ESonyGamepadRumbleSource::Gameplay)], NextRumble);
+	Device.bSequencing = bTimeline || bTriggers || bClips || bRumbles;
+	Device.bAnimating = bLights;
+	Device.NextSample = FMath::Min(FMath::Min(bTimeline ? NextTimeline : TNumericLimits<double>::Max(), bTriggers ? NextTrigger : TNumericLimits<double>::Max()),
+	                               FMath::Min(bClips ? NextClip : TNumericLimits<double>::Max(), bRumbles ? NextRumble : TNumericLimits<double>::Max()));
+	Device.NextSample = FMath::Min(Device.NextSample, bLights ? NextLights : TNumericLimits<double>::Max());
+	// A light animation step that rounds to the same 8-bit values leaves the report as it is.
+	if (Drained == 0 && !bLightsChanged && !Device.bSequencing && !bWasSequencing)
+	{
+		return;
+	}
+
+	Mixed.Rumbles = Device.Mixer.Mix(RumbleMix, Extra);
+
+	// Built over the previous report, as the DualSense toggles some flags from one report to the next.
+	unsigned char Report[SONY_GAMEPAD_MAX_OUTPUT_REPORT_SIZE];
+	FMemory::Memcpy(Report, Device.Report, sizeof(Report));
+	const uint32 Length = Device.DeviceType == DualShock4
+		                      ? UDeviceHIDManager::BuildOutputDualShock(Mixed, Device.Connection, Report)
+		                      : UDeviceHIDManager::BuildOutputDualSense(Mixed, Device.Connection, Report);
+
+	ESonyOutputSection Changed = bFlush || Length != Device.ReportLength ? ESonyOutputSection::Other : ESonyOutputSection::None;
+	for (uint32 Index = 0; Index < Length; ++Index)
+	{
+		if (Report[Index] != Device.Report[Index])
+		{
+			Changed |= Device.ByteSections[Index];
+		}
+	}
+	FMemory::Memcpy(Device.Report, Report, Length);
+	Device.ReportLength = Length;
+
+	if (Changed == ESonyOutputSection::None)
+	{
+		return;
+	}
+
+	// A rumble sample counts as one update when no command came with it.
+	const int32 Updates = FMath::Max(Drained, 1);
+	if (Device.bPending)
+	{
+		Device.PendingSections |= Changed;
+		Stats.MergedUpdates += Updates;
+	}
+	else
+	{
+		Device.PendingSections = Changed;
+		Device.PendingSince = OldestCommand;
+		Device.bPending = true;
+		Device.bDeferred = false;
+		Stats.MergedUpdates += Updates - 1;
+	}
+	Device.bBarrier = bBarrier;
+}
+
+uint32 FOutputScheduler::NextSyncGroup()
+{
+	if (++LastSyncGroup == 0)
+	{
+		// 0 stands for no group.
+		++LastSyncGroup;
+	}
+	return LastSyncGroup;
+}
+
+double FOutputScheduler::GetSyncGroupWait(const uint32 SyncGroup)
+{
+	int32 UsbReports = 0;
+	int32 BluetoothReports = 0;
+	TMap<int32, int32, TInlineSetAllocator<4>> AdapterReports;
+	for (const FDevice& Device : Devices)
+	{
+		if (!Device.Handle || !Device.bPending || Device.SyncGroup != SyncGroup)
+		{
+			continue;
+		}
+		if (Device.Connection == Bluetooth)
+		{
+			++BluetoothReports;
+			++AdapterReports.FindOrAdd(Device.AdapterId);
+		}
+		else
+		{
+			++UsbReports;
+		}
+	}
+
+	// A group larger than a burst can never go at once, it goes as soon as a full burst is available.
+	auto GetWait = [](const FTokenBucket& Bucket, const int32 Count)
+	{
+		const float Needed = FMath::Min(static_cast<float>(Count), Bucket.Burst);
+		return Count > 0 && Bucket.Tokens < Needed ? (Needed - Bucket.Tokens) / Bucket.Rate : 0.0;
+	};
+	double Wait = FMath::Max(GetWait(UsbBucket, UsbReports), GetWait(BluetoothBucket, BluetoothReports));
+	for (const TPair<int32, int32>& Pair : AdapterReports)
+	{
+		Wait = FMath::Max(Wait, GetWait(GetAdapterBucket(Pair.Key), Pair.Value));
+	}
+	return Wait;
+}
+
+FOutputScheduler::FTokenBucket& FOutputScheduler::GetAdapterBucket(const int32 AdapterId)
+{
+	if (FTokenBucket* Bucket = AdapterBuckets.Find(AdapterId))
+	{
+		return *Bucket;
+	}
+
+	FTokenBucket& Bucket = AdapterBuckets.Add(AdapterId);
+	Bucket.Configure(Budget.BluetoothAdapter);
+	Bucket.LastRefill = FPlatformTime::Seconds();
+	return Bucket;
+}
+
+void FOutputScheduler::FTokenBucket::Configure(const FSonyGamepadOutputRate& InRate)
+{
+	Rate = FMath::Max(InRate.ReportsPerSecond, 1.0f);
+	Burst = FMath::Max(InRate.Burst, 1.0f);
+	Tokens = LastRefill > 0.0 ? FMath::Min(Tokens, Burst) : Burst;
+}
+
+void FOutputScheduler::FTokenBucket::Refill(const double Now)
+{
+	if (LastRefill > 0.0)
+	{
+		Tokens = FMath::Min(Burst, Tokens + static_cast<float>((Now - LastRefill) * Rate));
+	}
+	LastRefill = Now;
+}
+
+double FOutputScheduler::FTokenBucket::GetTimeUntilToken() const
+{
+	return Tokens >= 1.0f ? 0.0 : (1.0f - Tokens) / Rate;
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Output/RumbleMixer.h"
+
+void FRumbleMixer::Set(const ESonyGamepadRumbleSource Source, const FRumbles& Rumbles)
+{
+	const int32 Index = static_cast<int32>(Source);
+	if (Index < 0 || Index >= SONY_GAMEPAD_RUMBLE_SOURCES)
+	{
+		return;
+	}
+
+	Levels[Index] = Rumbles;
+	++Stats[Index].Updates;
+}
+
+FRumbles FRumbleMixer::Mix(const FSonyGamepadRumbleMix& Settings, const FRumbles (&Extra)[SONY_GAMEPAD_RUMBLE_SOURCES])
+{
+	// Insertion sort by priority, stable so sources of the same priority keep the order of the enum.
+	int32 Order[SONY_GAMEPAD_RUMBLE_SOURCES];
+	for (int32 Index = 0; Index < SONY_GAMEPAD_RUMBLE_SOURCES; ++Index)
+	{
+		const int32 Priority = Settings.Get(static_cast<ESonyGamepadRumbleSource>(Index)).Priority;
+		int32 Slot = Index;
+		while (Slot > 0 && Settings.Get(static_cast<ESonyGamepadRumbleSource>(Order[Slot - 1])).Priority > Priority)
+		{
+			Order[Slot] = Order[Slot - 1];
+			--Slot;
+		}
+		Order[Slot] = Index;
+	}
+
+	float Left = 0.0f;
+	float Right = 0.0f;
+	for (int32 Step = 0; Step < SONY_GAMEPAD_RUMBLE_SOURCES; ++Step)
+	{
+		const int32 Source = Order[Step];
+		const FSonyGamepadRumbleSourceSettings& SourceSettings = Settings.Get(static_cast<ESonyGamepadRumbleSource>(Source));
+		const float InLeft = FMath::Max(Levels[Source].Left, Extra[Source].Left) / 255.0f;
+		const float InRight = FMath::Max(Levels[Source].Right, Extra[Source].Right) / 255.0f;
+		const bool bActive = InLeft > 0.0f || InRight > 0.0f;
+		Stats[Source].LastLevel = FMath::Max(InLeft, InRight);
+		if (!bActive)
+		{
+			continue;
+		}
+
+		++Stats[Source].ActiveMixes;
+		const float Gain = FMath::Max(SourceSettings.Gain, 0.0f);
+		const float SourceLeft = InLeft * Gain;
+		const float SourceRight = InRight * Gain;
+		switch (SourceSettings.Blend)
+		{
+		case ESonyGamepadRumbleBlend::SumClamp:
+			Left += SourceLeft;
+			Right += SourceRight;
+			break;
+		case ESonyGamepadRumbleBlend::Duck:
+			for (int32 Below = 0; Below < Step; ++Below)
+			{
+				if (Stats[Order[Below]].LastLevel > 0.0f)
+				{
+					++Stats[Order[Below]].DuckedMixes;
+				}
+			}
+			Left = FMath::Max(Left * FMath::Clamp(SourceSettings.DuckLevel, 0.0f, 1.0f), SourceLeft);
+			Right = FMath::Max(Right * FMath::Clamp(SourceSettings.DuckLevel, 0.0f, 1.0f), SourceRight);
+			break;
+		default:
+			Left = FMath::Max(Left, SourceLeft);
+			Right = FMath::Max(Right, SourceRight);
+			break;
+		}
+		Left = FMath::Min(Left, 1.0f);
+		Right = FMath::Min(Right, 1.0f);
+	}
+
+	FRumbles Result;
+	Result.Left = static_cast<unsigned char>(FMath::RoundToInt(Left * 255.0f));
+	Result.Right = static_cast<unsigned char>(FMath::RoundToInt(Right * 255.0f));
+	return Result;
+}
+
+void FRumbleMixer::GetStats(TArray<FSonyGamepadRumbleSourceStats>& OutStats) const
+{
+	OutStats.Reset(SONY_GAMEPAD_RUMBLE_SOURCES);
+	for (int32 Index = 0; Index < SONY_GAMEPAD_RUMBLE_SOURCES; ++Index)
+	{
+		FSonyGamepadRumbleSourceStats& Entry = OutStats.Add_GetRef(Stats[Index]);
+		Entry.Source = static_cast<ESonyGamepadRumbleSource>(Index);
+	}
+}
+
+void FRumbleMixer::ResetStats()
+{
+	for (int32 Index = 0; Index < SONY_GAMEPAD_RUMBLE_SOURCES; ++Index)
+	{
+		const float LastLevel = Stats[Index].LastLevel;
+		Stats[Index] = FSonyGamepadRumbleSourceStats();
+		Stats[Index].LastLevel = LastLevel;
+	}
+}
+
+void FRumbleMixer::Reset()
+{
+	for (int32 Index = 0; Index < SONY_GAMEPAD_RUMBLE_SOURCES; ++Index)
+	{
+		Levels[Index] = FRumbles();
+		Stats[Index] = FSonyGamepadRumbleSourceStats();
+	}
+}
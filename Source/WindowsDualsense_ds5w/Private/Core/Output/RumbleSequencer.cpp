@@ -0,0 +1,217 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Output/RumbleSequencer.h"
+
+#include "GameFramework/ForceFeedbackEffect.h"
+
+void FRumbleCurve::Evaluate(const double Time, float& OutLeft, float& OutRight) const
+{
+	if (Samples.Num() == 0)
+	{
+		OutLeft = 0.0f;
+		OutRight = 0.0f;
+		return;
+	}
+
+	const double Position = FMath::Clamp(Time * SampleRate, 0.0, static_cast<double>(Samples.Num() - 1));
+	const int32 Index = FMath::Min(static_cast<int32>(Position), Samples.Num() - 1);
+	const int32 Next = FMath::Min(Index + 1, Samples.Num() - 1);
+	const float Alpha = static_cast<float>(Position - Index);
+	OutLeft = FMath::Lerp(static_cast<float>(Samples[Index].Left), static_cast<float>(Samples[Next].Left), Alpha) / 255.0f;
+	OutRight = FMath::Lerp(static_cast<float>(Samples[Index].Right), static_cast<float>(Samples[Next].Right), Alpha) / 255.0f;
+}
+
+TSharedPtr<const FRumbleCurve> FRumbleCurve::Bake(UForceFeedbackEffect* Effect)
+{
+	if (!IsValid(Effect) || Effect->ChannelDetails.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	TSharedRef<FRumbleCurve> Curve = MakeShared<FRumbleCurve>();
+	const float Duration = Effect->GetDuration();
+	const int32 NumSamples = FMath::Max(FMath::CeilToInt(Duration * Curve->SampleRate), 0) + 1;
+	Curve->Samples.SetNumUninitialized(NumSamples);
+	for (int32 Index = 0; Index < NumSamples; ++Index)
+	{
+		const float Time = FMath::Min(Index / Curve->SampleRate, Duration);
+		float Left = 0.0f;
+		float Right = 0.0f;
+		for (const FForceFeedbackChannelDetails& Channel : Effect->ChannelDetails)
+		{
+			const FRichCurve* RichCurve = Channel.Curve.GetRichCurveConst();
+			if (!RichCurve)
+			{
+				continue;
+			}
+
+			const float Value = RichCurve->Eval(Time);
+			if (Channel.bAffectsLeftLarge || Channel.bAffectsLeftSmall)
+			{
+				Left = FMath::Max(Left, Value);
+			}
+			if (Channel.bAffectsRightLarge || Channel.bAffectsRightSmall)
+			{
+				Right = FMath::Max(Right, Value);
+			}
+		}
+
+		Curve->Samples[Index].Left = static_cast<unsigned char>(FMath::RoundToInt(FMath::Clamp(Left, 0.0f, 1.0f) * 255.0f));
+		Curve->Samples[Index].Right = static_cast<unsigned char>(FMath::RoundToInt(FMath::Clamp(Right, 0.0f, 1.0f) * 255.0f));
+	}
+	return Curve;
+}
+
+uint32 FRumbleSequencer::Play(const FRumblePlayback& Playback)
+{
+	FRequest Request;
+	Request.Voice.Playback = Playback;
+	Request.Voice.Handle = NextHandle.fetch_add(1, std::memory_order_relaxed);
+	if (Request.Voice.Handle == 0)
+	{
+		// Wrapped around; 0 means every rumble to Stop.
+		Request.Voice.Handle = NextHandle.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	const uint32 Handle = Request.Voice.Handle;
+	Requests.Enqueue(MoveTemp(Request));
+	return Handle;
+}
+
+void FRumbleSequencer::Stop(const uint32 Handle)
+{
+	FRequest Request;
+	Request.Voice.Handle = Handle;
+	Request.Voice.StopTime = FPlatformTime::Seconds();
+	Request.bStop = true;
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+bool FRumbleSequencer::Evaluate(const double Now, FRumbles& OutRumbles, double& OutNextTime)
+{
+	FRequest Request;
+	while (Requests.Dequeue(Request))
+	{
+		if (!Request.bStop)
+		{
+			Voices.Add(MoveTemp(Request.Voice));
+			continue;
+		}
+
+		for (FVoice& Voice : Voices)
+		{
+			if ((Request.Voice.Handle == 0 || Voice.Handle == Request.Voice.Handle) && Voice.StopTime < 0.0)
+			{
+				Voice.StopTime = Request.Voice.StopTime;
+			}
+		}
+	}
+
+	float Left = 0.0f;
+	float Right = 0.0f;
+	bool bSounding = false;
+	double NextStart = TNumericLimits<double>::Max();
+	for (int32 Index = Voices.Num() - 1; Index >= 0; --Index)
+	{
+		const FVoice& Voice = Voices[Index];
+		const FRumblePlayback& Playback = Voice.Playback;
+		if (Now < Playback.StartTime)
+		{
+			// Stopped before it started.
+			if (Voice.StopTime >= 0.0)
+			{
+				Voices.RemoveAtSwap(Index);
+				continue;
+			}
+			NextStart = FMath::Min(NextStart, Playback.StartTime);
+			continue;
+		}
+
+		const double Time = Now - Playback.StartTime;
+		const double StopTime = Voice.StopTime >= 0.0 ? FMath::Max(Voice.StopTime - Playback.StartTime, 0.0) : -1.0;
+		bool bFinished = false;
+		float VoiceLeft = 0.0f;
+		float VoiceRight = 0.0f;
+		if (Playback.Curve.IsValid())
+		{
+			const double Duration = Playback.Curve->GetDuration();
+			bFinished = StopTime >= 0.0 || (!Playback.bLoop && Time > Duration);
+			if (!bFinished)
+			{
+				Playback.Curve->Evaluate(Playback.bLoop && Duration > 0.0 ? FMath::Fmod(Time, Duration) : Time, VoiceLeft, VoiceRight);
+			}
+		}
+		else
+		{
+			const float Level = EvaluateEnvelope(Playback.Envelope, Time, StopTime, bFinished);
+			VoiceLeft = Level * Playback.Envelope.LeftAmplitude;
+			VoiceRight = Level * Playback.Envelope.RightAmplitude;
+		}
+
+		if (bFinished)
+		{
+			Voices.RemoveAtSwap(Index);
+			continue;
+		}
+
+		bSounding = true;
+		Left = FMath::Max(Left, VoiceLeft * Playback.Scale);
+		Right = FMath::Max(Right, VoiceRight * Playback.Scale);
+	}
+
+	OutRumbles.Left = static_cast<unsigned char>(FMath::RoundToInt(FMath::Clamp(Left, 0.0f, 1.0f) * 255.0f));
+	OutRumbles.Right = static_cast<unsigned char>(FMath::RoundToInt(FMath::Clamp(Right, 0.0f, 1.0f) * 255.0f));
+
+	// Samples stay on a fixed grid, except for the first sample of a rumble, taken at its start time.
+	const double NextSample = (FMath::FloorToDouble(Now * SONY_GAMEPAD_RUMBLE_SAMPLE_RATE) + 1.0) / SONY_GAMEPAD_RUMBLE_SAMPLE_RATE;
+	OutNextTime = bSounding ? FMath::Min(NextSample, NextStart) : NextStart;
+	return Voices.Num() > 0;
+}
+
+void FRumbleSequencer::Reset()
+{
+	Requests.Empty();
+	Voices.Reset();
+}
+
+float FRumbleSequencer::EvaluateEnvelope(const FSonyGamepadRumbleEnvelope& Envelope, const double Time, const double StopTime, bool& bOutFinished)
+{
+	const double Attack = FMath::Max(Envelope.AttackTime, 0.0f);
+	const double Decay = FMath::Max(Envelope.DecayTime, 0.0f);
+	const double Release = FMath::Max(Envelope.ReleaseTime, 0.0f);
+	const float Sustain = FMath::Clamp(Envelope.SustainLevel, 0.0f, 1.0f);
+
+	auto Hold = [&](const double At) -> float
+	{
+		if (At < Attack)
+		{
+			return static_cast<float>(At / Attack);
+		}
+		if (At < Attack + Decay)
+		{
+			return FMath::Lerp(1.0f, Sustain, static_cast<float>((At - Attack) / Decay));
+		}
+		return Sustain;
+	};
+
+	// The release starts when the sustain ends or when the rumble is stopped, whichever comes first.
+	double ReleaseStart = Envelope.SustainTime >= 0.0f ? Attack + Decay + Envelope.SustainTime : TNumericLimits<double>::Max();
+	if (StopTime >= 0.0)
+	{
+		ReleaseStart = FMath::Min(ReleaseStart, StopTime);
+	}
+
+	bOutFinished = false;
+	if (Time < ReleaseStart)
+	{
+		return Hold(Time);
+	}
+	if (Time >= ReleaseStart + Release)
+	{
+		bOutFinished = true;
+		return 0.0f;
+	}
+	return Hold(ReleaseStart) * static_cast<float>(1.0 - (Time - ReleaseStart) / Release);
+}
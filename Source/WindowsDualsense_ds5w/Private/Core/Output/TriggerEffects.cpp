@@ -0,0 +1,226 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Output/TriggerEffects.h"
+
+#include "Core/DeviceHIDManager.h"
+#include "Helpers/ValidateHelpers.h"
+
+FHapticTriggers FTriggerEffects::ContinuousResistance(const int32 StartPosition, const int32 Strength)
+{
+	FHapticTriggers Effect;
+	Effect.Mode = 0x01;
+	Effect.Strengths.ActiveZones = UValidateHelpers::To255(StartPosition, 8);
+	Effect.Strengths.StrengthZones = UValidateHelpers::To255(Strength, 9);
+	return Effect;
+}
+
+FHapticTriggers FTriggerEffects::Resistance(const int32 BeginStrength, const int32 MiddleStrength, const int32 EndStrength)
+{
+	unsigned char PositionalAmplitudes[10];
+	PositionalAmplitudes[0] = BeginStrength;
+	PositionalAmplitudes[1] = BeginStrength;
+	PositionalAmplitudes[2] = BeginStrength;
+	PositionalAmplitudes[3] = BeginStrength;
+	PositionalAmplitudes[4] = MiddleStrength;
+	PositionalAmplitudes[5] = MiddleStrength;
+	PositionalAmplitudes[6] = MiddleStrength;
+	PositionalAmplitudes[7] = MiddleStrength;
+	PositionalAmplitudes[8] = EndStrength;
+	PositionalAmplitudes[9] = EndStrength;
+
+	int32 ActiveZones = 0;
+	int16 StrengthValues = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		if (PositionalAmplitudes[i] > 0)
+		{
+			const int8_t StrengthValue = static_cast<int8_t>((PositionalAmplitudes[i] - 1) & 0x07);
+			StrengthValues |= (StrengthValue << (3 * i));
+			ActiveZones |= static_cast<int16>(1 << i);
+		}
+	}
+
+	FHapticTriggers Effect;
+	Effect.Mode = 0x21;
+	Effect.Strengths.ActiveZones = ActiveZones;
+	Effect.Strengths.StrengthZones = StrengthValues;
+	return Effect;
+}
+
+FHapticTriggers FTriggerEffects::Weapon(const int32 StartPosition, const int32 EndPosition, const int32 Strength)
+{
+	const uint32_t ActiveZones = (1 << StartPosition) | (1 << EndPosition);
+	FHapticTriggers Effect;
+	Effect.Mode = 0x25;
+	Effect.Strengths.ActiveZones = ActiveZones;
+	Effect.Strengths.StrengthZones = UValidateHelpers::To255(Strength);
+	return Effect;
+}
+
+FHapticTriggers FTriggerEffects::Galloping(const int32 StartPosition, const int32 EndPosition, const int32 FirstFoot, const int32 SecondFoot,
+                                           const float Frequency)
+{
+	const uint32_t ActiveZones = (1 << StartPosition) | (1 << EndPosition);
+	const uint32_t TimeAndRatio = (SecondFoot & 0x07) << (3 * 0) | (FirstFoot & 0x07);
+	FHapticTriggers Effect;
+	Effect.Mode = 0x23;
+	Effect.Strengths.ActiveZones = ActiveZones;
+	Effect.Strengths.TimeAndRatio = TimeAndRatio;
+	Effect.Frequency = UValidateHelpers::To255(Frequency);
+	return Effect;
+}
+
+FHapticTriggers FTriggerEffects::Machine(const int32 StartPosition, const int32 EndPosition, const int32 AmplitudeBegin, const int32 AmplitudeEnd,
+                                         const float Frequency, float Period)
+{
+	const uint32_t ActiveZones = ((1 << StartPosition) | (1 << EndPosition));
+	const uint32_t Strengths = (((AmplitudeBegin & 0x07) << (3 * 0)) | ((AmplitudeEnd & 0x07) << (3 * 1)));
+
+	if (Period < 0.0f || Period > 3.f)
+	{
+		Period = 3.f;
+	}
+
+	FHapticTriggers Effect;
+	Effect.Mode = 0x27;
+	Effect.Strengths.ActiveZones = ActiveZones;
+	Effect.Strengths.StrengthZones = Strengths;
+	Effect.Strengths.Period = UValidateHelpers::To255(Period);
+	Effect.Frequency = UValidateHelpers::To255(Frequency);
+	return Effect;
+}
+
+FHapticTriggers FTriggerEffects::Bow(const int32 StartPosition, const int32 EndPosition, const int32 BeginStrength, const int32 EndStrength)
+{
+	const uint32_t ActiveZones = ((1 << StartPosition) | (1 << EndPosition));
+	const uint32_t Strengths = ((((BeginStrength - 1) & 0x07) << (3 * 0)) | (((EndStrength - 1) & 0x07) << (3 * 1)));
+	FHapticTriggers Effect;
+	Effect.Mode = 0x22;
+	Effect.Strengths.ActiveZones = ActiveZones;
+	Effect.Strengths.StrengthZones = Strengths;
+	return Effect;
+}
+
+FHapticTriggers FTriggerEffects::AutomaticGun(const int32 BeginStrength, const int32 MiddleStrength, const int32 EndStrength, const bool bKeepEffect)
+{
+	unsigned char PositionalAmplitudes[10];
+	PositionalAmplitudes[0] = BeginStrength;
+	PositionalAmplitudes[1] = BeginStrength;
+	PositionalAmplitudes[2] = BeginStrength;
+	PositionalAmplitudes[3] = BeginStrength;
+	PositionalAmplitudes[4] = MiddleStrength;
+	PositionalAmplitudes[5] = MiddleStrength;
+	PositionalAmplitudes[6] = MiddleStrength;
+	PositionalAmplitudes[7] = MiddleStrength;
+	PositionalAmplitudes[8] = bKeepEffect ? 8 : EndStrength;
+	PositionalAmplitudes[9] = bKeepEffect ? 8 : EndStrength;
+
+	unsigned char Strengths[10];
+	for (int i = 0; i < 10; i++)
+	{
+		Strengths[i] = static_cast<uint64_t>(PositionalAmplitudes[i] * 8.0f);
+	}
+
+	int64 StrengthZones = 0;
+	int32 ActiveZones = 0;
+	for (int i = 0; i < 10; i++)
+	{
+		if (PositionalAmplitudes[i] > 0)
+		{
+			const uint64_t StrengthValue = static_cast<uint64_t>((Strengths[i] - 1) & 0x07);
+			StrengthZones |= static_cast<int64>(StrengthValue << (3 * i));
+			ActiveZones |= (1 << i);
+		}
+	}
+
+	FHapticTriggers Effect;
+	Effect.Mode = 0x26;
+	Effect.Strengths.ActiveZones = ActiveZones;
+	Effect.Strengths.StrengthZones = StrengthZones;
+	Effect.Frequency = UValidateHelpers::To255(0.05f);
+	return Effect;
+}
+
+FHapticTriggers FTriggerEffects::Vibration(const int32 StartPosition, const int32 Strength, const float Frequency)
+{
+	FHapticTriggers Effect;
+	Effect.Mode = 0x26;
+	for (int32 Zone = StartPosition; Zone < 10; ++Zone)
+	{
+		Effect.Strengths.ActiveZones |= 1 << Zone;
+		Effect.Strengths.StrengthZones |= static_cast<uint64>((Strength - 1) & 0x07) << (3 * Zone);
+	}
+	Effect.Frequency = UValidateHelpers::To255(Frequency);
+	return Effect;
+}
+
+FHapticTriggers FTriggerEffects::Build(const FSonyGamepadTriggerEffect& Effect)
+{
+	const int32 Start = FMath::Clamp(Effect.StartPosition, 0, 8);
+	const int32 End = FMath::Clamp(Effect.EndPosition, 0, 8);
+	const int32 Begin = FMath::Clamp(Effect.BeginStrength, 0, 8);
+	const int32 Middle = FMath::Clamp(Effect.MiddleStrength, 0, 8);
+	const int32 Last = FMath::Clamp(Effect.EndStrength, 0, 8);
+	const float Frequency = FMath::Clamp(Effect.Frequency, 0.0f, 1.0f);
+	switch (Effect.Effect)
+	{
+	case ESonyGamepadTriggerEffect::ContinuousResistance:
+		return ContinuousResistance(Start, Begin);
+	case ESonyGamepadTriggerEffect::Resistance:
+		return Resistance(Begin, Middle, Last);
+	case ESonyGamepadTriggerEffect::Weapon:
+		return Weapon(Start, End, Begin);
+	case ESonyGamepadTriggerEffect::Galloping:
+		return Galloping(Start, End, FMath::Clamp(Effect.FirstFoot, 0, 7), FMath::Clamp(Effect.SecondFoot, 0, 7), Frequency);
+	case ESonyGamepadTriggerEffect::Machine:
+		// Amplitudes are packed in 3 bits.
+		return Machine(Start, End, FMath::Min(Begin, 7), FMath::Min(Last, 7), Frequency, FMath::Clamp(Effect.Period, 0.0f, 3.0f));
+	case ESonyGamepadTriggerEffect::Bow:
+		// Strengths are stored minus one.
+		return Bow(Start, End, FMath::Max(Begin, 1), FMath::Max(Last, 1));
+	case ESonyGamepadTriggerEffect::AutomaticGun:
+		return AutomaticGun(Begin, Middle, Last, Effect.bKeepEffect);
+	default:
+		return FHapticTriggers();
+	}
+}
+
+void FTriggerEffects::Encode(const FHapticTriggers& Effect, unsigned char* OutBytes)
+{
+	FMemory::Memzero(OutBytes, SONY_GAMEPAD_TRIGGER_EFFECT_SIZE);
+	UDeviceHIDManager::SetTriggerEffects(OutBytes, Effect);
+}
+
+FHapticTriggers FTriggerEffects::FromEncoded(const unsigned char* Bytes)
+{
+	FHapticTriggers Effect;
+	Effect.Mode = Bytes[0];
+	Effect.bEncoded = true;
+	FMemory::Memcpy(Effect.Encoded, Bytes, SONY_GAMEPAD_TRIGGER_EFFECT_SIZE);
+	return Effect;
+}
+
+void FTriggerEffects::SetFrequency(FHapticTriggers& Effect, const unsigned char Frequency)
+{
+	Effect.Frequency = Frequency;
+	if (!Effect.bEncoded)
+	{
+		return;
+	}
+
+	// Offsets match UDeviceHIDManager::SetTriggerEffects.
+	switch (Effect.Mode)
+	{
+	case 0x23:
+	case 0x27:
+		Effect.Encoded[0x4] = Frequency;
+		break;
+	case 0x26:
+		Effect.Encoded[0x9] = Frequency;
+		break;
+	default:
+		break;
+	}
+}
@@ -0,0 +1,194 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Output/TriggerStack.h"
+
+#include "Core/Output/RumbleSequencer.h"
+#include "Core/Output/TriggerEffects.h"
+
+namespace
+{
+	/**
+	 * Effects whose strength can be scaled: continuous resistance, the multi-zone resistance and
+	 * automatic gun, which hold 3 bits per zone, and the machine, which holds two 3 bit amplitudes.
+	 * Encoded effects only carry their final bytes.
+	 */
+	bool IsScalable(const FHapticTriggers& Effect)
+	{
+		return !Effect.bEncoded && (Effect.Mode == 0x01 || Effect.Mode == 0x21 || Effect.Mode == 0x26 || Effect.Mode == 0x27);
+	}
+
+	FHapticTriggers ScaleEffect(const FHapticTriggers& Effect, const float Weight)
+	{
+		FHapticTriggers Scaled = Effect;
+		switch (Effect.Mode)
+		{
+		case 0x01:
+			Scaled.Strengths.StrengthZones = FMath::RoundToInt((Effect.Strengths.StrengthZones & 0xFF) * Weight);
+			break;
+		case 0x21:
+		case 0x26:
+			for (int32 Zone = 0; Zone < 10; ++Zone)
+			{
+				if (!(Effect.Strengths.ActiveZones & (1 << Zone)))
+				{
+					continue;
+				}
+				// Zones store their strength minus one.
+				const int32 Strength = FMath::RoundToInt((((Effect.Strengths.StrengthZones >> (3 * Zone)) & 0x07) + 1) * Weight);
+				Scaled.Strengths.StrengthZones &= ~(static_cast<uint64>(0x07) << (3 * Zone));
+				if (Strength <= 0)
+				{
+					Scaled.Strengths.ActiveZones &= ~(1 << Zone);
+					continue;
+				}
+				Scaled.Strengths.StrengthZones |= static_cast<uint64>(Strength - 1) << (3 * Zone);
+			}
+			break;
+		case 0x27:
+			{
+				const int32 Begin = FMath::RoundToInt((Effect.Strengths.StrengthZones & 0x07) * Weight);
+				const int32 End = FMath::RoundToInt(((Effect.Strengths.StrengthZones >> 3) & 0x07) * Weight);
+				Scaled.Strengths.StrengthZones = (Begin & 0x07) | ((End & 0x07) << 3);
+			}
+			break;
+		default:
+			break;
+		}
+		return Scaled;
+	}
+}
+
+void FTriggerStack::Set(const bool bRightTrigger, const FSonyGamepadTriggerLayer& Layer, const FHapticTriggers& Effect, const double Time)
+{
+	const int32 Index = static_cast<int32>(Layer.Layer);
+	if (Index < 0 || Index >= SONY_GAMEPAD_TRIGGER_LAYERS)
+	{
+		return;
+	}
+
+	FEntry& Entry = (bRightTrigger ? Right : Left)[Index];
+	if (Effect.Mode == 0x0)
+	{
+		if (Entry.bActive && Layer.FadeOut > 0.0f)
+		{
+			// Cleared with a fade: the lifetime ends now, unless it already ended.
+			Entry.Expire = Entry.Expire >= 0.0 ? FMath::Min(Entry.Expire, Time) : Time;
+			Entry.FadeOut = Layer.FadeOut;
+			return;
+		}
+		Entry = FEntry();
+		return;
+	}
+
+	Entry.Effect = Effect;
+	Entry.Priority = Layer.Priority;
+	Entry.Expire = Layer.Lifetime > 0.0f ? Time + Layer.Lifetime : -1.0;
+	Entry.FadeOut = FMath::Max(Layer.FadeOut, 0.0f);
+	Entry.bActive = true;
+}
+
+void FTriggerStack::SetFrequency(const bool bRightTrigger, const ESonyGamepadTriggerLayer Layer, const unsigned char Frequency)
+{
+	const int32 Index = static_cast<int32>(Layer);
+	if (Index < 0 || Index >= SONY_GAMEPAD_TRIGGER_LAYERS)
+	{
+		return;
+	}
+
+	FEntry& Entry = (bRightTrigger ? Right : Left)[Index];
+	if (Entry.bActive)
+	{
+		FTriggerEffects::SetFrequency(Entry.Effect, Frequency);
+	}
+}
+
+bool FTriggerStack::Resolve(const double Now, FHapticTriggers& OutLeft, FHapticTriggers& OutRight, double& OutNextTime)
+{
+	bool bTimed = false;
+	OutNextTime = TNumericLimits<double>::Max();
+	ResolveTrigger(Left, Now, OutLeft, bTimed, OutNextTime);
+	ResolveTrigger(Right, Now, OutRight, bTimed, OutNextTime);
+	return bTimed;
+}
+
+void FTriggerStack::Reset()
+{
+	for (int32 Index = 0; Index < SONY_GAMEPAD_TRIGGER_LAYERS; ++Index)
+	{
+		Left[Index] = FEntry();
+		Right[Index] = FEntry();
+	}
+}
+
+float FTriggerStack::GetWeight(const FEntry& Entry, const double Now)
+{
+	if (Entry.Expire < 0.0 || Now < Entry.Expire)
+	{
+		return 1.0f;
+	}
+	if (Entry.FadeOut <= 0.0f)
+	{
+		return 0.0f;
+	}
+	return static_cast<float>(FMath::Clamp(1.0 - (Now - Entry.Expire) / Entry.FadeOut, 0.0, 1.0));
+}
+
+void FTriggerStack::ResolveTrigger(FEntry (&Layers)[SONY_GAMEPAD_TRIGGER_LAYERS], const double Now, FHapticTriggers& OutEffect, bool& bOutTimed,
+                                   double& OutNextTime)
+{
+	// Insertion sort of the live layers, highest priority first, the upper layer first on a tie.
+	int32 Order[SONY_GAMEPAD_TRIGGER_LAYERS];
+	float Weights[SONY_GAMEPAD_TRIGGER_LAYERS];
+	int32 Num = 0;
+	for (int32 Index = SONY_GAMEPAD_TRIGGER_LAYERS - 1; Index >= 0; --Index)
+	{
+		FEntry& Entry = Layers[Index];
+		if (!Entry.bActive)
+		{
+			continue;
+		}
+
+		const float Weight = GetWeight(Entry, Now);
+		if (Weight <= 0.0f)
+		{
+			Entry = FEntry();
+			continue;
+		}
+
+		if (Entry.Expire >= 0.0)
+		{
+			bOutTimed = true;
+			const double NextSample = (FMath::FloorToDouble(Now * SONY_GAMEPAD_RUMBLE_SAMPLE_RATE) + 1.0) / SONY_GAMEPAD_RUMBLE_SAMPLE_RATE;
+			OutNextTime = FMath::Min(OutNextTime, Now < Entry.Expire ? Entry.Expire : NextSample);
+		}
+
+		int32 Slot = Num++;
+		while (Slot > 0 && Layers[Order[Slot - 1]].Priority < Entry.Priority)
+		{
+			Order[Slot] = Order[Slot - 1];
+			Weights[Slot] = Weights[Slot - 1];
+			--Slot;
+		}
+		Order[Slot] = Index;
+		Weights[Slot] = Weight;
+	}
+
+	OutEffect = FHapticTriggers();
+	for (int32 Rank = 0; Rank < Num; ++Rank)
+	{
+		const FHapticTriggers& Effect = Layers[Order[Rank]].Effect;
+		const bool bScalable = IsScalable(Effect);
+		const bool bLast = Rank == Num - 1;
+		// Halfway through its fade, an effect hands over to the layer below. With no layer below, it fades
+		// to nothing if its strength scales, or stops there otherwise.
+		if (Weights[Rank] < 0.5f && (!bLast || !bScalable))
+		{
+			continue;
+		}
+
+		OutEffect = bScalable && Weights[Rank] < 1.0f ? ScaleEffect(Effect, Weights[Rank]) : Effect;
+		return;
+	}
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Output/TriggerTimelinePlayer.h"
+
+#include "Core/Output/TriggerStack.h"
+
+void FTriggerTimelinePlayer::Play(const FTriggerTimelinePlayback& Playback)
+{
+	FRequest Request;
+	Request.Playback = Playback;
+	Request.Time = FPlatformTime::Seconds();
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+void FTriggerTimelinePlayer::Stop()
+{
+	FRequest Request;
+	Request.Time = FPlatformTime::Seconds();
+	Request.bStop = true;
+	Requests.Enqueue(MoveTemp(Request));
+}
+
+bool FTriggerTimelinePlayer::Evaluate(const double Now, FTriggerStack& Triggers, double& OutNextTime)
+{
+	FRequest Request;
+	while (Requests.Dequeue(Request))
+	{
+		Finish(Triggers, Request.Time);
+		if (!Request.bStop && Request.Playback.Timeline.IsValid())
+		{
+			Current = MoveTemp(Request.Playback);
+			CycleStart = Current.StartTime;
+			NextKey = 0;
+		}
+	}
+
+	if (!Current.Timeline.IsValid())
+	{
+		return false;
+	}
+
+	const FTriggerTimeline& Timeline = *Current.Timeline;
+	while (true)
+	{
+		for (; NextKey < Timeline.Keys.Num() && CycleStart + Timeline.Keys[NextKey].Time <= Now; ++NextKey)
+		{
+			const FTriggerTimeline::FKey& Key = Timeline.Keys[NextKey];
+			if (Key.bLeft)
+			{
+				Triggers.Set(false, Timeline.Layer, Key.Effect, CycleStart + Key.Time);
+			}
+			if (Key.bRight)
+			{
+				Triggers.Set(true, Timeline.Layer, Key.Effect, CycleStart + Key.Time);
+			}
+		}
+
+		const double CycleEnd = CycleStart + Timeline.Duration;
+		if (NextKey < Timeline.Keys.Num() || Now < CycleEnd)
+		{
+			break;
+		}
+
+		if (!Current.bLoop || Timeline.Duration <= 0.0)
+		{
+			if (Timeline.bHoldLastEffect)
+			{
+				Current = FTriggerTimelinePlayback();
+			}
+			else
+			{
+				Finish(Triggers, CycleEnd);
+			}
+			return false;
+		}
+
+		// After a stall, the cycles that were missed entirely are skipped rather than replayed.
+		CycleStart = Now - CycleEnd >= Timeline.Duration ? CycleStart + FMath::FloorToDouble((Now - CycleStart) / Timeline.Duration) * Timeline.Duration : CycleEnd;
+		NextKey = 0;
+	}
+
+	OutNextTime = NextKey < Timeline.Keys.Num() ? CycleStart + Timeline.Keys[NextKey].Time : CycleStart + Timeline.Duration;
+	return true;
+}
+
+void FTriggerTimelinePlayer::Reset()
+{
+	Requests.Empty();
+	Current = FTriggerTimelinePlayback();
+	NextKey = 0;
+}
+
+void FTriggerTimelinePlayer::Finish(FTriggerStack& Triggers, const double Time)
+{
+	if (!Current.Timeline.IsValid())
+	{
+		return;
+	}
+
+	bool bLeft = false;
+	bool bRight = false;
+	for (const FTriggerTimeline::FKey& Key : Current.Timeline->Keys)
+	{
+		bLeft |= Key.bLeft;
+		bRight |= Key.bRight;
+	}
+
+	// An effect of mode 0 clears the layer, with the fade out of the timeline.
+	if (bLeft)
+	{
+		Triggers.Set(false, Current.Timeline->Layer, FHapticTriggers(), Time);
+	}
+	if (bRight)
+	{
+		Triggers.Set(true, Current.Timeline->Layer, FHapticTriggers(), Time);
+	}
+	Current = FTriggerTimelinePlayback();
+}
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/Rendering/SonyGamepadViewExtension.h"
+
+#include "RenderingThread.h"
+#include "SceneView.h"
+#include "Core/Input/SonyGamepadStateRegistry.h"
+
+FSonyGamepadViewExtension::FSonyGamepadViewExtension(const FAutoRegister& AutoRegister)
+	: FSceneViewExtensionBase(AutoRegister)
+{
+}
+
+void FSonyGamepadViewExtension::BeginRenderViewFamily(FSceneViewFamily& InViewFamily)
+{
+	FLatchSample Sample;
+	Sample.Settings = Settings;
+	Sample.Time = FPlatformTime::Seconds();
+
+	FSonyGamepadInputState State;
+	Sample.bValid = FSonyGamepadStateRegistry::GetLatestState(Settings.ControllerId, State);
+	Sample.Orientation = State.Orientation;
+
+	// Render commands run in order, so the render thread sees the sample of the family it renders.
+	TSharedRef<FSonyGamepadViewExtension, ESPMode::ThreadSafe> Self = StaticCastSharedRef<FSonyGamepadViewExtension>(AsShared());
+	ENQUEUE_RENDER_COMMAND(SonyGamepadLateLatchSample)(
+		[Self, Sample](FRHICommandListImmediate& RHICmdList)
+		{
+			Self->GameSample_RenderThread = Sample;
+		});
+}
+
+void FSonyGamepadViewExtension::PreRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily)
+{
+	Correction_RenderThread = FRotator::ZeroRotator;
+
+	const FLatchSample& Sample = GameSample_RenderThread;
+	FSonyGamepadInputState State;
+	if (!Sample.bValid || !FSonyGamepadStateRegistry::GetLatestState(Sample.Settings.ControllerId, State))
+	{
+		return;
+	}
+
+	// Rotation since the sample, in the frame of the controller: Y turns around the vertical axis and X around
+	// the lateral one. A positive Y rotation turns left.
+	const FVector3f GyroDelta = (Sample.Orientation.Inverse() * State.Orientation).ToRotationVector() * (180.0f / UE_PI);
+	const float Elapsed = static_cast<float>(FPlatformTime::Seconds() - Sample.Time);
+	const float MaxCorrection = Sample.Settings.MaxCorrection;
+
+	const float Pitch = GyroDelta.X * Sample.Settings.GyroPitchScale + State.RightStick.Y * Sample.Settings.StickPitchRate * Elapsed;
+	const float Yaw = -GyroDelta.Y * Sample.Settings.GyroYawScale + State.RightStick.X * Sample.Settings.StickYawRate * Elapsed;
+	Correction_RenderThread = FRotator(FMath::Clamp(Pitch, -MaxCorrection, MaxCorrection), FMath::Clamp(Yaw, -MaxCorrection, MaxCorrection), 0.0f);
+}
+
+void FSonyGamepadViewExtension::PreRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView)
+{
+	const FLatchSample& Sample = GameSample_RenderThread;
+	if (!Sample.bValid || !InView.bIsGameView || Correction_RenderThread.IsNearlyZero())
+	{
+		return;
+	}
+
+	if (Sample.Settings.PlayerIndex >= 0 && InView.PlayerIndex != Sample.Settings.PlayerIndex)
+	{
+		return;
+	}
+
+	InView.ViewRotation += Correction_RenderThread;
+	InView.UpdateViewMatrix();
+}
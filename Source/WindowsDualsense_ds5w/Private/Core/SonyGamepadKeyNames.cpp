@@ -0,0 +1,42 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Core/SonyGamepadKeyNames.h"
+
+const FName FSonyGamepadKeyNames::Mic("PS_Mic");
+const FName FSonyGamepadKeyNames::Menu("PS_Menu");
+const FName FSonyGamepadKeyNames::Share("PS_Share");
+const FName FSonyGamepadKeyNames::TouchButton("PS_TouchButtom");
+const FName FSonyGamepadKeyNames::PlayStationButton("PS_Button");
+const FName FSonyGamepadKeyNames::PushLeftStick("PS_PushLeftStick");
+const FName FSonyGamepadKeyNames::PushRightStick("PS_PushRightStick");
+const FName FSonyGamepadKeyNames::FunctionL("PS_FunctionL");
+const FName FSonyGamepadKeyNames::FunctionR("PS_FunctionR");
+const FName FSonyGamepadKeyNames::PaddleL("PS_PaddleL");
+const FName FSonyGamepadKeyNames::PaddleR("PS_PaddleR");
+const FName FSonyGamepadKeyNames::TouchTap("PS_TouchTap");
+const FName FSonyGamepadKeyNames::TouchTwoFingerTap("PS_TouchTwoFingerTap");
+const FName FSonyGamepadKeyNames::TouchSwipeLeft("PS_TouchSwipeLeft");
+const FName FSonyGamepadKeyNames::TouchSwipeRight("PS_TouchSwipeRight");
+const FName FSonyGamepadKeyNames::TouchSwipeUp("PS_TouchSwipeUp");
+const FName FSonyGamepadKeyNames::TouchSwipeDown("PS_TouchSwipeDown");
+const FName FSonyGamepadKeyNames::TouchPinchIn("PS_TouchPinchIn");
+const FName FSonyGamepadKeyNames::TouchPinchOut("PS_TouchPinchOut");
+const FName FSonyGamepadKeyNames::GyroPitch("PS_GyroPitch");
+const FName FSonyGamepadKeyNames::GyroYaw("PS_GyroYaw");
+const FName FSonyGamepadKeyNames::GyroRoll("PS_GyroRoll");
+const FName FSonyGamepadKeyNames::Gyro("PS_Gyro");
+const FName FSonyGamepadKeyNames::TiltPitch("PS_TiltPitch");
+const FName FSonyGamepadKeyNames::TiltYaw("PS_TiltYaw");
+const FName FSonyGamepadKeyNames::TiltRoll("PS_TiltRoll");
+const FName FSonyGamepadKeyNames::Tilt("PS_Tilt");
+const FName FSonyGamepadKeyNames::GravityX("PS_GravityX");
+const FName FSonyGamepadKeyNames::GravityY("PS_GravityY");
+const FName FSonyGamepadKeyNames::GravityZ("PS_GravityZ");
+const FName FSonyGamepadKeyNames::Touch1X("PS_Touch1X");
+const FName FSonyGamepadKeyNames::Touch1Y("PS_Touch1Y");
+const FName FSonyGamepadKeyNames::Touch1("PS_Touch1");
+const FName FSonyGamepadKeyNames::Touch2X("PS_Touch2X");
+const FName FSonyGamepadKeyNames::Touch2Y("PS_Touch2Y");
+const FName FSonyGamepadKeyNames::Touch2("PS_Touch2");
@@ -19,10 +19,12 @@ DeviceManager::DeviceManager(const TSharedRef<FGenericApplicationMessageHandler>
 	DeviceMapper = FWindowsPlatformApplicationMisc::CreatePlatformInputDeviceManager();
 	DeviceMapper->Get().GetOnInputDeviceConnectionChange().AddRaw(this, &DeviceManager::OnConnectionChange);
 	FCoreDelegates::OnUserLoginChangedEvent.AddRaw(this, &DeviceManager::OnUserLoginChangedEvent);
+	FCoreDelegates::OnBeginFrame.AddRaw(this, &DeviceManager::OnBeginFrame);
 }
 
 DeviceManager::~DeviceManager()
 {
+	FCoreDelegates::OnBeginFrame.RemoveAll(this);
 	FCoreDelegates::OnUserLoginChangedEvent.RemoveAll(this);
 	DeviceMapper->Get().GetOnInputDeviceConnectionChange().RemoveAll(this);
 }
@@ -31,51 +33,116 @@ void DeviceManager::Tick(float DeltaTime)
 {
 	if (LazyLoading) return;
 
-	PollAccumulator += DeltaTime;
-	if (PollAccumulator < PollInterval)
+	if (SamplingPoint == EInputSamplingPoint::Tick)
 	{
+		PollDevices();
+	}
+}
+
+void DeviceManager::SendControllerEvents()
+{
+	if (LazyLoading) return;
+
+	if (SamplingPoint == EInputSamplingPoint::SendControllerEvents)
+	{
+		PollDevices();
+	}
+}
+
+void DeviceManager::OnBeginFrame()
+{
+	if (LazyLoading) return;
+
+	if (SamplingPoint == EInputSamplingPoint::FrameBegin)
+	{
+		PollDevices();
+	}
+}
+
+void DeviceManager::PollDevices()
+{
+	if (UDeviceContainerManager::GetAllocatedDevices() == 0)
+	{
+		DetectedReportRate = 0.0f;
 		return;
 	}
-	
-	PollAccumulator = 0.0f;
-	
-	TArray<FInputDeviceId> OutInputDevices;
-	OutInputDevices.Reset();
 
-	DeviceMapper->Get().GetAllConnectedInputDevices(OutInputDevices);
-	for (const FInputDeviceId& DeviceId : OutInputDevices)
+	if (bDeviceBindingsDirty)
 	{
-		const FInputDeviceId& Device = FInputDeviceId::CreateFromInternalId(DeviceId.GetId());
-		const FPlatformUserId& UserId = IPlatformInputDeviceMapper::Get().GetUserForInputDevice(Device);
+		RefreshDeviceBindings();
+	}
 
-		if (const int32 ControllerId = FPlatformMisc::GetUserIndexForPlatformUser(UserId); ControllerId == -1)
-		{
-			continue;
-		}
+	static const FName DeviceScopeName(TEXT("DeviceManager"));
 
-		ISonyGamepadInterface* Gamepad = UDeviceContainerManager::Get()->GetLibraryInstance(DeviceId.GetId());
+	float MaxReportRate = 0.0f;
+	for (FDeviceBinding& Binding : DeviceBindings)
+	{
+		ISonyGamepadInterface* Gamepad = UDeviceContainerManager::Get()->GetLibraryInstance(Binding.Device.GetId());
 		if (!Gamepad)
 		{
-			Disconnect(DeviceId);
+			Disconnect(Binding.Device);
+			bDeviceBindingsDirty = true;
 			continue;
 		}
 
-		FString ContextDrive = TEXT("DualSense");
-		if (Gamepad->GetDeviceType() == EDeviceType::DualShock4)
+		if (Binding.HardwareDeviceIdentifier.IsEmpty())
 		{
-			ContextDrive = TEXT("DualShock4");
+			Binding.HardwareDeviceIdentifier = GetHardwareDeviceIdentifier(Gamepad->GetDeviceType());
 		}
-		if (Gamepad->GetDeviceType() == EDeviceType::DualSenseEdge)
+
+		// The scope takes the identifier by value. The cached string is moved in and taken back once the
+		// device is polled, so its buffer is reused instead of being copied on every poll.
+		FInputDeviceScope InputScope(this, DeviceScopeName, Binding.Device.GetId(), MoveTemp(Binding.HardwareDeviceIdentifier));
+		Gamepad->SetPollingPolicy(PollingPolicy, FixedPollRate);
+		const bool bUpdated = Gamepad->UpdateInput(MessageHandler, Binding.User, Binding.Device);
+		Binding.HardwareDeviceIdentifier = MoveTemp(InputScope.HardwareDeviceIdentifier);
+		if (!bUpdated)
 		{
-			ContextDrive = TEXT("DualSenseEdge");
+			Disconnect(Binding.Device);
+			UDeviceContainerManager::Get()->RemoveLibraryInstance(Binding.Device.GetId());
+			bDeviceBindingsDirty = true;
+			continue;
 		}
-	
-		FInputDeviceScope InputScope(this, TEXT("DeviceManager"), Device.GetId(), ContextDrive);
-		if (!Gamepad->UpdateInput(MessageHandler, UserId, Device))
+
+		MaxReportRate = FMath::Max(MaxReportRate, Gamepad->GetReportRate());
+	}
+
+	DetectedReportRate = MaxReportRate;
+}
+
+void DeviceManager::RefreshDeviceBindings()
+{
+	bDeviceBindingsDirty = false;
+
+	ConnectedDevices.Reset();
+	DeviceBindings.Reset();
+	DeviceMapper->Get().GetAllConnectedInputDevices(ConnectedDevices);
+	for (const FInputDeviceId& Device : ConnectedDevices)
+	{
+		const FPlatformUserId UserId = DeviceMapper->Get().GetUserForInputDevice(Device);
+		if (FPlatformMisc::GetUserIndexForPlatformUser(UserId) == -1)
 		{
-			Disconnect(DeviceId);
-			UDeviceContainerManager::Get()->RemoveLibraryInstance(DeviceId.GetId());
+			continue;
 		}
+
+		DeviceBindings.Add({Device, UserId, FString()});
+	}
+}
+
+const FString& DeviceManager::GetHardwareDeviceIdentifier(const EDeviceType DeviceType)
+{
+	static const FString DualSense(TEXT("DualSense"));
+	static const FString DualSenseEdge(TEXT("DualSenseEdge"));
+	static const FString DualShock4(TEXT("DualShock4"));
+
+	switch (DeviceType)
+	{
+		case EDeviceType::DualShock4:
+			return DualShock4;
+		case EDeviceType::DualSenseEdge:
+			return DualSenseEdge;
+		default:
+			return DualSense;
 	}
 }
 
@@ -173,8 +240,10 @@ void DeviceManager::Disconnect(const FInputDeviceId& Device) const
 }
 
 void DeviceManager::OnConnectionChange(EInputDeviceConnectionState Connected, FPlatformUserId PlatformUserId,
-											  FInputDeviceId InputDeviceId) const
+											  FInputDeviceId InputDeviceId)
 {
+	bDeviceBindingsDirty = true;
+
 	const bool bIsConnected = (Connected == EInputDeviceConnectionState::Connected);
 	if (DeviceMapper->Get().GetInputDeviceConnectionState(InputDeviceId) != EInputDeviceConnectionState::Connected &&
 		bIsConnected)
@@ -190,8 +259,9 @@ void DeviceManager::OnConnectionChange(EInputDeviceConnectionState Connected, FP
 	}
 }
 
-void DeviceManager::OnUserLoginChangedEvent(bool bLoggedIn, int32 UserId, int32 UserIndex) const
+void DeviceManager::OnUserLoginChangedEvent(bool bLoggedIn, int32 UserId, int32 UserIndex)
 {
+	bDeviceBindingsDirty = true;
 	if (!bLoggedIn) return;
 
 	const FInputDeviceId& Device = FInputDeviceId::CreateFromInternalId(UserId);
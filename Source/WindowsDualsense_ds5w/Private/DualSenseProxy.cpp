@@ -4,13 +4,35 @@
 
 #include "DualSenseProxy.h"
 
+#include "Core/Assets/SonyGamepadTriggerPreset.h"
+#include "Core/Assets/SonyGamepadTriggerTimeline.h"
 #include "Core/DeviceContainerManager.h"
 #include "Core/DualSense/DualSenseLibrary.h"
 #include "Core/Interfaces/SonyGamepadInterface.h"
 #include "Core/Interfaces/SonyGamepadTriggerInterface.h"
+#include "Core/Output/OutputScheduler.h"
+#include "Core/Output/TriggerEffects.h"
 #include "Helpers/ValidateHelpers.h"
 #include "Runtime/ApplicationCore/Public/GenericPlatform/IInputInterface.h"
 
+namespace
+{
+	int32 BroadcastTrigger(const FSonyGamepadBroadcastTarget& Target, const FHapticTriggers& Effect, const EControllerHand Hand)
+	{
+		TArray<FOutputCommand, TInlineAllocator<2>> Commands;
+		if (Hand == EControllerHand::Left || Hand == EControllerHand::AnyHand)
+		{
+			FOutputCommand& Command = Commands.Emplace_GetRef(EOutputCommand::LeftTrigger);
+			Command.Trigger = Effect;
+		}
+		if (Hand == EControllerHand::Right || Hand == EControllerHand::AnyHand)
+		{
+			FOutputCommand& Command = Commands.Emplace_GetRef(EOutputCommand::RightTrigger);
+			Command.Trigger = Effect;
+		}
+		return FOutputScheduler::Get().Broadcast(Target, Commands);
+	}
+}
 
 void UDualSenseProxy::DeviceSettings(int32 ControllerId, FDualSenseFeatureReport Settings)
 {
@@ -39,6 +61,16 @@ void UDualSenseProxy::LedPlayerEffects(int32 ControllerId, ELedPlayerEnum Value,
 	Gamepad->SetPlayerLed(Value, Brightness);
 }
 
+bool UDualSenseProxy::PlayPlayerLedAnimation(int32 ControllerId, const FSonyGamepadPlayerLedAnimation& Animation, float Delay)
+{
+	return FOutputScheduler::Get().PlayPlayerLedAnimation(ControllerId, Animation, FPlatformTime::Seconds() + FMath::Max(Delay, 0.0f));
+}
+
+void UDualSenseProxy::StopPlayerLedAnimation(int32 ControllerId)
+{
+	FOutputScheduler::Get().StopPlayerLedAnimation(ControllerId);
+}
+
 void UDualSenseProxy::SetVibrationFromAudio(
 	const int32 ControllerId,
 	const float AverageEnvelopeValue,
@@ -67,7 +99,7 @@ void UDualSenseProxy::SetVibrationFromAudio(
 }
 
 void UDualSenseProxy::SetFeedback(int32 ControllerId, int32 BeginStrength,
-                                  int32 MiddleStrength, int32 EndStrength, EControllerHand Hand)
+                                  int32 MiddleStrength, int32 EndStrength, EControllerHand Hand, const FSonyGamepadTriggerLayer& Layer)
 {
 	ISonyGamepadTriggerInterface* Gamepad = Cast<ISonyGamepadTriggerInterface>(UDeviceContainerManager::Get()->GetLibraryInstance(ControllerId));
 	if (!Gamepad)
@@ -75,10 +107,10 @@ void UDualSenseProxy::SetFeedback(int32 ControllerId, int32 BeginStrength,
 		return;
 	}
 
-	return Gamepad->SetResistance(BeginStrength, MiddleStrength, EndStrength, Hand);
+	return Gamepad->SetResistance(BeginStrength, MiddleStrength, EndStrength, Hand, Layer);
 }
 
-void UDualSenseProxy::Resistance(int32 ControllerId, int32 StartPosition, int32 EndPosition, int32 Strength, EControllerHand Hand)
+void UDualSenseProxy::Resistance(int32 ControllerId, int32 StartPosition, int32 EndPosition, int32 Strength, EControllerHand Hand, const FSonyGamepadTriggerLayer& Layer)
 {
 	if (!UValidateHelpers::ValidateMaxPosition(StartPosition)) StartPosition = 0;
 	if (!UValidateHelpers::ValidateMaxPosition(EndPosition)) EndPosition = 8;
@@ -90,10 +122,10 @@ void UDualSenseProxy::Resistance(int32 ControllerId, int32 StartPosition, int32
 		return;
 	}
 	
-	Gamepad->SetResistance(StartPosition, EndPosition, Strength, Hand);
+	Gamepad->SetResistance(StartPosition, EndPosition, Strength, Hand, Layer);
 }
 
-void UDualSenseProxy::AutomaticGun(int32 ControllerId, int32 BeginStrength, int32 MiddleStrength, int32 EndStrength, EControllerHand Hand, bool KeepEffect)
+void UDualSenseProxy::AutomaticGun(int32 ControllerId, int32 BeginStrength, int32 MiddleStrength, int32 EndStrength, EControllerHand Hand, bool KeepEffect, const FSonyGamepadTriggerLayer& Layer)
 {
 	if (!UValidateHelpers::ValidateMaxPosition(BeginStrength)) BeginStrength = 8;
 	if (!UValidateHelpers::ValidateMaxPosition(MiddleStrength)) MiddleStrength = 8;
@@ -105,10 +137,10 @@ void UDualSenseProxy::AutomaticGun(int32 ControllerId, int32 BeginStrength, int3
 		return;
 	}
 	
-	Gamepad->SetAutomaticGun(BeginStrength, MiddleStrength, EndStrength, Hand, KeepEffect);
+	Gamepad->SetAutomaticGun(BeginStrength, MiddleStrength, EndStrength, Hand, KeepEffect, Layer);
 }
 
-void UDualSenseProxy::ContinuousResistance(int32 ControllerId, int32 StartPosition, int32 Strength, EControllerHand Hand)
+void UDualSenseProxy::ContinuousResistance(int32 ControllerId, int32 StartPosition, int32 Strength, EControllerHand Hand, const FSonyGamepadTriggerLayer& Layer)
 {
 	if (!UValidateHelpers::ValidateMaxPosition(StartPosition)) StartPosition = 0;
 	if (!UValidateHelpers::ValidateMaxPosition(Strength)) Strength = 8;
@@ -119,12 +151,12 @@ void UDualSenseProxy::ContinuousResistance(int32 ControllerId, int32 StartPositi
 		return;
 	}
 	
-	Gamepad->SetContinuousResistance(StartPosition, Strength, Hand);
+	Gamepad->SetContinuousResistance(StartPosition, Strength, Hand, Layer);
 }
 
 void UDualSenseProxy::Galloping(
 	int32 ControllerId, int32 StartPosition, int32 EndPosition, int32 FirstFoot,
-                                int32 SecondFoot, float Frequency, EControllerHand Hand)
+                                int32 SecondFoot, float Frequency, EControllerHand Hand, const FSonyGamepadTriggerLayer& Layer)
 {
 	if (!UValidateHelpers::ValidateMaxPosition(StartPosition)) StartPosition = 0;
 	if (!UValidateHelpers::ValidateMaxPosition(EndPosition)) EndPosition = 8;
@@ -137,11 +169,11 @@ void UDualSenseProxy::Galloping(
 		return;
 	}
 	
-	Gamepad->SetGalloping(StartPosition, EndPosition, FirstFoot, SecondFoot, Frequency, Hand);
+	Gamepad->SetGalloping(StartPosition, EndPosition, FirstFoot, SecondFoot, Frequency, Hand, Layer);
 }
 
 void UDualSenseProxy::Machine(int32 ControllerId, int32 StartPosition, int32 EndPosition, int32 FirstFoot,
-                              int32 LasFoot, float Frequency, float Period, EControllerHand Hand)
+                              int32 LasFoot, float Frequency, float Period, EControllerHand Hand, const FSonyGamepadTriggerLayer& Layer)
 {
 	if (!UValidateHelpers::ValidateMaxPosition(StartPosition)) StartPosition = 0;
 	if (!UValidateHelpers::ValidateMaxPosition(EndPosition)) EndPosition = 8;
@@ -154,11 +186,11 @@ void UDualSenseProxy::Machine(int32 ControllerId, int32 StartPosition, int32 End
 		return;
 	}
 
-	Gamepad->SetMachine(StartPosition, EndPosition, FirstFoot, LasFoot, Frequency, Period, Hand);
+	Gamepad->SetMachine(StartPosition, EndPosition, FirstFoot, LasFoot, Frequency, Period, Hand, Layer);
 }
 
 void UDualSenseProxy::Weapon(int32 ControllerId, int32 StartPosition, int32 EndPosition, int32 Strength,
-	EControllerHand Hand)
+	EControllerHand Hand, const FSonyGamepadTriggerLayer& Layer)
 {
 	if (!UValidateHelpers::ValidateMaxPosition(StartPosition)) StartPosition = 0;
 	if (!UValidateHelpers::ValidateMaxPosition(EndPosition)) EndPosition = 8;
@@ -170,11 +202,11 @@ void UDualSenseProxy::Weapon(int32 ControllerId, int32 StartPosition, int32 EndP
 		return;
 	}
 
-	Gamepad->SetWeapon(StartPosition, EndPosition, Strength, Hand);
+	Gamepad->SetWeapon(StartPosition, EndPosition, Strength, Hand, Layer);
 }
 
 void UDualSenseProxy::Bow(int32 ControllerId, int32 StartPosition, int32 EndPosition, int32 BeginStrength, int32 EndStrength,
-                          EControllerHand Hand)
+                          EControllerHand Hand, const FSonyGamepadTriggerLayer& Layer)
 {
 	if (!UValidateHelpers::ValidateMaxPosition(StartPosition)) StartPosition = 0;
 	if (!UValidateHelpers::ValidateMaxPosition(EndPosition)) EndPosition = 8;
@@ -187,7 +219,7 @@ void UDualSenseProxy::Bow(int32 ControllerId, int32 StartPosition, int32 EndPosi
 		return;
 	}
 
-	Gamepad->SetBow(StartPosition, EndPosition, BeginStrength, EndStrength, Hand);
+	Gamepad->SetBow(StartPosition, EndPosition, BeginStrength, EndStrength, Hand, Layer);
 }
 
 void UDualSenseProxy::NoResistance(int32 ControllerId, EControllerHand Hand)
@@ -223,6 +255,70 @@ void UDualSenseProxy::StopAllTriggersEffects(const int32 ControllerId)
 	Gamepad->StopTrigger(EControllerHand::AnyHand);
 }
 
+void UDualSenseProxy::ClearTriggerLayer(int32 ControllerId, ESonyGamepadTriggerLayer Layer, EControllerHand Hand, float FadeOut)
+{
+	ISonyGamepadTriggerInterface* Gamepad = Cast<ISonyGamepadTriggerInterface>(UDeviceContainerManager::Get()->GetLibraryInstance(ControllerId));
+	if (!Gamepad)
+	{
+		return;
+	}
+
+	Gamepad->ClearTriggerLayer(Layer, Hand, FadeOut);
+}
+
+void UDualSenseProxy::ApplyTriggerPreset(int32 ControllerId, USonyGamepadTriggerPreset* Preset, EControllerHand Hand, const FSonyGamepadTriggerLayer& Layer)
+{
+	if (!IsValid(Preset))
+	{
+		return;
+	}
+
+	ISonyGamepadTriggerInterface* Gamepad = Cast<ISonyGamepadTriggerInterface>(UDeviceContainerManager::Get()->GetLibraryInstance(ControllerId));
+	if (!Gamepad)
+	{
+		return;
+	}
+
+	Gamepad->SetTriggerEffect(Preset->GetEffect(), Hand, Layer);
+}
+
+bool UDualSenseProxy::PlayTriggerTimeline(int32 ControllerId, USonyGamepadTriggerTimeline* Timeline, bool bLoop)
+{
+	if (!IsValid(Timeline))
+	{
+		return false;
+	}
+
+	FTriggerTimelinePlayback Playback;
+	Playback.Timeline = Timeline->GetTimeline();
+	Playback.StartTime = FPlatformTime::Seconds();
+	Playback.bLoop = bLoop;
+	return FOutputScheduler::Get().PlayTriggerTimeline(ControllerId, Playback);
+}
+
+void UDualSenseProxy::StopTriggerTimeline(int32 ControllerId)
+{
+	FOutputScheduler::Get().StopTriggerTimeline(ControllerId);
+}
+
+int32 UDualSenseProxy::BroadcastTriggerEffect(const FSonyGamepadBroadcastTarget& Target, const FSonyGamepadTriggerEffect& Effect, EControllerHand Hand)
+{
+	// Encoded here once, so every controller only copies the bytes.
+	unsigned char Bytes[SONY_GAMEPAD_TRIGGER_EFFECT_SIZE];
+	FTriggerEffects::Encode(FTriggerEffects::Build(Effect), Bytes);
+	return BroadcastTrigger(Target, FTriggerEffects::FromEncoded(Bytes), Hand);
+}
+
+int32 UDualSenseProxy::BroadcastTriggerPreset(const FSonyGamepadBroadcastTarget& Target, USonyGamepadTriggerPreset* Preset, EControllerHand Hand)
+{
+	if (!IsValid(Preset))
+	{
+		return 0;
+	}
+
+	return BroadcastTrigger(Target, Preset->GetEffect(), Hand);
+}
+
 void UDualSenseProxy::ResetEffects(const int32 ControllerId)
 {
 	ISonyGamepadInterface* Gamepad = Cast<ISonyGamepadInterface>(UDeviceContainerManager::Get()->GetLibraryInstance(ControllerId));
@@ -5,7 +5,13 @@
 
 #include "SonyGamepadProxy.h"
 
+#include "Core/Assets/SonyGamepadHapticClip.h"
 #include "Core/DeviceContainerManager.h"
+#include "Core/Input/SonyGamepadStateRegistry.h"
+#include "Core/Output/OutputScheduler.h"
+#include "GameFramework/ForceFeedbackEffect.h"
+#include "Helpers/ValidateHelpers.h"
+#include "WindowsDualsense_ds5w.h"
 
 bool USonyGamepadProxy::DeviceIsConnected(int32 ControllerId)
 {
@@ -66,6 +72,319 @@ float USonyGamepadProxy::LevelBatteryDevice(int32 ControllerId)
 	return Gamepad->GetBattery();
 }
 
+float USonyGamepadProxy::GetDeviceReportRate(int32 ControllerId)
+{
+	ISonyGamepadInterface* Gamepad = UDeviceContainerManager::Get()->GetLibraryInstance(ControllerId);
+	if (!Gamepad)
+	{
+		return 0.0f;
+	}
+
+	return Gamepad->GetReportRate();
+}
+
+void USonyGamepadProxy::SetPollingPolicy(EPollingPolicy Policy, float FixedRateHz)
+{
+	const FWindowsDualsense_ds5wModule* Module = FModuleManager::GetModulePtr<FWindowsDualsense_ds5wModule>("WindowsDualsense_ds5w");
+	if (!Module || !Module->GetDeviceManager().IsValid())
+	{
+		return;
+	}
+
+	Module->GetDeviceManager()->SetPollingPolicy(Policy, FixedRateHz);
+}
+
+void USonyGamepadProxy::SetInputSamplingPoint(EInputSamplingPoint SamplingPoint)
+{
+	const FWindowsDualsense_ds5wModule* Module = FModuleManager::GetModulePtr<FWindowsDualsense_ds5wModule>("WindowsDualsense_ds5w");
+	if (!Module || !Module->GetDeviceManager().IsValid())
+	{
+		return;
+	}
+
+	Module->GetDeviceManager()->SetSamplingPoint(SamplingPoint);
+}
+
+FInputLatencyStats USonyGamepadProxy::GetInputLatency(int32 ControllerId, bool bReset)
+{
+	ISonyGamepadInterface* Gamepad = UDeviceContainerManager::Get()->GetLibraryInstance(ControllerId);
+	if (!Gamepad)
+	{
+		return FInputLatencyStats();
+	}
+
+	const FInputLatencyStats Stats = Gamepad->GetInputLatency();
+	if (bReset)
+	{
+		Gamepad->ResetInputLatency();
+	}
+	return Stats;
+}
+
+bool USonyGamepadProxy::GetInputState(int32 ControllerId, FSonyGamepadInputState& OutState)
+{
+	return FSonyGamepadStateRegistry::GetLatestState(ControllerId, OutState);
+}
+
+bool USonyGamepadProxy::IsButtonDown(const FSonyGamepadInputState& State, ESonyGamepadButton Button)
+{
+	return State.IsButtonDown(Button);
+}
+
+bool USonyGamepadProxy::GetMotionState(int32 ControllerId, FRotator& Orientation, FVector& AngularVelocity, FVector& LinearAcceleration)
+{
+	FSonyGamepadInputState State;
+	if (!FSonyGamepadStateRegistry::GetLatestState(ControllerId, State))
+	{
+		return false;
+	}
+
+	Orientation = FRotator(State.Orientation.Rotator());
+	AngularVelocity = FVector(State.AngularVelocity);
+	LinearAcceleration = FVector(State.GetLinearAcceleration());
+	return true;
+}
+
+void USonyGamepadProxy::BreakInputState(const FSonyGamepadInputState& State, FVector2D& LeftStick, FVector2D& RightStick,
+                                        FVector2D& Touch1, FVector2D& Touch2, FRotator& Orientation, FVector& AngularVelocity,
+                                        FVector& Gravity, FVector& LinearAcceleration)
+{
+	LeftStick = FVector2D(State.LeftStick);
+	RightStick = FVector2D(State.RightStick);
+	Touch1 = State.Touch1.GetPosition();
+	Touch2 = State.Touch2.GetPosition();
+	Orientation = FRotator(State.Orientation.Rotator());
+	AngularVelocity = FVector(State.AngularVelocity);
+	Gravity = FVector(State.GetGravity());
+	LinearAcceleration = FVector(State.GetLinearAcceleration());
+}
+
+bool USonyGamepadProxy::GetTouchVelocity(int32 ControllerId, FVector2D& Touch1Velocity, FVector2D& Touch2Velocity)
+{
+	const FTouchTracker* TouchTracker = FSonyGamepadStateRegistry::GetTouchTracker(ControllerId);
+	if (!TouchTracker)
+	{
+		return false;
+	}
+
+	Touch1Velocity = TouchTracker->GetContactVelocity(0);
+	Touch2Velocity = TouchTracker->GetContactVelocity(1);
+	return true;
+}
+
+void USonyGamepadProxy::SetLateLatchSettings(const FSonyGamepadLateLatchSettings& Settings)
+{
+	const FWindowsDualsense_ds5wModule* Module = FModuleManager::GetModulePtr<FWindowsDualsense_ds5wModule>("WindowsDualsense_ds5w");
+	if (!Module || !Module->GetViewExtension().IsValid())
+	{
+		return;
+	}
+
+	Module->GetViewExtension()->SetSettings(Settings);
+}
+
+void USonyGamepadProxy::SetGyroLookSettings(int32 ControllerId, const FSonyGamepadGyroLookSettings& Settings)
+{
+	if (FGyroLookProcessor* LookProcessor = FSonyGamepadStateRegistry::GetLookProcessor(ControllerId))
+	{
+		LookProcessor->SetSettings(Settings);
+	}
+}
+
+FVector2D USonyGamepadProxy::ConsumeGyroLookDelta(int32 ControllerId)
+{
+	FGyroLookProcessor* LookProcessor = FSonyGamepadStateRegistry::GetLookProcessor(ControllerId);
+	return LookProcessor ? LookProcessor->ConsumeDelta() : FVector2D::ZeroVector;
+}
+
+void USonyGamepadProxy::SetPredictionSettings(int32 ControllerId, const FSonyGamepadPredictionSettings& Settings)
+{
+	if (FInputPredictor* Predictor = FSonyGamepadStateRegistry::GetPredictor(ControllerId))
+	{
+		Predictor->SetSettings(Settings);
+	}
+}
+
+bool USonyGamepadProxy::PredictInputState(int32 ControllerId, float SecondsFromNow, FSonyGamepadInputState& OutState)
+{
+	FInputPredictor* Predictor = FSonyGamepadStateRegistry::GetPredictor(ControllerId);
+	const FInputSampleHistory* History = FSonyGamepadStateRegistry::GetHistory(ControllerId);
+	FSonyGamepadInputState Latest;
+	if (!Predictor || !History || !FSonyGamepadStateRegistry::GetLatestState(ControllerId, Latest))
+	{
+		return false;
+	}
+
+	return Predictor->Predict(*History, Latest, FPlatformTime::Seconds() + SecondsFromNow, OutState);
+}
+
+FSonyGamepadPredictionStats USonyGamepadProxy::GetPredictionStats(int32 ControllerId)
+{
+	const FInputPredictor* Predictor = FSonyGamepadStateRegistry::GetPredictor(ControllerId);
+	return Predictor ? Predictor->GetStats() : FSonyGamepadPredictionStats();
+}
+
+void USonyGamepadProxy::ResetPredictionStats(int32 ControllerId)
+{
+	if (FInputPredictor* Predictor = FSonyGamepadStateRegistry::GetPredictor(ControllerId))
+	{
+		Predictor->ResetStats();
+	}
+}
+
+void USonyGamepadProxy::SetAnalogSettings(int32 ControllerId, const FSonyGamepadAnalogSettings& Settings)
+{
+	if (FAnalogConditioner* AnalogConditioner = FSonyGamepadStateRegistry::GetAnalogConditioner(ControllerId))
+	{
+		AnalogConditioner->SetSettings(Settings);
+	}
+}
+
+void USonyGamepadProxy::SetButtonRemap(int32 ControllerId, const FSonyGamepadButtonRemap& Profile)
+{
+	if (FButtonRemapper* ButtonRemapper = FSonyGamepadStateRegistry::GetButtonRemapper(ControllerId))
+	{
+		ButtonRemapper->SetProfile(Profile);
+	}
+}
+
+void USonyGamepadProxy::ClearButtonRemap(int32 ControllerId)
+{
+	if (FButtonRemapper* ButtonRemapper = FSonyGamepadStateRegistry::GetButtonRemapper(ControllerId))
+	{
+		ButtonRemapper->ClearProfile();
+	}
+}
+
+void USonyGamepadProxy::SetOutputBudget(const FSonyGamepadOutputBudget& Budget)
+{
+	FOutputScheduler::Get().SetBudget(Budget);
+}
+
+void USonyGamepadProxy::SetOutputAdapter(int32 ControllerId, int32 AdapterId)
+{
+	FOutputScheduler::Get().SetAdapter(ControllerId, AdapterId);
+}
+
+FSonyGamepadOutputStats USonyGamepadProxy::GetOutputStats()
+{
+	return FOutputScheduler::Get().GetStats();
+}
+
+void USonyGamepadProxy::ResetOutputStats()
+{
+	FOutputScheduler::Get().ResetStats();
+}
+
+int32 USonyGamepadProxy::PlayForceFeedback(int32 ControllerId, UForceFeedbackEffect* Effect, float Delay, float Scale, bool bLoop)
+{
+	FRumblePlayback Playback;
+	Playback.Curve = FRumbleCurve::Bake(Effect);
+	if (!Playback.Curve.IsValid())
+	{
+		return 0;
+	}
+
+	Playback.StartTime = FPlatformTime::Seconds() + FMath::Max(Delay, 0.0f);
+	Playback.Scale = Scale;
+	Playback.bLoop = bLoop;
+	return static_cast<int32>(FOutputScheduler::Get().PlayRumble(ControllerId, Playback));
+}
+
+int32 USonyGamepadProxy::PlayRumbleEnvelope(int32 ControllerId, const FSonyGamepadRumbleEnvelope& Envelope, float Delay)
+{
+	FRumblePlayback Playback;
+	Playback.Envelope = Envelope;
+	Playback.StartTime = FPlatformTime::Seconds() + FMath::Max(Delay, 0.0f);
+	return static_cast<int32>(FOutputScheduler::Get().PlayRumble(ControllerId, Playback));
+}
+
+void USonyGamepadProxy::StopRumble(int32 ControllerId, int32 Handle)
+{
+	FOutputScheduler::Get().StopRumble(ControllerId, static_cast<uint32>(Handle));
+}
+
+bool USonyGamepadProxy::PlayHapticClip(int32 ControllerId, USonyGamepadHapticClip* Clip, float StartPosition, bool bLoop, float CrossFade)
+{
+	if (!IsValid(Clip))
+	{
+		return false;
+	}
+
+	FHapticClipPlayback Playback;
+	Playback.Clip = Clip->OpenClip();
+	Playback.StartTime = FPlatformTime::Seconds();
+	Playback.StartPosition = FMath::Max(StartPosition, 0.0f);
+	Playback.CrossFade = FMath::Max(CrossFade, 0.0f);
+	Playback.bLoop = bLoop;
+	return FOutputScheduler::Get().PlayClip(ControllerId, Playback);
+}
+
+void USonyGamepadProxy::StopHapticClip(int32 ControllerId, float FadeOut)
+{
+	FOutputScheduler::Get().StopClip(ControllerId, FadeOut);
+}
+
+void USonyGamepadProxy::SeekHapticClip(int32 ControllerId, float Position)
+{
+	FOutputScheduler::Get().SeekClip(ControllerId, Position);
+}
+
+void USonyGamepadProxy::SetControllerTeam(int32 ControllerId, int32 Team)
+{
+	FOutputScheduler::Get().SetTeam(ControllerId, Team);
+}
+
+int32 USonyGamepadProxy::BroadcastLightbar(const FSonyGamepadBroadcastTarget& Target, FColor Color)
+{
+	FOutputCommand Command(EOutputCommand::Lightbar);
+	Command.Lightbar = {Color.R, Color.G, Color.B, 0};
+	return FOutputScheduler::Get().Broadcast(Target, MakeArrayView(&Command, 1));
+}
+
+int32 USonyGamepadProxy::BroadcastRumble(const FSonyGamepadBroadcastTarget& Target, float LeftMotor, float RightMotor, ESonyGamepadRumbleSource Source)
+{
+	FOutputCommand Command(EOutputCommand::Rumble);
+	Command.RumbleSource = Source;
+	Command.Rumbles.Left = static_cast<unsigned char>(UValidateHelpers::To255(LeftMotor));
+	Command.Rumbles.Right = static_cast<unsigned char>(UValidateHelpers::To255(RightMotor));
+	return FOutputScheduler::Get().Broadcast(Target, MakeArrayView(&Command, 1));
+}
+
+void USonyGamepadProxy::SetSourceRumble(int32 ControllerId, ESonyGamepadRumbleSource Source, float LeftMotor, float RightMotor)
+{
+	FOutputCommand Command(EOutputCommand::Rumble);
+	Command.RumbleSource = Source;
+	Command.Rumbles.Left = static_cast<unsigned char>(UValidateHelpers::To255(LeftMotor));
+	Command.Rumbles.Right = static_cast<unsigned char>(UValidateHelpers::To255(RightMotor));
+	if (FOutputScheduler::Get().Enqueue(ControllerId, Command))
+	{
+		return;
+	}
+
+	// Without the output thread there is no mixer, the source plays as a plain vibration.
+	ISonyGamepadInterface* Gamepad = UDeviceContainerManager::Get()->GetLibraryInstance(ControllerId);
+	if (!Gamepad)
+	{
+		return;
+	}
+
+	FForceFeedbackValues Values;
+	Values.LeftLarge = LeftMotor;
+	Values.RightLarge = RightMotor;
+	Gamepad->SetVibration(Values);
+}
+
+void USonyGamepadProxy::SetRumbleMix(const FSonyGamepadRumbleMix& RumbleMix)
+{
+	FOutputScheduler::Get().SetRumbleMix(RumbleMix);
+}
+
+TArray<FSonyGamepadRumbleSourceStats> USonyGamepadProxy::GetRumbleSourceStats(int32 ControllerId)
+{
+	return FOutputScheduler::Get().GetRumbleStats(ControllerId);
+}
+
 void USonyGamepadProxy::LedColorEffects(int32 ControllerId, FColor Color, float BrightnessTime, float ToogleTime)
 {
 	ISonyGamepadInterface* Gamepad = Cast<ISonyGamepadInterface>(UDeviceContainerManager::Get()->GetLibraryInstance(ControllerId));
@@ -88,6 +407,21 @@ void USonyGamepadProxy::LedMicEffects(int32 ControllerId, ELedMicEnum Value)
 	Gamepad->SetMicrophoneLed(Value);
 }
 
+bool USonyGamepadProxy::PlayLightbarAnimation(int32 ControllerId, const FSonyGamepadLightbarAnimation& Animation, float Delay)
+{
+	return FOutputScheduler::Get().PlayLightbarAnimation(ControllerId, Animation, FPlatformTime::Seconds() + FMath::Max(Delay, 0.0f));
+}
+
+void USonyGamepadProxy::StopLightbarAnimation(int32 ControllerId)
+{
+	FOutputScheduler::Get().StopLightbarAnimation(ControllerId);
+}
+
+void USonyGamepadProxy::SetLightbarAnimationValue(int32 ControllerId, float Value)
+{
+	FOutputScheduler::Get().SetLightbarAnimationValue(ControllerId, Value);
+}
+
 void USonyGamepadProxy::EnableTouch(int32 ControllerId, bool bEnableTouch)
 {
 	ISonyGamepadInterface* Gamepad = Cast<ISonyGamepadInterface>(UDeviceContainerManager::Get()->GetLibraryInstance(ControllerId));
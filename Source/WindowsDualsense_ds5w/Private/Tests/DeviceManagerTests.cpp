@@ -0,0 +1,166 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include <atomic>
+
+#include "DeviceManager.h"
+#include "Core/DeviceContainerManager.h"
+#include "GenericPlatform/GenericApplicationMessageHandler.h"
+#include "HAL/PlatformTLS.h"
+
+namespace
+{
+	/**
+	 * Forwards every call to the allocator it wraps and counts the allocations made by one thread.
+	 * Installed as GMalloc only around the measured code; it lives for the whole program, so a thread
+	 * that still holds it after GMalloc was restored keeps forwarding safely.
+	 */
+	class FAllocationCounter final : public FMalloc
+	{
+	public:
+		void Begin(FMalloc* InInner)
+		{
+			Inner = InInner;
+			ThreadId = FPlatformTLS::GetCurrentThreadId();
+			Allocations.store(0, std::memory_order_relaxed);
+		}
+
+		int32 GetAllocations() const
+		{
+			return Allocations.load(std::memory_order_relaxed);
+		}
+
+		virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+		{
+			Count();
+			return Inner->Malloc(Size, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+		{
+			Count();
+			return Inner->TryMalloc(Size, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override
+		{
+			if (Size > 0)
+			{
+				Count();
+			}
+			return Inner->Realloc(Original, Size, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Size, uint32 Alignment) override
+		{
+			if (Size > 0)
+			{
+				Count();
+			}
+			return Inner->TryRealloc(Original, Size, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			Inner->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Size, uint32 Alignment) override
+		{
+			return Inner->QuantizeSize(Size, Alignment);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return Inner->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual void Trim(bool bTrimThreadCaches) override
+		{
+			Inner->Trim(bTrimThreadCaches);
+		}
+
+		virtual void SetupTLSCachesOnCurrentThread() override
+		{
+			Inner->SetupTLSCachesOnCurrentThread();
+		}
+
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			Inner->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+
+		virtual bool IsInternallyThreadSafe() const override
+		{
+			return Inner->IsInternallyThreadSafe();
+		}
+
+		virtual bool ValidateHeap() override
+		{
+			return Inner->ValidateHeap();
+		}
+
+		virtual const TCHAR* GetDescriptiveName() override
+		{
+			return Inner->GetDescriptiveName();
+		}
+
+	private:
+		void Count()
+		{
+			if (FPlatformTLS::GetCurrentThreadId() == ThreadId)
+			{
+				Allocations.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		FMalloc* Inner = nullptr;
+		uint32 ThreadId = 0;
+		std::atomic<int32> Allocations{0};
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeviceManagerPollAllocationTest, "SonyGamepad.DeviceManager.PollDoesNotAllocate",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeviceManagerPollAllocationTest::RunTest(const FString& Parameters)
+{
+	// A second manager would pop reports from the readers of the live controllers and steal the input
+	// of the module's own manager, so the poll is only measured while no controller is connected.
+	if (UDeviceContainerManager::GetAllocatedDevices() > 0)
+	{
+		AddInfo(TEXT("A controller is connected, the poll was not measured."));
+		return true;
+	}
+
+	// The manager keeps a reference to the handler, so it must outlive the manager.
+	const TSharedRef<FGenericApplicationMessageHandler> MessageHandler = MakeShared<FGenericApplicationMessageHandler>();
+	DeviceManager Manager(MessageHandler, false);
+	Manager.SetSamplingPoint(EInputSamplingPoint::SendControllerEvents);
+
+	for (int32 Poll = 0; Poll < 4; ++Poll)
+	{
+		Manager.SendControllerEvents();
+	}
+
+	static FAllocationCounter Counter;
+	FMalloc* const Inner = GMalloc;
+	Counter.Begin(Inner);
+	GMalloc = &Counter;
+	for (int32 Poll = 0; Poll < 1000; ++Poll)
+	{
+		Manager.Tick(1.0f / 60.0f);
+		Manager.SendControllerEvents();
+	}
+	GMalloc = Inner;
+
+	TestEqual(TEXT("Allocations across 1000 polls"), Counter.GetAllocations(), 0);
+	return true;
+}
+
+#endif
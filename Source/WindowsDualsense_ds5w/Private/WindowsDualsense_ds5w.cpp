@@ -12,16 +12,28 @@
 #include <stdio.h>
 
 #include "Core/DeviceContainerManager.h"
+#include "Core/Output/OutputScheduler.h"
+#include "Core/SonyGamepadKeyNames.h"
+#include "Misc/CoreDelegates.h"
 #define LOCTEXT_NAMESPACE "FWindowsDualsense_ds5wModule"
 
 void FWindowsDualsense_ds5wModule::StartupModule()
 {
 	IModularFeatures::Get().RegisterModularFeature(IInputDeviceModule::GetModularFeatureName(), this);
 	RegisterCustomKeys();
+	FCoreDelegates::OnPostEngineInit.AddRaw(this, &FWindowsDualsense_ds5wModule::RegisterViewExtension);
 }
 
 void FWindowsDualsense_ds5wModule::ShutdownModule()
 {
+	FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+	ViewExtension.Reset();
+	FOutputScheduler::Get().Shutdown();
+}
+
+void FWindowsDualsense_ds5wModule::RegisterViewExtension()
+{
+	ViewExtension = FSceneViewExtensions::NewExtension<FSonyGamepadViewExtension>();
 }
 
 TSharedPtr<IInputDevice> FWindowsDualsense_ds5wModule::CreateInputDevice(
@@ -50,17 +62,17 @@ TSharedPtr<IInputDevice> FWindowsDualsense_ds5wModule::CreateInputDevice(
 
 void FWindowsDualsense_ds5wModule::RegisterCustomKeys()
 {
-	const FKey Mic("PS_Mic");
-	const FKey Menu("PS_Menu");
-	const FKey Shared("PS_Share");
-	const FKey TouchButtom("PS_TouchButtom");
-	const FKey PlayStationButton("PS_Button");
-	const FKey PS_PushLeftStick("PS_PushLeftStick");
-	const FKey PS_PushRightStick("PS_PushRightStick");
-	const FKey PS_FunctionL("PS_FunctionL");
-	const FKey PS_FunctionR("PS_FunctionR");
-	const FKey PS_PaddleL("PS_PaddleL");
-	const FKey PS_PaddleR("PS_PaddleR");
+	const FKey Mic(FSonyGamepadKeyNames::Mic);
+	const FKey Menu(FSonyGamepadKeyNames::Menu);
+	const FKey Shared(FSonyGamepadKeyNames::Share);
+	const FKey TouchButtom(FSonyGamepadKeyNames::TouchButton);
+	const FKey PlayStationButton(FSonyGamepadKeyNames::PlayStationButton);
+	const FKey PS_PushLeftStick(FSonyGamepadKeyNames::PushLeftStick);
+	const FKey PS_PushRightStick(FSonyGamepadKeyNames::PushRightStick);
+	const FKey PS_FunctionL(FSonyGamepadKeyNames::FunctionL);
+	const FKey PS_FunctionR(FSonyGamepadKeyNames::FunctionR);
+	const FKey PS_PaddleL(FSonyGamepadKeyNames::PaddleL);
+	const FKey PS_PaddleR(FSonyGamepadKeyNames::PaddleR);
 
 	EKeys::AddKey(FKeyDetails(
 		PS_FunctionL,
@@ -127,6 +139,75 @@ void FWindowsDualsense_ds5wModule::RegisterCustomKeys()
 		FText::FromString("PlayStation Touchpad Button"),
 		FKeyDetails::GamepadKey
 	));
+
+	// Touchpad gestures, recognized by FTouchTracker and sent as a press immediately followed by a release.
+	const TPair<FName, const TCHAR*> Gestures[] = {
+		{FSonyGamepadKeyNames::TouchTap, TEXT("PlayStation Touchpad Tap")},
+		{FSonyGamepadKeyNames::TouchTwoFingerTap, TEXT("PlayStation Touchpad Two Finger Tap")},
+		{FSonyGamepadKeyNames::TouchSwipeLeft, TEXT("PlayStation Touchpad Swipe Left")},
+		{FSonyGamepadKeyNames::TouchSwipeRight, TEXT("PlayStation Touchpad Swipe Right")},
+		{FSonyGamepadKeyNames::TouchSwipeUp, TEXT("PlayStation Touchpad Swipe Up")},
+		{FSonyGamepadKeyNames::TouchSwipeDown, TEXT("PlayStation Touchpad Swipe Down")},
+		{FSonyGamepadKeyNames::TouchPinchIn, TEXT("PlayStation Touchpad Pinch In")},
+		{FSonyGamepadKeyNames::TouchPinchOut, TEXT("PlayStation Touchpad Pinch Out")},
+	};
+	for (const TPair<FName, const TCHAR*>& Gesture : Gestures)
+	{
+		EKeys::AddKey(FKeyDetails(
+			FKey(Gesture.Key),
+			FText::FromString(Gesture.Value),
+			FKeyDetails::GamepadKey
+		));
+	}
+
+	// Motion and touchpad axes, fed by FSonyInputDecoder::DispatchEvents so Enhanced Input binds them directly.
+	const TPair<FName, const TCHAR*> Axes[] = {
+		{FSonyGamepadKeyNames::GyroPitch, TEXT("PlayStation Gyro Pitch")},
+		{FSonyGamepadKeyNames::GyroYaw, TEXT("PlayStation Gyro Yaw")},
+		{FSonyGamepadKeyNames::GyroRoll, TEXT("PlayStation Gyro Roll")},
+		{FSonyGamepadKeyNames::TiltPitch, TEXT("PlayStation Tilt Pitch")},
+		{FSonyGamepadKeyNames::TiltYaw, TEXT("PlayStation Tilt Yaw")},
+		{FSonyGamepadKeyNames::TiltRoll, TEXT("PlayStation Tilt Roll")},
+		{FSonyGamepadKeyNames::GravityX, TEXT("PlayStation Gravity X")},
+		{FSonyGamepadKeyNames::GravityY, TEXT("PlayStation Gravity Y")},
+		{FSonyGamepadKeyNames::GravityZ, TEXT("PlayStation Gravity Z")},
+		{FSonyGamepadKeyNames::Touch1X, TEXT("PlayStation Touchpad Finger 1 X")},
+		{FSonyGamepadKeyNames::Touch1Y, TEXT("PlayStation Touchpad Finger 1 Y")},
+		{FSonyGamepadKeyNames::Touch2X, TEXT("PlayStation Touchpad Finger 2 X")},
+		{FSonyGamepadKeyNames::Touch2Y, TEXT("PlayStation Touchpad Finger 2 Y")},
+	};
+	for (const TPair<FName, const TCHAR*>& Axis : Axes)
+	{
+		EKeys::AddKey(FKeyDetails(
+			FKey(Axis.Key),
+			FText::FromString(Axis.Value),
+			FKeyDetails::GamepadKey | FKeyDetails::Axis1D
+		));
+	}
+
+	// The engine only pairs two axes into one key, so gravity has no 3D key: the engine Gravity,
+	// RotationRate and Tilt keys, fed by OnMotionDetected, remain the 3D bindings.
+	struct FPairedAxes
+	{
+		FName Key;
+		const TCHAR* DisplayName;
+		FName KeyX;
+		FName KeyY;
+	};
+	const FPairedAxes PairedAxes[] = {
+		{FSonyGamepadKeyNames::Gyro, TEXT("PlayStation Gyro 2D"), FSonyGamepadKeyNames::GyroYaw, FSonyGamepadKeyNames::GyroPitch},
+		{FSonyGamepadKeyNames::Tilt, TEXT("PlayStation Tilt 2D"), FSonyGamepadKeyNames::TiltRoll, FSonyGamepadKeyNames::TiltPitch},
+		{FSonyGamepadKeyNames::Touch1, TEXT("PlayStation Touchpad Finger 1 2D"), FSonyGamepadKeyNames::Touch1X, FSonyGamepadKeyNames::Touch1Y},
+		{FSonyGamepadKeyNames::Touch2, TEXT("PlayStation Touchpad Finger 2 2D"), FSonyGamepadKeyNames::Touch2X, FSonyGamepadKeyNames::Touch2Y},
+	};
+	for (const FPairedAxes& Paired : PairedAxes)
+	{
+		EKeys::AddPairedKey(FKeyDetails(
+			FKey(Paired.Key),
+			FText::FromString(Paired.DisplayName),
+			FKeyDetails::GamepadKey | FKeyDetails::Axis2D
+		), FKey(Paired.KeyX), FKey(Paired.KeyY));
+	}
 }
 
 IMPLEMENT_MODULE(FWindowsDualsense_ds5wModule, WindowsDualsense_ds5w)
@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Core/Output/HapticClip.h"
+#include "Core/Structs/FSonyGamepadHapticClipKeys.h"
+#include "SonyGamepadHapticClip.generated.h"
+
+/**
+ * @brief A multi-second track of rumble, lightbar and trigger keyframes, e.g. for cinematics.
+ *
+ * The keyframes are edited here but only exist in the editor. Saving the asset in the editor compiles
+ * them into a haptic clip file under the content directory, which is memory-mapped and streamed
+ * by the output thread when the clip plays, so a long clip costs neither Blueprint scripting nor
+ * memory for its keyframes. Add the directory of the clip files to "Additional Non-Asset Directories
+ * To Copy", so they are staged as loose files: a file inside a pak can not be memory-mapped.
+ *
+ * The cook compiles the keyframes again and fails with an error when the clip file is missing, does
+ * not match them, or is not under a directory staged as loose files, instead of leaving the clip
+ * to fail to open at runtime.
+ */
+UCLASS(BlueprintType)
+class WINDOWSDUALSENSE_DS5W_API USonyGamepadHapticClip : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITORONLY_DATA
+	UPROPERTY(EditAnywhere, Category = "SonyGamepad: Haptic Clip")
+	TArray<FSonyGamepadClipRumbleKey> RumbleKeys;
+	UPROPERTY(EditAnywhere, Category = "SonyGamepad: Haptic Clip")
+	TArray<FSonyGamepadClipLightbarKey> LightbarKeys;
+	UPROPERTY(EditAnywhere, Category = "SonyGamepad: Haptic Clip")
+	TArray<FSonyGamepadClipTriggerKey> LeftTriggerKeys;
+	UPROPERTY(EditAnywhere, Category = "SonyGamepad: Haptic Clip")
+	TArray<FSonyGamepadClipTriggerKey> RightTriggerKeys;
+#endif
+
+	/**
+	 * Length of the clip, in seconds. The clip lasts at least until its last key.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SonyGamepad: Haptic Clip", meta = (ClampMin = "0.0"))
+	float Duration = 0.0f;
+	/**
+	 * Path of the compiled clip, relative to the content directory. Defaults to HapticClips/<asset name>.sghc.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SonyGamepad: Haptic Clip")
+	FString ClipFile;
+
+	/**
+	 * Opens the compiled clip, shared by every playback while one is alive. Must be called from the game thread.
+	 * In the editor, the clip is compiled in memory from the current keyframes instead.
+	 *
+	 * @return The clip, or null if it can not be opened.
+	 */
+	TSharedPtr<const FHapticClip> OpenClip();
+	/**
+	 * @return The full path of the compiled clip.
+	 */
+	FString GetClipPath() const;
+
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#if WITH_EDITOR
+	/**
+	 * Compiles the keyframes into the haptic clip format.
+	 *
+	 * @param OutData Receives the encoded clip.
+	 */
+	void Compile(TArray<uint8>& OutData) const;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+#if WITH_EDITOR
+	/**
+	 * Checks, while cooking, that the clip file matches the keyframes and is staged as a loose file, and
+	 * logs an error otherwise.
+	 */
+	void VerifyClipFile() const;
+#endif
+
+	TWeakPtr<const FHapticClip> Clip;
+};
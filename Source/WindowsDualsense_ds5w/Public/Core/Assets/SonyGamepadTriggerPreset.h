@@ -0,0 +1,61 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Core/Structs/FOutputContext.h"
+#include "Core/Structs/FSonyGamepadTriggerEffect.h"
+#include "SonyGamepadTriggerPreset.generated.h"
+
+/**
+ * @brief An adaptive trigger effect compiled ahead of time into the bytes the DualSense receives.
+ *
+ * The effect is validated and encoded when the asset is edited, saved or cooked, and the bytes are
+ * saved with it. Applying the preset copies them to the report as they are, without the zone loops,
+ * bit packing and mode branches of the trigger setters.
+ */
+UCLASS(BlueprintType)
+class WINDOWSDUALSENSE_DS5W_API USonyGamepadTriggerPreset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SonyGamepad: Trigger Preset")
+	FSonyGamepadTriggerEffect Effect;
+
+	/**
+	 * @return The compiled effect, or no effect if the preset was never compiled.
+	 */
+	FHapticTriggers GetEffect() const;
+
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#if WITH_EDITOR
+	virtual void PostLoad() override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+	virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+#endif
+	/**
+	 * Checks that the positions, strengths, frequency and period of the effect are in the range of the device.
+	 *
+	 * @param OutErrors Receives a message per invalid parameter.
+	 * @return True if the effect is valid.
+	 */
+	bool Validate(TArray<FText>& OutErrors) const;
+	/**
+	 * Encodes the effect into the compiled bytes. Out of range parameters are clamped.
+	 */
+	void Compile();
+#endif
+
+private:
+	/**
+	 * The trigger effect block of the report, SONY_GAMEPAD_TRIGGER_EFFECT_SIZE bytes.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "SonyGamepad: Trigger Preset", AdvancedDisplay)
+	TArray<uint8> Compiled;
+};
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Core/Output/TriggerTimelinePlayer.h"
+#include "Core/Structs/FSonyGamepadTriggerLayer.h"
+#include "Core/Structs/FSonyGamepadTriggerTimelineKey.h"
+#include "SonyGamepadTriggerTimeline.generated.h"
+
+/**
+ * @brief A sequence of adaptive trigger effects with exact offsets, e.g. a recoil pattern or a charge-up.
+ *
+ * The keys are compiled once into their output state, and the output thread sets each of them on
+ * time, so one Blueprint call plays the whole sequence without timers, frame rate jitter or a
+ * report per call.
+ */
+UCLASS(BlueprintType)
+class WINDOWSDUALSENSE_DS5W_API USonyGamepadTriggerTimeline : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SonyGamepad: Trigger Timeline")
+	TArray<FSonyGamepadTriggerTimelineKey> Keys;
+	/**
+	 * Length of one cycle, in seconds. The timeline lasts at least until its last key.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SonyGamepad: Trigger Timeline", meta = (ClampMin = "0.0"))
+	float Duration = 0.0f;
+	/**
+	 * The layer of the trigger effect stack the timeline plays on. Its fade out applies when the timeline ends or stops.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SonyGamepad: Trigger Timeline")
+	FSonyGamepadTriggerLayer Layer;
+	/**
+	 * Keeps the effect of the last key once the timeline ends, instead of clearing its layer. Ignored while looping.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SonyGamepad: Trigger Timeline")
+	bool bHoldLastEffect = false;
+
+	/**
+	 * Compiles the keys, once. Must be called from the game thread.
+	 *
+	 * @return The timeline, shared by every playback.
+	 */
+	TSharedPtr<const FTriggerTimeline> GetTimeline();
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	TSharedPtr<const FTriggerTimeline> Timeline;
+};
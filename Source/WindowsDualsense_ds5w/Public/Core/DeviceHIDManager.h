@@ -62,6 +62,17 @@ public:
 	 * @return A HANDLE to the DualSense device if successful. Returns INVALID_HANDLE_VALUE if the operation fails.
 	 */
 	static HANDLE CreateHandle(FDeviceContext* DeviceContext);
+	/**
+	 * Reads the factory IMU calibration of a device and stores it in the device context.
+	 *
+	 * DualSense reports it in feature report 0x05 on every connection, DualShock 4 in 0x02 over USB
+	 * and in 0x05 over Bluetooth. Reading the report also switches Bluetooth devices to the full
+	 * input report. On failure, the context keeps the identity calibration.
+	 *
+	 * @param DeviceHandle An open handle to the device.
+	 * @param Context The device context, with its DeviceType and ConnectionType already set.
+	 */
+	static void ReadCalibration(HANDLE DeviceHandle, FDeviceContext& Context);
 	/**
 	 * Outputs current DualSense device states to the HID (Human Interface Device).
 	 *
@@ -87,6 +98,46 @@ public:
 	 * @param DeviceContext A reference to the device context containing connection and handle details for the target device.
 	 */
 	static void OutputDualShock(FDeviceContext* DeviceContext);
+	/**
+	 * Fills the output buffer of a DualSense device context with its current output state, without writing it.
+	 *
+	 * @param DeviceContext The device context, whose BufferOutput receives the report.
+	 * @return Length of the report, in bytes.
+	 */
+	static uint32 BuildOutputDualSense(FDeviceContext* DeviceContext);
+	/**
+	 * Fills the output buffer of a DualShock device context with its current output state, without writing it.
+	 *
+	 * @param DeviceContext The device context, whose BufferOutput receives the report.
+	 * @return Length of the report, in bytes.
+	 */
+	static uint32 BuildOutputDualShock(FDeviceContext* DeviceContext);
+	/**
+	 * Builds a DualSense output report from an output state, e.g. on the output thread, which keeps its own state.
+	 *
+	 * @param OutputContext The output state.
+	 * @param Connection The connection of the device, which defines the layout of the report.
+	 * @param Buffer The report, of at least 78 bytes. Kept between calls, as some flags toggle on every report.
+	 * @return Length of the report, in bytes.
+	 */
+	static uint32 BuildOutputDualSense(const FOutputContext& OutputContext, EDeviceConnection Connection, unsigned char* Buffer);
+	/**
+	 * Builds a DualShock output report from an output state, e.g. on the output thread, which keeps its own state.
+	 *
+	 * @param OutputContext The output state.
+	 * @param Connection The connection of the device, which defines the layout of the report.
+	 * @param Buffer The report, of at least 78 bytes.
+	 * @return Length of the report, in bytes.
+	 */
+	static uint32 BuildOutputDualShock(const FOutputContext& OutputContext, EDeviceConnection Connection, unsigned char* Buffer);
+	/**
+	 * Writes the report in the output buffer of a device context to the device, and frees the context
+	 * if the device does not accept it.
+	 *
+	 * @param DeviceContext The device context.
+	 * @param Length Length of the report, as returned by BuildOutputDualSense or BuildOutputDualShock.
+	 */
+	static void WriteOutput(FDeviceContext* DeviceContext, uint32 Length);
 	/**
 	 * Attempts to retrieve the current input state from the specified DualSense device context.
 	 * This function reads input data from the device handle into the device's buffer, ensuring the device is connected
@@ -105,9 +156,10 @@ public:
 	 * @param Trigger A pointer to the memory buffer that represents the trigger effect configuration.
 	 *                The buffer will be modified to match the specified haptic feedback configuration.
 	 * @param Effect A reference to the FHapticTriggers structure containing the haptic effect parameters,
-	 *               including mode, strength, frequency, and other relevant settings.
+	 *               including mode, strength, frequency, and other relevant settings. An encoded effect
+	 *               is copied as it is.
 	 */
-	static void SetTriggerEffects(unsigned char* Trigger, FHapticTriggers& Effect);
+	static void SetTriggerEffects(unsigned char* Trigger, const FHapticTriggers& Effect);
 	/**
 	 * Computes the CRC32 hash for the given buffer using a predefined hash table and seed value.
 	 * The function iterates through each byte of the input buffer to calculate the resulting hash.
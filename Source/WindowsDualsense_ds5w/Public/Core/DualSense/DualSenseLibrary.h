@@ -16,6 +16,9 @@
 #include "Core/Structs/FDeviceContext.h"
 #include "Core/Structs/FDeviceSettings.h"
 #include "Core/Structs/FDualSenseFeatureReport.h"
+#include "Core/Input/DeviceInputReader.h"
+#include "Core/Output/OutputCommandQueue.h"
+#include "Core/Structs/FSonyGamepadInputState.h"
 #include "DualSenseLibrary.generated.h"
 
 /**
@@ -352,21 +355,6 @@ public:
 	 * buffering to the appropriate manager, ensuring proper data flow to the device.
 	 */
 	virtual void SendOut() override;
-	/**
-	 * @brief Handles button input events for a DualSense controller.
-	 *
-	 * This function checks the current state of a button on a DualSense controller and triggers
-	 * appropriate input events (button press or release) based on the change in its state.
-	 *
-	 * @param InMessageHandler The message handler responsible for dispatching input events.
-	 * @param UserId The platform user ID associated with the controller.
-	 * @param InputDeviceId The unique identifier for the DualSense input device.
-	 * @param ButtonName The name of the button being checked.
-	 * @param IsButtonPressed A boolean indicating the current pressed state of the button (true if pressed, false otherwise).
-	 */
-	virtual void CheckButtonInput(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
-								  const FPlatformUserId UserId, const FInputDeviceId InputDeviceId,
-								  const FName ButtonName, const bool IsButtonPressed);
 	/**
 	 * @brief Updates the input state for a DualSense device.
 	 *
@@ -391,6 +379,46 @@ public:
 	{
 		return LevelBattery;
 	}
+	/**
+	 * Retrieves the report rate measured by the input reader thread.
+	 *
+	 * @return The report rate in Hz, or 0 when the device is read synchronously.
+	 */
+	virtual float GetReportRate() const override
+	{
+		return InputReader.IsValid() ? InputReader->GetReportRate() : 0.0f;
+	}
+	/**
+	 * Sets how pending input reports are consumed by UpdateInput.
+	 *
+	 * @param Policy With NativeRate every pending report is delivered, with FixedRate the pending reports
+	 *               spaced FixedRateHz apart, otherwise only the latest one.
+	 * @param FixedRateHz Sampling rate used by EPollingPolicy::FixedRate.
+	 */
+	virtual void SetPollingPolicy(const EPollingPolicy Policy, const float FixedRateHz) override
+	{
+		PollingPolicy = Policy;
+		FixedRateInterval = FixedRateHz > 0.0f ? 1.0 / FixedRateHz : 0.0;
+	}
+	/**
+	 * Retrieves the latency measured between report arrival and dispatch.
+	 *
+	 * @return The latency statistics, empty when the device is read synchronously.
+	 */
+	virtual FInputLatencyStats GetInputLatency() const override
+	{
+		return InputReader.IsValid() ? InputReader->GetLatencyStats() : FInputLatencyStats();
+	}
+	/**
+	 * Clears the latency statistics of the input reader.
+	 */
+	virtual void ResetInputLatency() override
+	{
+		if (InputReader.IsValid())
+		{
+			InputReader->ResetLatencyStats();
+		}
+	}
 	/**
 	 * @brief Sets the controller ID for the instance.
 	 *
@@ -450,6 +478,7 @@ public:
 	 * @param EndStrength The resistance strength at the end range of the trigger press.
 	 * @param Hand Specifies the target controller hand (e.g., left, right, or both).
 	 * @param KeepEffect If true, maintains a predefined effect regardless of the end strength; otherwise, uses the provided strength values.
+	 * @param Layer The layer of the trigger effect stack the effect is written to.
 	 *
 	 * @details The function calculates resistance strengths for ten distinct zones of the trigger and applies
 	 * them to either the left or right trigger, or both, based on the specified hand. It adjusts the outputs
@@ -458,7 +487,7 @@ public:
 	 * haptic experience. This method is particularly useful for implementing haptic feedback in shooting mechanics.
 	 */
 	virtual void SetAutomaticGun(int32 BeginStrength, int32 MiddleStrength, int32 EndStrength,
-	                             const EControllerHand& Hand, bool KeepEffect);
+	                             const EControllerHand& Hand, bool KeepEffect, const FSonyGamepadTriggerLayer& Layer);
 
 	/**
 	 * Configures the adaptive trigger on a DualSense controller to apply continuous resistance.
@@ -466,8 +495,9 @@ public:
 	 * @param StartPosition The starting position for the resistance in the adaptive trigger (range: 0-8).
 	 * @param Strength The intensity of the resistance in the adaptive trigger (range: 0-9).
 	 * @param Hand Specifies which controller hand (left, right, or both) the resistance should be applied to.
+	 * @param Layer The layer of the trigger effect stack the effect is written to.
 	 */
-	void SetContinuousResistance(int32 StartPosition, int32 Strength, const EControllerHand& Hand);
+	void SetContinuousResistance(int32 StartPosition, int32 Strength, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer);
 	/**
 	 * @brief Sets the resistance parameters for the DualSense controller's adaptive triggers.
 	 *
@@ -479,8 +509,9 @@ public:
 	 * @param MiddleStrength The strength value for the middle zone of the trigger.
 	 * @param EndStrength The strength value for the end zone of the trigger.
 	 * @param Hand The controller hand (left, right, or both) to which the resistance will be applied.
+	 * @param Layer The layer of the trigger effect stack the effect is written to.
 	 */
-	void SetResistance(int32 BeginStrength, int32 MiddleStrength, int32 EndStrength, const EControllerHand& Hand);
+	void SetResistance(int32 BeginStrength, int32 MiddleStrength, int32 EndStrength, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer);
 	/**
 	 * Sets the weapon effect on the adaptive triggers of the DualSense controller. This method configures
 	 * the trigger mode and strength for the specified trigger zones.
@@ -489,8 +520,9 @@ public:
 	 * @param EndPosition The ending position of the trigger zone. Must be within the valid range [0, 8].
 	 * @param Strength The strength of the trigger resistance. Must be within the valid range [0, 8].
 	 * @param Hand Specifies which controller hand (left, right, or both) the effect should be applied to.
+	 * @param Layer The layer of the trigger effect stack the effect is written to.
 	 */
-	void SetWeapon(int32 StartPosition, int32 EndPosition, int32 Strength, const EControllerHand& Hand);
+	void SetWeapon(int32 StartPosition, int32 EndPosition, int32 Strength, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer);
 	/**
 	 * Configures the bow effects for the DualSense adaptive triggers based on specified parameters.
 	 *
@@ -499,9 +531,10 @@ public:
 	 * @param BegingStrength The strength of the trigger at the starting position (1-8).
 	 * @param EndStrength The strength of the trigger at the ending position (1-8).
 	 * @param Hand The controller hand (Left, Right, or AnyHand) to apply the effect to.
+	 * @param Layer The layer of the trigger effect stack the effect is written to.
 	 */
 	void SetBow(int32 StartPosition, int32 EndPosition, int32 BegingStrength, int32 EndStrength,
-	                   const EControllerHand& Hand);
+	                   const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer);
 	/**
 	 * Sets machine effects for the DualSense controller's adaptive triggers.
 	 *
@@ -512,9 +545,10 @@ public:
 	 * @param Frequency The frequency of the vibration, controlling the oscillation speed.
 	 * @param Period The time period of the vibration effect, influencing its duration.
 	 * @param Hand The hand (Left, Right, or AnyHand) to apply the effect to.
+	 * @param Layer The layer of the trigger effect stack the effect is written to.
 	 */
 	void SetMachine(int32 StartPosition, int32 EndPosition, int32 AmplitudeBegin, int32 AmplitudeEnd,
-	                       float Frequency, float Period, const EControllerHand& Hand);
+	                       float Frequency, float Period, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer);
 	/**
 	 * @brief Configures the galloping effect for a controller's trigger.
 	 *
@@ -528,9 +562,10 @@ public:
 	 * @param SecondFoot Intensity of the second foot in the galloping effect, represented as an integer.
 	 * @param Frequency The frequency of the galloping effect, typically a value between 0.0 and 1.0 representing normalized intensity.
 	 * @param Hand Specifies which controller hand the effect applies to (Left, Right, or AnyHand).
+	 * @param Layer The layer of the trigger effect stack the effect is written to.
 	 */
 	void SetGalloping(int32 StartPosition, int32 EndPosition, int32 FirstFoot, int32 SecondFoot, float Frequency,
-	                  const EControllerHand& Hand);
+	                  const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer);
 	/**
 	 * Sets the LED player indicator effects based on the desired player LED pattern and brightness intensity.
 	 *
@@ -552,9 +587,12 @@ public:
 	 * brightness transition duration, and toggle interval. It is used
 	 * to control the visual feedback on devices that have a lightbar feature.
 	 *
+	 * The DualSense can not flash the lightbar by itself: when both times are set, the output thread
+	 * pulses the color instead, lit for BrithnessTime and off for ToggleTime.
+	 *
 	 * @param Color The desired color of the lightbar, represented as an FColor.
-	 * @param BrithnessTime The duration for transitioning the brightness, in seconds.
-	 * @param ToggleTime The duration for toggling the lightbar on and off, in seconds.
+	 * @param BrithnessTime The duration the lightbar stays lit while flashing, in seconds.
+	 * @param ToggleTime The duration the lightbar stays off while flashing, in seconds.
 	 */
 	virtual void SetLightbar(FColor Color, float BrithnessTime = 0.0f, float ToggleTime = 0.0f) override;
 	/**
@@ -646,13 +684,30 @@ public:
 	void SetTouch(bool bIsTouch);
 	
 	/**
-	 * Stops any ongoing adaptive trigger effects on the specified controller hand.
+	 * Stops any ongoing adaptive trigger effects on the specified controller hand, on the default layer
+	 * of the trigger effect stack.
 	 *
 	 * @param Hand The hand for which to stop the adaptive trigger effect.
 	 *             Acceptable values are EControllerHand::Left, EControllerHand::Right,
 	 *             or EControllerHand::AnyHand.
 	 */
 	void StopTrigger(const EControllerHand& Hand);
+	/**
+	 * Sets a trigger effect that is already encoded, e.g. a compiled trigger preset.
+	 *
+	 * @param Effect The effect.
+	 * @param Hand The controller hand (Left, Right, or AnyHand) to apply the effect to.
+	 * @param Layer The layer of the trigger effect stack the effect is written to.
+	 */
+	void SetTriggerEffect(const FHapticTriggers& Effect, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer);
+	/**
+	 * Clears one layer of the trigger effect stack, revealing the effects of the layers below it.
+	 *
+	 * @param Layer The layer to clear.
+	 * @param Hand The controller hand (Left, Right, or AnyHand) whose trigger is cleared.
+	 * @param FadeOut Time over which the effect of the layer fades out, in seconds.
+	 */
+	void ClearTriggerLayer(ESonyGamepadTriggerLayer Layer, const EControllerHand& Hand, float FadeOut);
 	/**
 	 * @brief Stops all ongoing input and feedback operations on the DualSense controller.
 	 *
@@ -708,20 +763,10 @@ public:
 	 */
 	int32 ControllerID;
 	/**
-	 * A map representing the states of various buttons on a controller.
-	 *
-	 * Each key in the map is a button name (FName), and its associated value is a boolean
-	 * indicating whether the button is currently pressed (`true`) or not pressed (`false`).
-	 *
-	 * This variable is primarily used for tracking button input states and ensuring
-	 * accurate representation of input events, such as detecting when a button's state
-	 * changes from pressed to released or vice versa.
-	 *
-	 * The map is updated dynamically during controller runtime, including in functions
-	 * like CheckButtonInput, which ensures real-time synchronization of input states.
-	 * It is reset during library shutdown to clear all stored button states.
+	 * The input state decoded from the last report dispatched to the engine.
+	 * Button events are generated from the bits that differ between this state and the next one.
 	 */
-	TMap<const FName, bool> ButtonStates;
+	FSonyGamepadInputState InputState;
 	
 protected:
 	/**
@@ -745,6 +790,27 @@ protected:
 	static FGenericPlatformInputDeviceMapper PlatformInputDeviceMapper;
 	
 private:
+	/**
+	 * Queues an output command for the output scheduler, from any thread. Without the scheduler thread,
+	 * the command is applied to the device context and the report is written from the calling thread.
+	 *
+	 * @param Command The command.
+	 */
+	void SendCommand(const FOutputCommand& Command);
+	/**
+	 * Queues a trigger effect for one or both triggers.
+	 *
+	 * @param Hand The trigger, or AnyHand for both.
+	 * @param Effect The complete effect, which replaces the current one of its layer.
+	 * @param Layer The layer of the trigger effect stack the effect is written to. Carried by the
+	 * command, so effects sent from several threads never pick up each other's layer.
+	 */
+	void SendTriggerEffect(const EControllerHand& Hand, const FHapticTriggers& Effect, const FSonyGamepadTriggerLayer& Layer = FSonyGamepadTriggerLayer());
+	/**
+	 * Set while the lightbar flashes from SetLightbar, so a steady color stops the flash but not the
+	 * animations played by the game.
+	 */
+	bool bLightbarFlashing = false;
 	/**
 	 * @brief A variable that indicates whether touch functionality is enabled or disabled.
 	 *
@@ -813,4 +879,33 @@ private:
 	 * initialization, input handling, and managing device-specific settings.
 	 */
 	FDeviceContext HIDDeviceContexts;
+	/**
+	 * Reads input reports on a dedicated thread and buffers them until UpdateInput consumes them.
+	 * Null when the reader could not be started, in which case reports are read synchronously.
+	 */
+	TUniquePtr<FDeviceInputReader> InputReader;
+	/**
+	 * Policy used by UpdateInput to consume the reports buffered by InputReader.
+	 */
+	EPollingPolicy PollingPolicy = EPollingPolicy::NativeRate;
+	/**
+	 * Time between two samples with EPollingPolicy::FixedRate, in seconds.
+	 */
+	double FixedRateInterval = 0.0;
+	/**
+	 * Sensor fusion of the device, used when reports are read synchronously. With the reader
+	 * thread, the fusion runs on that thread instead.
+	 */
+	FMotionFusion MotionFusion;
+	/**
+	 * Dispatches the analog, button, touch and motion events of a decoded state, and keeps it
+	 * as the reference the next state is compared with.
+	 *
+	 * @param InMessageHandler The message handler responsible for dispatching input events.
+	 * @param UserId The platform user ID associated with the controller.
+	 * @param InputDeviceId The unique identifier for the input device.
+	 * @param State The state decoded from the report currently held in the device context.
+	 */
+	void ProcessInputReport(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
+	                        const FPlatformUserId UserId, const FInputDeviceId InputDeviceId, const FSonyGamepadInputState& State);
 };
@@ -7,6 +7,9 @@
 #include "CoreMinimal.h"
 #include "Core/Interfaces/SonyGamepadInterface.h"
 #include "Core/Structs/FDualShockFeatureReport.h"
+#include "Core/Input/DeviceInputReader.h"
+#include "Core/Output/OutputCommandQueue.h"
+#include "Core/Structs/FSonyGamepadInputState.h"
 #include "UObject/Object.h"
 #include "DualShockLibrary.generated.h"
 
@@ -98,21 +101,6 @@ public:
 	 * buffering to the appropriate manager, ensuring proper data flow to the device.
 	 */
 	virtual void SendOut() override;
-	/**
-	 * @brief Handles button input events for a DualSense controller.
-	 *
-	 * This function checks the current state of a button on a DualSense controller and triggers
-	 * appropriate input events (button press or release) based on the change in its state.
-	 *
-	 * @param InMessageHandler The message handler responsible for dispatching input events.
-	 * @param UserId The platform user ID associated with the controller.
-	 * @param InputDeviceId The unique identifier for the DualSense input device.
-	 * @param ButtonName The name of the button being checked.
-	 * @param IsButtonPressed A boolean indicating the current pressed state of the button (true if pressed, false otherwise).
-	 */
-	virtual void CheckButtonInput(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
-								  const FPlatformUserId UserId, const FInputDeviceId InputDeviceId,
-								  const FName ButtonName, const bool IsButtonPressed);
 	/**
 	 * @brief Updates the input state for a DualSense device.
 	 *
@@ -149,6 +137,46 @@ public:
 	{
 		return LevelBattery;
 	}
+	/**
+	 * Retrieves the report rate measured by the input reader thread.
+	 *
+	 * @return The report rate in Hz, or 0 when the device is read synchronously.
+	 */
+	virtual float GetReportRate() const override
+	{
+		return InputReader.IsValid() ? InputReader->GetReportRate() : 0.0f;
+	}
+	/**
+	 * Sets how pending input reports are consumed by UpdateInput.
+	 *
+	 * @param Policy With NativeRate every pending report is delivered, with FixedRate the pending reports
+	 *               spaced FixedRateHz apart, otherwise only the latest one.
+	 * @param FixedRateHz Sampling rate used by EPollingPolicy::FixedRate.
+	 */
+	virtual void SetPollingPolicy(const EPollingPolicy Policy, const float FixedRateHz) override
+	{
+		PollingPolicy = Policy;
+		FixedRateInterval = FixedRateHz > 0.0f ? 1.0 / FixedRateHz : 0.0;
+	}
+	/**
+	 * Retrieves the latency measured between report arrival and dispatch.
+	 *
+	 * @return The latency statistics, empty when the device is read synchronously.
+	 */
+	virtual FInputLatencyStats GetInputLatency() const override
+	{
+		return InputReader.IsValid() ? InputReader->GetLatencyStats() : FInputLatencyStats();
+	}
+	/**
+	 * Clears the latency statistics of the input reader.
+	 */
+	virtual void ResetInputLatency() override
+	{
+		if (InputReader.IsValid())
+		{
+			InputReader->ResetLatencyStats();
+		}
+	}
 	/**
 	 * Sets the color of the lightbar on the Sony gamepad.
 	 *
@@ -249,20 +277,10 @@ public:
 	 */
 	int32 ControllerID;
 	/**
-	 * A map representing the states of various buttons on a controller.
-	 *
-	 * Each key in the map is a button name (FName), and its associated value is a boolean
-	 * indicating whether the button is currently pressed (`true`) or not pressed (`false`).
-	 *
-	 * This variable is primarily used for tracking button input states and ensuring
-	 * accurate representation of input events, such as detecting when a button's state
-	 * changes from pressed to released or vice versa.
-	 *
-	 * The map is updated dynamically during controller runtime, including in functions
-	 * like CheckButtonInput, which ensures real-time synchronization of input states.
-	 * It is reset during library shutdown to clear all stored button states.
+	 * The input state decoded from the last report dispatched to the engine.
+	 * Button events are generated from the bits that differ between this state and the next one.
 	 */
-	TMap<const FName, bool> ButtonStates;
+	FSonyGamepadInputState InputState;
 protected:
 	/**
 	 * @brief The PlatformInputDeviceMapper is responsible for mapping platform-specific
@@ -284,6 +302,13 @@ protected:
 	 */
 	static FGenericPlatformInputDeviceMapper PlatformInputDeviceMapper;
 private:
+	/**
+	 * Queues an output command for the output scheduler, from any thread. Without the scheduler thread,
+	 * the command is applied to the device context and the report is written from the calling thread.
+	 *
+	 * @param Command The command.
+	 */
+	void SendCommand(const FOutputCommand& Command);
 	/**
 	 * @brief Represents the current battery level of a device.
 	 *
@@ -321,4 +346,46 @@ private:
 	 * initialization, input handling, and managing device-specific settings.
 	 */
 	FDeviceContext HIDDeviceContexts;
+	/**
+	 * Reads input reports on a dedicated thread and buffers them until UpdateInput consumes them.
+	 * Null when the reader could not be started, in which case reports are read synchronously.
+	 */
+	TUniquePtr<FDeviceInputReader> InputReader;
+	/**
+	 * Policy used by UpdateInput to consume the reports buffered by InputReader.
+	 */
+	EPollingPolicy PollingPolicy = EPollingPolicy::NativeRate;
+	/**
+	 * Time between two samples with EPollingPolicy::FixedRate, in seconds.
+	 */
+	double FixedRateInterval = 0.0;
+	/**
+	 * Sensor fusion of the device, used when reports are read synchronously. With the reader
+	 * thread, the fusion runs on that thread instead.
+	 */
+	FMotionFusion MotionFusion;
+	/**
+	 * Dispatches the analog, button, touch and motion events of a decoded state, and keeps it
+	 * as the reference the next state is compared with.
+	 *
+	 * @param InMessageHandler The message handler responsible for dispatching input events.
+	 * @param UserId The platform user ID associated with the controller.
+	 * @param InputDeviceId The unique identifier for the input device.
+	 * @param State The state decoded from the report currently held in the device context.
+	 */
+	void ProcessInputReport(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
+	                        const FPlatformUserId UserId, const FInputDeviceId InputDeviceId, const FSonyGamepadInputState& State);
+	/**
+	 * @return The buffer the current connection type receives its input reports in.
+	 */
+	unsigned char* GetInputBuffer(uint32& OutSize)
+	{
+		if (HIDDeviceContexts.ConnectionType == Bluetooth)
+		{
+			OutSize = sizeof(HIDDeviceContexts.BufferDS4);
+			return HIDDeviceContexts.BufferDS4;
+		}
+		OutSize = sizeof(HIDDeviceContexts.Buffer);
+		return HIDDeviceContexts.Buffer;
+	}
 };
@@ -45,6 +45,26 @@
 #define PLAYER_LED_MIDDLE_LEFT 0x02
 #define PLAYER_LED_MIDDLE_RIGHT 0x08
 
+/**
+ * Raw gyroscope counts per degree per second (+/-2000 deg/s over 16 bits), shared by DualSense and DualShock 4.
+ */
+#define GYRO_RAW_PER_DEGREE_S 16.384f
+/**
+ * Raw accelerometer counts per g (+/-4 g over 16 bits), shared by DualSense and DualShock 4.
+ */
+#define ACCEL_RAW_PER_G 8192.0f
+/**
+ * Standard gravity, in m/s^2, used to convert the accelerometer from g.
+ */
+#define STANDARD_GRAVITY 9.80665f
+
+/**
+ * Resolution of the touchpad of the DualSense. The DualShock 4 reports the same width and a shorter height.
+ */
+#define TOUCHPAD_WIDTH 1920.0f
+#define TOUCHPAD_HEIGHT 1080.0f
+#define TOUCHPAD_HEIGHT_DUALSHOCK4 942.0f
+
 /**
  * @brief Enum class representing various LED microphone states.
  *
@@ -0,0 +1,26 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EInputSamplingPoint.generated.h"
+
+/**
+ * @enum EInputSamplingPoint
+ * Defines at which point of the engine frame the buffered input reports are consumed and dispatched.
+ *
+ * @value Tick Reports are consumed in the input device Tick. The application calls Tick and SendControllerEvents
+ *             back to back when it polls the game devices, so this samples at the same point as SendControllerEvents.
+ * @value SendControllerEvents Reports are consumed when the application polls the game devices, right after Tick.
+ * @value FrameBegin Reports are consumed when the frame begins, slightly earlier than the application polls the game
+ *                   devices, so the new state is already visible to the code listening to the start of the frame.
+ */
+UENUM(BlueprintType)
+enum class EInputSamplingPoint : uint8
+{
+	Tick UMETA(DisplayName = "Input Device Tick"),
+	SendControllerEvents UMETA(DisplayName = "Send Controller Events"),
+	FrameBegin UMETA(DisplayName = "Frame Begin")
+};
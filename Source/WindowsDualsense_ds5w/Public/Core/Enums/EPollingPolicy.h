@@ -0,0 +1,26 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EPollingPolicy.generated.h"
+
+/**
+ * @enum EPollingPolicy
+ * Defines how often the input reports produced by a device are sampled and delivered to the engine.
+ *
+ * @value EveryFrame The most recent report is decoded once per engine frame; older reports are skipped.
+ * @value FixedRate The buffered reports are sampled at a fixed rate along their arrival times on the reader
+ *                  thread, so one frame may deliver several samples. Without the reader thread the device
+ *                  is read once per frame and this behaves like EveryFrame.
+ * @value NativeRate Every report produced by the device is decoded and delivered, in arrival order.
+ */
+UENUM(BlueprintType)
+enum class EPollingPolicy : uint8
+{
+	EveryFrame UMETA(DisplayName = "Every Frame"),
+	FixedRate UMETA(DisplayName = "Fixed Rate"),
+	NativeRate UMETA(DisplayName = "Native Device Rate")
+};
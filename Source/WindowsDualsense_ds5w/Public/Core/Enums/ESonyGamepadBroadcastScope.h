@@ -0,0 +1,24 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ESonyGamepadBroadcastScope.generated.h"
+
+/**
+ * @enum ESonyGamepadBroadcastScope
+ * The controllers a broadcast effect is sent to.
+ *
+ * @value All Every connected controller.
+ * @value Team The connected controllers of one team, as set with SetControllerTeam.
+ * @value Mask The connected controllers whose bit is set in a mask.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadBroadcastScope : uint8
+{
+	All UMETA(DisplayName = "All"),
+	Team UMETA(DisplayName = "Team"),
+	Mask UMETA(DisplayName = "Mask")
+};
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ESonyGamepadButton.generated.h"
+
+/**
+ * @enum ESonyGamepadButton
+ * Bit index of each button in the button word of FSonyGamepadInputState.
+ * The stick directions are digital buttons derived from the analog sticks, as in FGamepadKeyNames.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadButton : uint8
+{
+	Cross,
+	Square,
+	Circle,
+	Triangle,
+	DPadUp UMETA(DisplayName = "D-Pad Up"),
+	DPadDown UMETA(DisplayName = "D-Pad Down"),
+	DPadLeft UMETA(DisplayName = "D-Pad Left"),
+	DPadRight UMETA(DisplayName = "D-Pad Right"),
+	LeftShoulder UMETA(DisplayName = "L1"),
+	RightShoulder UMETA(DisplayName = "R1"),
+	LeftTrigger UMETA(DisplayName = "L2"),
+	RightTrigger UMETA(DisplayName = "R2"),
+	LeftThumb UMETA(DisplayName = "L3"),
+	RightThumb UMETA(DisplayName = "R3"),
+	Menu UMETA(DisplayName = "Options"),
+	Share UMETA(DisplayName = "Share / Create"),
+	PlayStation,
+	TouchPad,
+	Mic,
+	FunctionL UMETA(DisplayName = "Left Function (Edge)"),
+	FunctionR UMETA(DisplayName = "Right Function (Edge)"),
+	PaddleL UMETA(DisplayName = "Left Paddle (Edge)"),
+	PaddleR UMETA(DisplayName = "Right Paddle (Edge)"),
+	LeftStickUp,
+	LeftStickDown,
+	LeftStickLeft,
+	LeftStickRight,
+	RightStickUp,
+	RightStickDown,
+	RightStickLeft,
+	RightStickRight,
+	Count UMETA(Hidden)
+};
+
+static_assert(static_cast<uint8>(ESonyGamepadButton::Count) <= 32, "The button word of FSonyGamepadInputState holds 32 buttons.");
@@ -0,0 +1,32 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ESonyGamepadChannel.generated.h"
+
+/**
+ * @enum ESonyGamepadChannel
+ * Analog channels recorded for every decoded report by FInputSampleHistory.
+ * Sticks and triggers are normalized as in FSonyGamepadInputState, the gyroscope and accelerometer
+ * are calibrated sensor units.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadChannel : uint8
+{
+	LeftStickX,
+	LeftStickY,
+	RightStickX,
+	RightStickY,
+	LeftTrigger UMETA(DisplayName = "L2"),
+	RightTrigger UMETA(DisplayName = "R2"),
+	GyroscopeX,
+	GyroscopeY,
+	GyroscopeZ,
+	AccelerometerX,
+	AccelerometerY,
+	AccelerometerZ,
+	Count UMETA(Hidden)
+};
@@ -0,0 +1,27 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ESonyGamepadDeadzone.generated.h"
+
+/**
+ * @enum ESonyGamepadDeadzone
+ * Defines how the deadzone of a stick is applied.
+ *
+ * @value None The stick is passed through, only the response curve applies.
+ * @value Axial Each axis has its own deadzone. Keeps the axes clean, but snaps diagonals to them.
+ * @value Radial The deadzone applies to the distance from the center; outside of it the value is unchanged.
+ * @value ScaledRadial The distance from the center is rescaled from the inner to the outer deadzone,
+ * so the output starts at zero right outside the deadzone, with no jump.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadDeadzone : uint8
+{
+	None,
+	Axial,
+	Radial,
+	ScaledRadial UMETA(DisplayName = "Scaled Radial")
+};
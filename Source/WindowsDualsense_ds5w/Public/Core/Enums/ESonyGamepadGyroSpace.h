@@ -0,0 +1,26 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ESonyGamepadGyroSpace.generated.h"
+
+/**
+ * @enum ESonyGamepadGyroSpace
+ * Defines which rotation of the controller turns the camera horizontally.
+ *
+ * @value Local Rotation around the vertical axis of the controller. Consistent in the hand, but rolling
+ * the controller while it is tilted turns the camera.
+ * @value Player Mostly around gravity, blended with the local yaw and roll, so both turning and rolling the
+ * controller turn the camera whichever way it is held.
+ * @value World Rotation around gravity only, matching how a pointer held in front of the player moves.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadGyroSpace : uint8
+{
+	Local UMETA(DisplayName = "Local Space"),
+	Player UMETA(DisplayName = "Player Space"),
+	World UMETA(DisplayName = "World Space")
+};
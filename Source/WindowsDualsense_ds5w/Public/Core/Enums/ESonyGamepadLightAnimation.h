@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ESonyGamepadLightAnimation.generated.h"
+
+/**
+ * @enum ESonyGamepadLightbarMode
+ * How a lightbar animation computes its color.
+ *
+ * @value Gradient The color is interpolated between keys, over time or along a value set by the game.
+ * @value Pulse The lightbar switches between two colors.
+ * @value Breathe The lightbar fades smoothly from one color to another and back.
+ * @value Rainbow The hue cycles through the color wheel.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadLightbarMode : uint8
+{
+	Gradient UMETA(DisplayName = "Gradient"),
+	Pulse UMETA(DisplayName = "Pulse"),
+	Breathe UMETA(DisplayName = "Breathe"),
+	Rainbow UMETA(DisplayName = "Rainbow")
+};
+
+/**
+ * @enum ESonyGamepadLightEasing
+ * How a gradient moves from one key to the next.
+ *
+ * @value Linear At a constant pace.
+ * @value EaseIn Slowly at first, then faster.
+ * @value EaseOut Fast at first, then slower.
+ * @value EaseInOut Slowly at both ends.
+ * @value Step The color of the key holds until the next key.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadLightEasing : uint8
+{
+	Linear UMETA(DisplayName = "Linear"),
+	EaseIn UMETA(DisplayName = "Ease In"),
+	EaseOut UMETA(DisplayName = "Ease Out"),
+	EaseInOut UMETA(DisplayName = "Ease In Out"),
+	Step UMETA(DisplayName = "Step")
+};
+
+/**
+ * @enum ESonyGamepadPlayerLedPattern
+ * Patterns the five player LEDs of the DualSense can play.
+ *
+ * @value Blink The chosen LEDs switch on and off.
+ * @value Chase A single LED runs from left to right.
+ * @value Bounce A single LED runs from left to right and back.
+ * @value Fill The LEDs light up one by one from the left, then all go off.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadPlayerLedPattern : uint8
+{
+	Blink UMETA(DisplayName = "Blink"),
+	Chase UMETA(DisplayName = "Chase"),
+	Bounce UMETA(DisplayName = "Bounce"),
+	Fill UMETA(DisplayName = "Fill")
+};
@@ -0,0 +1,43 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ESonyGamepadRumbleSource.generated.h"
+
+/**
+ * @enum ESonyGamepadRumbleSource
+ * The producers of rumble, mixed into the single rumble the controller plays.
+ *
+ * @value Gameplay Force feedback from the engine, SetVibration and the rumble curves and envelopes.
+ * @value Audio Rumble derived from the audio, e.g. SetVibrationFromAudio.
+ * @value UI Feedback of menus and other interface elements.
+ * @value Cinematic The rumble of the haptic clips.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadRumbleSource : uint8
+{
+	Gameplay UMETA(DisplayName = "Gameplay"),
+	Audio UMETA(DisplayName = "Audio"),
+	UI UMETA(DisplayName = "UI"),
+	Cinematic UMETA(DisplayName = "Cinematic"),
+	Count UMETA(Hidden)
+};
+
+/**
+ * @enum ESonyGamepadRumbleBlend
+ * How a rumble source combines with the mix of the sources of lower priority.
+ *
+ * @value Max The stronger of the source and the mix plays.
+ * @value SumClamp The source is added to the mix, up to full strength.
+ * @value Duck While the source plays, the mix is lowered to its duck level and the stronger of the two plays.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadRumbleBlend : uint8
+{
+	Max UMETA(DisplayName = "Max"),
+	SumClamp UMETA(DisplayName = "Sum (Clamped)"),
+	Duck UMETA(DisplayName = "Duck")
+};
@@ -0,0 +1,34 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ESonyGamepadTriggerEffect.generated.h"
+
+/**
+ * @enum ESonyGamepadTriggerEffect
+ * The adaptive trigger effects of a DualSense, as set by the trigger effect functions of UDualSenseProxy.
+ *
+ * @value Off No effect.
+ * @value ContinuousResistance Constant resistance from the start position to the end of the travel.
+ * @value Resistance Resistance of a different strength at the beginning, middle and end of the travel.
+ * @value Weapon A trigger that snaps between the start and end positions.
+ * @value Galloping Two taps repeated at the frequency, like the feet of a galloping horse.
+ * @value Machine Vibration alternating between two amplitudes over the period.
+ * @value Bow Tension building from the start position and released at the end position.
+ * @value AutomaticGun Vibration of a different strength at the beginning, middle and end of the travel.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadTriggerEffect : uint8
+{
+	Off UMETA(DisplayName = "Off"),
+	ContinuousResistance UMETA(DisplayName = "Continuous Resistance"),
+	Resistance UMETA(DisplayName = "Resistance"),
+	Weapon UMETA(DisplayName = "Weapon"),
+	Galloping UMETA(DisplayName = "Galloping"),
+	Machine UMETA(DisplayName = "Machine"),
+	Bow UMETA(DisplayName = "Bow"),
+	AutomaticGun UMETA(DisplayName = "Automatic Gun")
+};
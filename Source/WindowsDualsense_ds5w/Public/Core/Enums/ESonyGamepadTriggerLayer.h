@@ -0,0 +1,26 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ESonyGamepadTriggerLayer.generated.h"
+
+/**
+ * @enum ESonyGamepadTriggerLayer
+ * The layers of the trigger effect stack. Each trigger holds one effect per layer, and the output
+ * stage plays the one of highest priority.
+ *
+ * @value Environment Base resistance of the world, e.g. mud, water or a heavy door.
+ * @value Weapon The effect of the equipped weapon or tool. The trigger effect setters write here by default.
+ * @value Feedback Short effects on top of everything else, e.g. a hit or an empty magazine.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadTriggerLayer : uint8
+{
+	Environment UMETA(DisplayName = "Environment"),
+	Weapon UMETA(DisplayName = "Weapon"),
+	Feedback UMETA(DisplayName = "Feedback"),
+	Count UMETA(Hidden)
+};
@@ -0,0 +1,89 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Core/Structs/FSonyGamepadAnalogSettings.h"
+#include "Core/Structs/FSonyGamepadInputState.h"
+
+/**
+ * Number of entries of each conditioning table. The sticks and triggers report 8-bit values, so the
+ * axial and trigger tables hold the exact output of every possible raw value.
+ */
+#define ANALOG_CONDITIONER_TABLE_SIZE 256
+
+/**
+ * @brief Applies the deadzones and response curves of a controller to its sticks and triggers.
+ *
+ * The settings are compiled into tables when they change: one per stick axis for the axial
+ * deadzone, one for the triggers, and one for the radial deadzones, indexed by the squared
+ * distance of the stick from its center so no square root is needed per report. Conditioning
+ * a report then costs a few table reads on the input reader thread.
+ *
+ * The conditioner also filters noise: an axis keeps its previous value until it moves by more
+ * than the change epsilon, so the unchanged axes do not generate analog events.
+ */
+class WINDOWSDUALSENSE_DS5W_API FAnalogConditioner
+{
+public:
+	/**
+	 * Starts with the default settings, which leave the values untouched.
+	 */
+	FAnalogConditioner();
+	/**
+	 * Compiles and replaces the settings. Safe to call from any thread; applied from the next conditioned report.
+	 *
+	 * @param InSettings The new settings.
+	 */
+	void SetSettings(const FSonyGamepadAnalogSettings& InSettings);
+	/**
+	 * Conditions the sticks and triggers of a freshly decoded state in place. Must only be called from one thread at a time.
+	 *
+	 * @param State The decoded state.
+	 */
+	void Apply(FSonyGamepadInputState& State);
+	/**
+	 * Forgets the values held by the change filter, e.g. when the device disconnects. Must not race with Apply.
+	 */
+	void Reset();
+
+private:
+	/**
+	 * The compiled form of a set of settings.
+	 */
+	struct FTables
+	{
+		/**
+		 * Output of an axis for each raw value, with the axial deadzone and the curve applied.
+		 */
+		float StickAxial[ANALOG_CONDITIONER_TABLE_SIZE];
+		/**
+		 * Factor the stick vector is multiplied by, for each squared distance from the center between 0 and 2.
+		 */
+		float StickRadial[ANALOG_CONDITIONER_TABLE_SIZE];
+		/**
+		 * Output of a trigger for each raw value.
+		 */
+		float Trigger[ANALOG_CONDITIONER_TABLE_SIZE];
+		ESonyGamepadDeadzone StickDeadzoneType = ESonyGamepadDeadzone::None;
+		float ChangeEpsilon = 0.0f;
+	};
+
+	static void Compile(const FSonyGamepadAnalogSettings& InSettings, FTables& OutTables);
+	FVector2D ConditionStick(const FVector2D& Stick) const;
+	float Hold(int32 Axis, float Value);
+
+	FCriticalSection SettingsLock;
+	FTables PendingTables;
+	std::atomic<bool> bTablesDirty{false};
+
+	FTables Tables;
+	/**
+	 * Last value let through the change filter, per axis: left stick X and Y, right stick X and Y, left and right trigger.
+	 */
+	float Held[6] = {};
+};
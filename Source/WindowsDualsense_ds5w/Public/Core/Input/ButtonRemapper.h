@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Core/Structs/FSonyGamepadButtonRemap.h"
+
+/**
+ * @brief Applies a button remapping profile to the button word of a controller.
+ *
+ * A profile is compiled into four tables of 256 words, one per byte of the button word: each
+ * entry holds the remapped bits of every button set in that byte. Remapping a report is then
+ * four table reads and three ORs, whatever the number of remapped buttons, and runs on the input
+ * reader thread before the button events are generated.
+ *
+ * Profiles are swapped with a single atomic pointer store, so a new profile applies from the next
+ * report without locking the reader. Apply announces the table it reads in a hazard pointer, and a
+ * replaced table is freed by the next publish that finds it no longer announced, so at most two
+ * tables wait to be freed whatever the number of profile changes.
+ */
+class WINDOWSDUALSENSE_DS5W_API FButtonRemapper
+{
+public:
+	/**
+	 * Compiles and activates a profile. Safe to call from any thread.
+	 *
+	 * @param Profile The profile.
+	 */
+	void SetProfile(const FSonyGamepadButtonRemap& Profile);
+	/**
+	 * Deactivates the current profile, so every button keeps its own function. Safe to call from any thread.
+	 */
+	void ClearProfile();
+	/**
+	 * Remaps a button word. Must only be called from one thread at a time.
+	 *
+	 * @param Buttons The decoded button word, one bit per ESonyGamepadButton.
+	 * @return The remapped button word.
+	 */
+	int32 Apply(const int32 Buttons) const
+	{
+		// The table is announced before it is read, then loaded again: once the announce is visible to
+		// Publish, the table cannot be freed until the next call clears it.
+		const FTable* Table = Active.load(std::memory_order_acquire);
+		for (;;)
+		{
+			InUse.store(Table, std::memory_order_seq_cst);
+			const FTable* Current = Active.load(std::memory_order_seq_cst);
+			if (Current == Table)
+			{
+				break;
+			}
+			Table = Current;
+		}
+
+		int32 Remapped = Buttons;
+		if (Table)
+		{
+			const uint32 Word = static_cast<uint32>(Buttons);
+			Remapped = static_cast<int32>(Table->Bytes[0][Word & 0xFF] | Table->Bytes[1][(Word >> 8) & 0xFF] |
+			                              Table->Bytes[2][(Word >> 16) & 0xFF] | Table->Bytes[3][Word >> 24]);
+		}
+		InUse.store(nullptr, std::memory_order_release);
+		return Remapped;
+	}
+	/**
+	 * Frees the replaced tables that are not being read. Safe to call from any thread.
+	 */
+	void ReleaseRetired();
+
+private:
+	/**
+	 * A compiled profile: the remapped bits for each value of each byte of the button word.
+	 */
+	struct FTable
+	{
+		uint32 Bytes[4][256];
+	};
+
+	void Publish(TUniquePtr<FTable> Table);
+	/**
+	 * Frees the retired tables Apply does not announce. TablesLock must be held.
+	 */
+	void ReclaimRetired();
+
+	std::atomic<const FTable*> Active{nullptr};
+	/**
+	 * Hazard pointer: the table Apply is reading, or nullptr between two calls.
+	 */
+	mutable std::atomic<const FTable*> InUse{nullptr};
+
+	FCriticalSection TablesLock;
+	/**
+	 * Owner of the active table.
+	 */
+	TUniquePtr<FTable> Current;
+	/**
+	 * Replaced tables that were still announced by Apply when they were retired. Holds at most two
+	 * tables, since Apply announces a single one.
+	 */
+	TArray<TUniquePtr<FTable>, TInlineAllocator<2>> Retired;
+};
@@ -0,0 +1,270 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Core/Structs/FInputLatencyStats.h"
+#include "Core/Input/AnalogConditioner.h"
+#include "Core/Input/ButtonRemapper.h"
+#include "Core/Input/GyroLookProcessor.h"
+#include "Core/Input/InputSampleHistory.h"
+#include "Core/Input/InputStateBuffer.h"
+#include "Core/Input/SonyInputDecoder.h"
+#include "Core/Input/TouchTracker.h"
+
+class FRunnableThread;
+
+/**
+ * Size, in bytes, of the largest raw input report read from any supported device
+ * (DualShock 4 over Bluetooth).
+ */
+#define SONY_GAMEPAD_MAX_REPORT_SIZE 547
+/**
+ * Number of raw input reports retained per device. Must be a power of two.
+ * At 250 Hz this covers 128 ms of input, several frames even at low frame rates.
+ */
+#define SONY_GAMEPAD_REPORT_RING_SIZE 32
+
+/**
+ * @brief A raw input report as received from the device, stamped with its arrival time.
+ */
+struct FInputReport
+{
+	/**
+	 * Arrival time of the report, in seconds, from FPlatformTime::Seconds().
+	 */
+	double Timestamp = 0.0;
+	/**
+	 * Engine frame counter (GFrameCounter) at the arrival of the report.
+	 */
+	uint64 FrameNumber = 0;
+	/**
+	 * Monotonic index of the report since the reader started.
+	 */
+	uint64 Sequence = 0;
+	/**
+	 * Number of valid bytes in Data.
+	 */
+	uint32 Length = 0;
+	/**
+	 * Raw report bytes, including the report id.
+	 */
+	unsigned char Data[SONY_GAMEPAD_MAX_REPORT_SIZE];
+	/**
+	 * State decoded from the report on the reader thread, with the sensor fusion already applied.
+	 * Left default when no state publisher is set.
+	 */
+	FSonyGamepadInputState State;
+};
+
+/**
+ * @brief Reads input reports from a HID device on a dedicated thread.
+ *
+ * The reader opens its own handle to the device, so blocking reads never serialize with
+ * output reports written through the library handle. Every report is pushed into a fixed-size
+ * ring that the game thread drains without locks, either report by report or by jumping to
+ * the latest one. When the consumer falls more than a full ring behind, the oldest reports
+ * are dropped.
+ *
+ * The reader also measures the interval between reports, which gives the real report rate
+ * of the device (around 250 Hz over USB, variable over Bluetooth).
+ */
+class WINDOWSDUALSENSE_DS5W_API FDeviceInputReader final : public FRunnable
+{
+public:
+	/**
+	 * @param DevicePath Path of the HID device, as found by UDeviceHIDManager::FindDevices.
+	 * @param InReportLength Length, in bytes, of the input reports produced by the device.
+	 * @param NominalReportRate Expected report rate in Hz, used until enough reports were measured.
+	 */
+	FDeviceInputReader(const wchar_t* DevicePath, uint32 InReportLength, float NominalReportRate);
+	virtual ~FDeviceInputReader() override;
+
+	/**
+	 * Opens the device and starts the reader thread.
+	 *
+	 * @return False if the device could not be opened or the thread could not be created.
+	 */
+	bool Start();
+
+	/**
+	 * Decodes every report on the reader thread, runs the sensor fusion at the native rate of the IMU
+	 * and publishes the resulting state as soon as it arrives. Must be called before Start.
+	 *
+	 * @param InDecoder Decoder matching the device model.
+	 * @param InConnection Connection the device uses, which defines the report header length.
+	 * @param InCalibration IMU calibration of the device.
+	 * @param InStateBuffer Buffer the decoded states are published to.
+	 * @param InHistory History every decoded state is recorded in.
+	 */
+	void SetStatePublisher(FSonyInputDecoder::FDecodeFunction InDecoder, EDeviceConnection InConnection, const FImuCalibration& InCalibration,
+	                       FInputStateBuffer* InStateBuffer, FInputSampleHistory* InHistory)
+	{
+		Decoder = InDecoder;
+		Connection = InConnection;
+		Calibration = InCalibration;
+		StateBuffer = InStateBuffer;
+		History = InHistory;
+	}
+	/**
+	 * Feeds every decoded state to a gyro look processor. Must be called before Start.
+	 *
+	 * @param InLookProcessor The processor, or nullptr to disable it.
+	 */
+	void SetLookProcessor(FGyroLookProcessor* InLookProcessor)
+	{
+		LookProcessor = InLookProcessor;
+	}
+	/**
+	 * Tracks the touchpad contacts and recognizes gestures on every decoded state. Must be called before Start.
+	 *
+	 * @param InTouchTracker The tracker, or nullptr to disable it.
+	 */
+	void SetTouchTracker(FTouchTracker* InTouchTracker)
+	{
+		TouchTracker = InTouchTracker;
+	}
+	/**
+	 * Applies the deadzones and response curves to every decoded state. Must be called before Start.
+	 *
+	 * @param InConditioner The conditioner, or nullptr to leave the analog values raw.
+	 */
+	void SetAnalogConditioner(FAnalogConditioner* InConditioner)
+	{
+		AnalogConditioner = InConditioner;
+	}
+	/**
+	 * Remaps the buttons of every decoded state. Must be called before Start.
+	 *
+	 * @param InRemapper The remapper, or nullptr to leave the buttons as decoded.
+	 */
+	void SetButtonRemapper(const FButtonRemapper* InRemapper)
+	{
+		ButtonRemapper = InRemapper;
+	}
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	/**
+	 * Copies the oldest report not yet consumed into OutBuffer.
+	 *
+	 * @param OutBuffer Destination buffer.
+	 * @param BufferSize Size of the destination buffer, in bytes.
+	 * @param OutTimestamp Optional arrival time of the returned report.
+	 * @param OutState Optional state decoded from the returned report.
+	 * @return True if a report was copied.
+	 */
+	bool PopNext(unsigned char* OutBuffer, uint32 BufferSize, double* OutTimestamp = nullptr, FSonyGamepadInputState* OutState = nullptr);
+	/**
+	 * Skips every pending report except the newest one and copies it into OutBuffer.
+	 *
+	 * @param OutBuffer Destination buffer.
+	 * @param BufferSize Size of the destination buffer, in bytes.
+	 * @param OutTimestamp Optional arrival time of the returned report.
+	 * @param OutState Optional state decoded from the returned report.
+	 * @return True if a report was copied, false if no new report arrived since the last pop.
+	 */
+	bool PopLatest(unsigned char* OutBuffer, uint32 BufferSize, double* OutTimestamp = nullptr, FSonyGamepadInputState* OutState = nullptr);
+	/**
+	 * Skips the pending reports that arrived before the next sampling time and copies the first one after it
+	 * into OutBuffer. Called until it returns false, it samples the reports at a fixed rate along their arrival
+	 * times, regardless of how often the game thread polls.
+	 *
+	 * @param Interval Time between two samples, in seconds. Intervals shorter than the report interval deliver every report.
+	 * @param OutBuffer Destination buffer.
+	 * @param BufferSize Size of the destination buffer, in bytes.
+	 * @param OutTimestamp Optional arrival time of the returned report.
+	 * @param OutState Optional state decoded from the returned report.
+	 * @return True if a report was copied.
+	 */
+	bool PopAtRate(double Interval, unsigned char* OutBuffer, uint32 BufferSize, double* OutTimestamp = nullptr, FSonyGamepadInputState* OutState = nullptr);
+
+	/**
+	 * @return True once a read failed, which means the device was unplugged or went out of range.
+	 */
+	bool IsDeviceLost() const
+	{
+		return bDeviceLost.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @return The measured report rate of the device, in Hz.
+	 */
+	float GetReportRate() const
+	{
+		const float Interval = ReportInterval.load(std::memory_order_relaxed);
+		return Interval > 0.0f ? 1.0f / Interval : 0.0f;
+	}
+
+	/**
+	 * @return Number of reports dropped because the consumer fell more than a full ring behind.
+	 */
+	uint64 GetOverruns() const
+	{
+		return Overruns;
+	}
+
+	/**
+	 * @return Latency between arrival and consumption of the reports popped since the last reset.
+	 */
+	FInputLatencyStats GetLatencyStats() const
+	{
+		return Latency;
+	}
+	/**
+	 * Clears the latency statistics, e.g. after switching the sampling point.
+	 */
+	void ResetLatencyStats()
+	{
+		Latency = FInputLatencyStats();
+		LatencySumMs = 0.0;
+		LatencySumFrames = 0.0;
+	}
+
+private:
+	/**
+	 * A ring slot. Version is odd while the reader thread writes the slot.
+	 */
+	struct FSlot
+	{
+		std::atomic<uint32> Version{0};
+		FInputReport Report;
+	};
+
+	void Push(const unsigned char* Data, uint32 Length, double Timestamp, const FSonyGamepadInputState& State);
+	void RecordLatency(double Timestamp, uint64 FrameNumber);
+
+	wchar_t Path[260];
+	void* Handle;
+	uint32 ReportLength;
+	FSlot Slots[SONY_GAMEPAD_REPORT_RING_SIZE];
+	std::atomic<uint64> WriteIndex{0};
+	uint64 ReadIndex = 0;
+	/**
+	 * Arrival time from which PopAtRate delivers its next sample.
+	 */
+	double NextSampleTime = 0.0;
+	uint64 Overruns = 0;
+	std::atomic<float> ReportInterval;
+	std::atomic<bool> bStopping{false};
+	std::atomic<bool> bDeviceLost{false};
+	FRunnableThread* Thread;
+	FInputLatencyStats Latency;
+	FSonyInputDecoder::FDecodeFunction Decoder = nullptr;
+	EDeviceConnection Connection = Unrecognized;
+	FImuCalibration Calibration;
+	FInputStateBuffer* StateBuffer = nullptr;
+	FInputSampleHistory* History = nullptr;
+	FGyroLookProcessor* LookProcessor = nullptr;
+	FTouchTracker* TouchTracker = nullptr;
+	FAnalogConditioner* AnalogConditioner = nullptr;
+	const FButtonRemapper* ButtonRemapper = nullptr;
+	double LatencySumMs = 0.0;
+	double LatencySumFrames = 0.0;
+};
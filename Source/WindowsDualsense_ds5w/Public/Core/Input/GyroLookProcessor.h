@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Core/Structs/FSonyGamepadGyroLookSettings.h"
+#include "Core/Structs/FSonyGamepadInputState.h"
+
+/**
+ * @brief Turns the gyroscope and the right stick of a controller into camera rotation, report by report.
+ *
+ * Every decoded state is integrated on the input reader thread, with the sensitivity, acceleration
+ * curve, gyro space and flick stick of the settings, into a yaw and pitch delta. The delta is
+ * accumulated in a single atomic word, so the game thread consumes everything that happened since
+ * the previous frame with one exchange, however many reports arrived in between.
+ */
+class WINDOWSDUALSENSE_DS5W_API FGyroLookProcessor
+{
+public:
+	/**
+	 * Replaces the settings. Safe to call from any thread; applied from the next processed report.
+	 *
+	 * @param InSettings The new settings.
+	 */
+	void SetSettings(const FSonyGamepadGyroLookSettings& InSettings);
+	/**
+	 * Integrates one decoded state. Must only be called from one thread at a time.
+	 *
+	 * @param State The state, with the sensor fusion applied.
+	 */
+	void Process(const FSonyGamepadInputState& State);
+	/**
+	 * Returns the rotation accumulated since the previous call and restarts the accumulation.
+	 *
+	 * @return Yaw (X) and pitch (Y), in degrees. Positive yaw turns right, positive pitch looks up.
+	 */
+	FVector2D ConsumeDelta();
+	/**
+	 * Clears the accumulated rotation and the flick in progress, e.g. when the device disconnects.
+	 * Must not race with Process.
+	 */
+	void Reset();
+
+private:
+	void Accumulate(float Yaw, float Pitch);
+	float ProcessFlickStick(const FVector2D& Stick, float DeltaTime);
+
+	/**
+	 * Yaw and pitch accumulated since the last consumption, as two floats packed in one word.
+	 */
+	std::atomic<uint64> PackedDelta{0};
+
+	FCriticalSection SettingsLock;
+	FSonyGamepadGyroLookSettings PendingSettings;
+	std::atomic<bool> bSettingsDirty{false};
+
+	FSonyGamepadGyroLookSettings Settings;
+	double LastTimestamp = 0.0;
+	bool bFlickActive = false;
+	float FlickStickAngle = 0.0f;
+	float FlickTarget = 0.0f;
+	float FlickElapsed = 0.0f;
+};
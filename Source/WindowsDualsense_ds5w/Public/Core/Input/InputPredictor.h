@@ -0,0 +1,105 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Input/InputSampleHistory.h"
+#include "Core/Structs/FSonyGamepadPredictionSettings.h"
+#include "Core/Structs/FSonyGamepadPredictionStats.h"
+
+/**
+ * @brief Extrapolates the sticks and angular velocity of a controller to a target time, e.g. the
+ * expected present time of the frame.
+ *
+ * The rate of change of each channel is fitted by least squares on the newest samples of the
+ * history, and the newest sample is moved along it up to the horizon of the channel, with the
+ * correction clamped to the configured maximum.
+ *
+ * Each prediction is later compared to the values the device reported around its target time, and
+ * the error is accumulated with the error of not predicting at all, so the settings can be tuned
+ * against real input. Only one prediction is evaluated at a time, the others are served unmeasured.
+ */
+class WINDOWSDUALSENSE_DS5W_API FInputPredictor
+{
+public:
+	/**
+	 * Replaces the settings. Safe to call from any thread.
+	 *
+	 * @param InSettings The new settings.
+	 */
+	void SetSettings(const FSonyGamepadPredictionSettings& InSettings);
+	/**
+	 * Predicts the state of the controller at a target time. Safe to call from any thread.
+	 *
+	 * @param History The history of the controller.
+	 * @param Latest The newest state of the controller, used for every field that is not predicted.
+	 * @param TargetTime The time to predict, in seconds (FPlatformTime::Seconds()).
+	 * @param OutState Receives the latest state with the sticks and angular velocity predicted.
+	 * @return False if prediction is disabled or not enough samples were recorded, in which case OutState is the latest state.
+	 */
+	bool Predict(const FInputSampleHistory& History, const FSonyGamepadInputState& Latest, double TargetTime, FSonyGamepadInputState& OutState);
+	/**
+	 * @return The prediction error measured since the statistics were reset.
+	 */
+	FSonyGamepadPredictionStats GetStats() const;
+	/**
+	 * Clears the error statistics, e.g. after changing the settings.
+	 */
+	void ResetStats();
+	/**
+	 * Forgets the recent samples and the prediction being evaluated, e.g. when the device disconnects.
+	 */
+	void Reset();
+
+private:
+	/**
+	 * The predicted channels: left stick X and Y, right stick X and Y, gyroscope X, Y and Z.
+	 */
+	static constexpr int32 NumChannels = 7;
+	/**
+	 * Number of recent samples kept, the largest fit window.
+	 */
+	static constexpr int32 WindowSize = 8;
+
+	struct FPendingPrediction
+	{
+		double TargetTime = 0.0;
+		float Predicted[NumChannels] = {};
+		float Baseline[NumChannels] = {};
+		bool bValid = false;
+	};
+
+	struct FErrorAccumulator
+	{
+		int32 Samples = 0;
+		double SumAbsolute = 0.0;
+		double SumSquares = 0.0;
+		double SumBaseline = 0.0;
+		float Max = 0.0f;
+
+		void Add(float Error, float BaselineError);
+		FSonyGamepadPredictionError ToError() const;
+	};
+
+	void Ingest(const FInputSampleHistory& History);
+	void AddSample(double Timestamp, const float (&Values)[NumChannels]);
+	void Evaluate();
+	float FitSlope(int32 Channel, int32 NumSamples) const;
+	const FSonyGamepadChannelPrediction& GetChannelSettings(int32 Channel) const;
+
+	mutable FCriticalSection Lock;
+	FSonyGamepadPredictionSettings Settings;
+
+	/**
+	 * The newest samples, oldest first.
+	 */
+	double WindowTimes[WindowSize] = {};
+	float WindowValues[NumChannels][WindowSize] = {};
+	int32 WindowCount = 0;
+	uint64 Cursor = 0;
+
+	FPendingPrediction Pending;
+	FErrorAccumulator Errors[3];
+};
@@ -0,0 +1,154 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Core/Enums/ESonyGamepadChannel.h"
+#include "Core/Structs/FSonyGamepadInputState.h"
+
+/**
+ * Number of samples retained per device. Must be a power of two.
+ * At 250 Hz this covers about two seconds of input.
+ */
+#define SONY_GAMEPAD_HISTORY_SIZE 512
+
+class FInputSampleHistory;
+
+/**
+ * @brief A run of consecutive samples of an FInputSampleHistory, viewed in place.
+ *
+ * The run may wrap around the end of the ring, so every channel is exposed as up to two
+ * contiguous segments. The samples are not copied: they stay valid until the writer laps the
+ * ring, which IsValid reports, so consumers should process a span right after retrieving it.
+ */
+struct WINDOWSDUALSENSE_DS5W_API FInputSampleSpan
+{
+	/**
+	 * The history the samples live in, null for an empty span.
+	 */
+	const FInputSampleHistory* History = nullptr;
+	/**
+	 * Monotonic index of the first sample.
+	 */
+	uint64 First = 0;
+	/**
+	 * Number of samples in the span.
+	 */
+	int32 Num = 0;
+
+	/**
+	 * @return 0 for an empty span, 2 if the span wraps around the end of the ring, 1 otherwise.
+	 */
+	int32 NumSegments() const;
+	/**
+	 * @param Channel The channel to view.
+	 * @param Segment Index of the segment, below NumSegments().
+	 * @return The values of the channel in the segment.
+	 */
+	TArrayView<const float> GetChannel(ESonyGamepadChannel Channel, int32 Segment) const;
+	/**
+	 * @param Segment Index of the segment, below NumSegments().
+	 * @return The arrival times of the samples in the segment, in seconds (FPlatformTime::Seconds()).
+	 */
+	TArrayView<const double> GetTimestamps(int32 Segment) const;
+	/**
+	 * @return False if the writer overwrote part of the span since it was retrieved.
+	 */
+	bool IsValid() const;
+
+private:
+	int32 GetSegmentOffset(int32 Segment) const;
+	int32 GetSegmentLength(int32 Segment) const;
+};
+
+/**
+ * @brief Structure-of-arrays ring of every analog sample decoded from a device.
+ *
+ * The input reader thread records each report, so the history holds the full rate of the device
+ * (around 250 Hz over USB) even though the engine only sees one value per frame through the input
+ * events. Each channel is a contiguous float array, which suits filters and SIMD loops that work
+ * on one channel at a time.
+ *
+ * A single thread writes. Any number of consumers read without locks, each one keeping its own
+ * cursor, and can ask for every sample since their previous read.
+ */
+class WINDOWSDUALSENSE_DS5W_API FInputSampleHistory
+{
+public:
+	/**
+	 * Records the analog channels of a decoded state. Must only be called from one thread at a time.
+	 *
+	 * @param State The state to record.
+	 */
+	void Push(const FSonyGamepadInputState& State);
+	/**
+	 * Retrieves the samples recorded since the previous call with the same cursor. When the consumer
+	 * fell more than a ring behind, the span starts at the oldest sample still available.
+	 *
+	 * @param Cursor The cursor of the consumer, zero on the first call. Advanced past the returned samples.
+	 * @return The new samples, viewed in place.
+	 */
+	FInputSampleSpan ReadSince(uint64& Cursor) const;
+	/**
+	 * @return Monotonic index of the next sample to be written, i.e. the number of samples recorded.
+	 */
+	uint64 GetWriteIndex() const
+	{
+		return WriteIndex.load(std::memory_order_acquire);
+	}
+
+private:
+	friend struct FInputSampleSpan;
+
+	alignas(64) double Timestamps[SONY_GAMEPAD_HISTORY_SIZE];
+	alignas(64) float Channels[static_cast<uint8>(ESonyGamepadChannel::Count)][SONY_GAMEPAD_HISTORY_SIZE];
+	std::atomic<uint64> WriteIndex{0};
+};
+
+/**
+ * @brief Resamples the history of a device to a fixed rate, for consumers that need evenly spaced samples.
+ *
+ * The resampler keeps its own cursor and the last sample it saw, so successive calls continue the same
+ * time grid without gaps or duplicates. The output arrays are owned by the resampler and reused, so
+ * steady-state calls do not allocate. Values are linearly interpolated between the recorded samples.
+ */
+class WINDOWSDUALSENSE_DS5W_API FInputSampleResampler
+{
+public:
+	/**
+	 * Resamples every sample recorded since the previous call.
+	 *
+	 * @param History The history to read.
+	 * @param RateHz The output rate, in Hz.
+	 * @return Number of output samples produced, available through GetChannel and GetTimestamps until the next call.
+	 */
+	int32 Resample(const FInputSampleHistory& History, float RateHz);
+	/**
+	 * @param Channel The channel to view.
+	 * @return The resampled values produced by the last call to Resample.
+	 */
+	TArrayView<const float> GetChannel(const ESonyGamepadChannel Channel) const
+	{
+		return Channels[static_cast<uint8>(Channel)];
+	}
+	/**
+	 * @return The grid times of the samples produced by the last call to Resample, in seconds.
+	 */
+	TArrayView<const double> GetTimestamps() const
+	{
+		return Timestamps;
+	}
+
+private:
+	TArray<double> Timestamps;
+	TArray<float> Channels[static_cast<uint8>(ESonyGamepadChannel::Count)];
+	float Previous[static_cast<uint8>(ESonyGamepadChannel::Count)] = {};
+	double PreviousTime = 0.0;
+	double NextTime = 0.0;
+	uint64 Cursor = 0;
+	bool bHasPrevious = false;
+};
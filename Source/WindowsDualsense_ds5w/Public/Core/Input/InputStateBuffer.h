@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Core/Structs/FSonyGamepadInputState.h"
+
+/**
+ * @brief Triple buffer publishing the latest FSonyGamepadInputState of a device to any thread.
+ *
+ * A single writer publishes into the slot following the latest one, so the slot readers are most
+ * likely copying is never the one being written. Each slot carries a sequence lock: a reader that
+ * raced with the writer sees the version change and retries, so any number of threads (game,
+ * render, audio, task workers) read a consistent state without taking a lock.
+ */
+class WINDOWSDUALSENSE_DS5W_API FInputStateBuffer
+{
+public:
+	/**
+	 * Publishes a new state. Must only be called from one thread at a time.
+	 *
+	 * @param State The state to publish.
+	 */
+	void Publish(const FSonyGamepadInputState& State);
+	/**
+	 * Copies the most recently published state.
+	 *
+	 * @param OutState Receives the state.
+	 * @return False if nothing was published since the last reset.
+	 */
+	bool Read(FSonyGamepadInputState& OutState) const;
+	/**
+	 * Marks the buffer as empty, e.g. when the device disconnects.
+	 */
+	void Reset()
+	{
+		bHasState.store(false, std::memory_order_release);
+	}
+
+private:
+	/**
+	 * A slot of the triple buffer. Version is odd while the writer copies the state.
+	 */
+	struct FSlot
+	{
+		std::atomic<uint32> Version{0};
+		FSonyGamepadInputState State;
+	};
+
+	FSlot Slots[3];
+	std::atomic<uint32> Latest{0};
+	std::atomic<bool> bHasState{false};
+};
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+#include "Core/Structs/FSonyGamepadInputState.h"
+
+/**
+ * @brief Fuses the gyroscope and the accelerometer into a stable orientation (Mahony complementary filter).
+ *
+ * The gyroscope is integrated every sample, and the drift it accumulates is pulled back towards
+ * the gravity direction measured by the accelerometer through a proportional and an integral term.
+ * The integral term converges on the gyroscope bias, so the orientation stays stable at rest.
+ *
+ * The filter works in single precision on SIMD registers, and is cheap enough to run on the input
+ * reader thread for every report. An instance keeps the history of one device and must only be
+ * used by one thread.
+ */
+class WINDOWSDUALSENSE_DS5W_API FMotionFusion
+{
+public:
+	FMotionFusion();
+
+	/**
+	 * Integrates one IMU sample and writes the fused outputs into State: Orientation and AngularVelocity.
+	 *
+	 * @param State The freshly decoded state, whose Gyroscope and Accelerometer hold the sample.
+	 * @param DeltaTime Time elapsed since the previous sample, in seconds.
+	 */
+	void Update(FSonyGamepadInputState& State, float DeltaTime);
+	/**
+	 * Forgets the orientation, e.g. when the device reconnects. The next sample re-aligns it on gravity.
+	 */
+	void Reset();
+
+	/**
+	 * Sets the gains of the filter.
+	 *
+	 * @param InProportionalGain How fast the orientation converges towards the measured gravity.
+	 * Higher values correct drift faster but let hand shake leak into the orientation.
+	 * @param InIntegralGain How fast the gyroscope bias is learned. Zero disables the bias estimation.
+	 */
+	void SetGains(const float InProportionalGain, const float InIntegralGain)
+	{
+		ProportionalGain = InProportionalGain;
+		IntegralGain = InIntegralGain;
+	}
+
+private:
+	/**
+	 * Orientation from the device frame to the world frame, as (X, Y, Z, W).
+	 */
+	VectorRegister4Float Orientation;
+	/**
+	 * Accumulated error term, the estimate of the gyroscope bias in rad/s.
+	 */
+	VectorRegister4Float IntegralError;
+	float ProportionalGain;
+	float IntegralGain;
+	bool bAligned;
+};
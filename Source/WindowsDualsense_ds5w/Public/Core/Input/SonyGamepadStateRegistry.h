@@ -0,0 +1,97 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Input/AnalogConditioner.h"
+#include "Core/Input/ButtonRemapper.h"
+#include "Core/Input/GyroLookProcessor.h"
+#include "Core/Input/InputPredictor.h"
+#include "Core/Input/InputSampleHistory.h"
+#include "Core/Input/InputStateBuffer.h"
+#include "Core/Input/TouchTracker.h"
+
+/**
+ * Number of controllers whose input state can be published, indexed by controller id.
+ */
+#define SONY_GAMEPAD_MAX_STATE_SLOTS 16
+
+/**
+ * @brief Per-controller registry of the latest input states, of their sample history and of the
+ * processors fed by the input reader thread.
+ *
+ * The buffers are statically allocated and never move, so they can be read from any thread,
+ * including while controllers connect and disconnect on the game thread.
+ */
+class WINDOWSDUALSENSE_DS5W_API FSonyGamepadStateRegistry
+{
+public:
+	/**
+	 * Retrieves the state buffer of a controller.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @return The buffer, or nullptr if the ID is out of range.
+	 */
+	static FInputStateBuffer* GetBuffer(int32 ControllerId);
+	/**
+	 * Copies the latest input state of a controller.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param OutState Receives the state.
+	 * @return False if the controller is out of range or did not publish any state.
+	 */
+	static bool GetLatestState(int32 ControllerId, FSonyGamepadInputState& OutState);
+	/**
+	 * Retrieves the history of every sample decoded from a controller.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @return The history, or nullptr if the ID is out of range.
+	 */
+	static FInputSampleHistory* GetHistory(int32 ControllerId);
+	/**
+	 * Retrieves the gyro look processor of a controller.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @return The processor, or nullptr if the ID is out of range.
+	 */
+	static FGyroLookProcessor* GetLookProcessor(int32 ControllerId);
+	/**
+	 * Retrieves the touchpad tracker of a controller.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @return The tracker, or nullptr if the ID is out of range.
+	 */
+	static FTouchTracker* GetTouchTracker(int32 ControllerId);
+	/**
+	 * Retrieves the analog conditioner of a controller.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @return The conditioner, or nullptr if the ID is out of range.
+	 */
+	static FAnalogConditioner* GetAnalogConditioner(int32 ControllerId);
+	/**
+	 * Retrieves the button remapper of a controller.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @return The remapper, or nullptr if the ID is out of range.
+	 */
+	static FButtonRemapper* GetButtonRemapper(int32 ControllerId);
+	/**
+	 * Retrieves the input predictor of a controller.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @return The predictor, or nullptr if the ID is out of range.
+	 */
+	static FInputPredictor* GetPredictor(int32 ControllerId);
+
+private:
+	static FInputStateBuffer Buffers[SONY_GAMEPAD_MAX_STATE_SLOTS];
+	static FInputSampleHistory Histories[SONY_GAMEPAD_MAX_STATE_SLOTS];
+	static FGyroLookProcessor LookProcessors[SONY_GAMEPAD_MAX_STATE_SLOTS];
+	static FTouchTracker TouchTrackers[SONY_GAMEPAD_MAX_STATE_SLOTS];
+	static FAnalogConditioner AnalogConditioners[SONY_GAMEPAD_MAX_STATE_SLOTS];
+	static FButtonRemapper ButtonRemappers[SONY_GAMEPAD_MAX_STATE_SLOTS];
+	static FInputPredictor Predictors[SONY_GAMEPAD_MAX_STATE_SLOTS];
+};
@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/EDeviceConnection.h"
+#include "Core/Input/MotionFusion.h"
+#include "Core/Input/TouchTracker.h"
+#include "Core/Structs/FImuCalibration.h"
+#include "Core/Structs/FSonyGamepadInputState.h"
+#include "GenericPlatform/GenericApplicationMessageHandler.h"
+
+/**
+ * @brief Decodes raw input reports into FSonyGamepadInputState and dispatches the differences
+ * between two states to the engine.
+ *
+ * The decoders are pure functions of the report bytes, so the same code runs on the input reader
+ * thread, to publish the state as soon as a report arrives, and on the game thread, to dispatch events.
+ */
+class WINDOWSDUALSENSE_DS5W_API FSonyInputDecoder
+{
+public:
+	/**
+	 * Signature shared by the decoders, so the input reader can decode without knowing the device model.
+	 */
+	using FDecodeFunction = void (*)(const unsigned char* Report, EDeviceConnection Connection, const FImuCalibration& Calibration, FSonyGamepadInputState& OutState);
+
+	/**
+	 * Decodes a DualSense or DualSense Edge input report.
+	 *
+	 * @param Report The raw report, including the report id.
+	 * @param Connection The connection the report was received on, which defines the header length.
+	 * @param Calibration The IMU calibration of the device, applied to the gyroscope and accelerometer.
+	 * @param OutState Receives the decoded state. Timestamp and Sequence are left untouched.
+	 */
+	static void DecodeDualSense(const unsigned char* Report, EDeviceConnection Connection, const FImuCalibration& Calibration, FSonyGamepadInputState& OutState);
+	/**
+	 * Decodes a DualShock 4 input report.
+	 *
+	 * @param Report The raw report, including the report id.
+	 * @param Connection The connection the report was received on, which defines the header length.
+	 * @param Calibration The IMU calibration of the device, applied to the gyroscope and accelerometer.
+	 * @param OutState Receives the decoded state. Timestamp and Sequence are left untouched.
+	 */
+	static void DecodeDualShock(const unsigned char* Report, EDeviceConnection Connection, const FImuCalibration& Calibration, FSonyGamepadInputState& OutState);
+	/**
+	 * Runs the motion stages over the time elapsed since the previous report: feeds the sample to the
+	 * sensor fusion, which writes the orientation and angular velocity.
+	 *
+	 * @param State The freshly decoded state, with its Timestamp set.
+	 * @param PreviousTimestamp Timestamp of the previous state, zero if there is none.
+	 * @param Fusion The sensor fusion of the device.
+	 */
+	static void UpdateMotion(FSonyGamepadInputState& State, double PreviousTimestamp, FMotionFusion& Fusion);
+	/**
+	 * Sends the analog values, axis keys and buttons that changed since Previous to the message handler.
+	 *
+	 * @param InMessageHandler The message handler responsible for dispatching input events.
+	 * @param UserId The platform user ID associated with the controller.
+	 * @param InputDeviceId The identifier of the input device.
+	 * @param DeviceType The model of the device, which defines the height of its touchpad.
+	 * @param Previous The state dispatched last time.
+	 * @param Current The state to dispatch.
+	 * @param bTouch Whether touch events and the touch axis keys are dispatched.
+	 * @param bMotion Whether motion events and the motion axis keys are dispatched. Tilt carries the fused
+	 * orientation as Euler angles in degrees, the other vectors the fused outputs of Current. The gyro and
+	 * tilt axis keys share one sign convention: pitch up, yaw right and roll.
+	 */
+	static void DispatchEvents(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
+	                           FPlatformUserId UserId, FInputDeviceId InputDeviceId, EDeviceType DeviceType,
+	                           const FSonyGamepadInputState& Previous, const FSonyGamepadInputState& Current,
+	                           bool bTouch, bool bMotion);
+	/**
+	 * Sends the touchpad gestures recognized since the previous call as key presses.
+	 *
+	 * @param InMessageHandler The message handler responsible for dispatching input events.
+	 * @param UserId The platform user ID associated with the controller.
+	 * @param InputDeviceId The identifier of the input device.
+	 * @param Tracker The touchpad tracker of the device. Its pending gestures are consumed.
+	 * @param bTouch Whether touch events are dispatched. Gestures are discarded otherwise.
+	 */
+	static void DispatchGestures(const TSharedRef<FGenericApplicationMessageHandler>& InMessageHandler,
+	                             FPlatformUserId UserId, FInputDeviceId InputDeviceId,
+	                             FTouchTracker& Tracker, bool bTouch);
+
+private:
+	static uint32 DecodeButtons(uint8 FaceAndHat, uint8 Shoulders, uint8 Special);
+	static uint32 DecodeDualSenseButtons(uint8 Special);
+	static uint32 DecodeStickDirections(const FVector2f& LeftStick, const FVector2f& RightStick);
+	static void DecodeTouch(const unsigned char* Data, FSonyGamepadTouch& OutTouch);
+	static void DecodeImu(const unsigned char* Data, const FImuCalibration& Calibration, FSonyGamepadInputState& OutState);
+	static float DecodeAxis(unsigned char Value, bool bInvert);
+};
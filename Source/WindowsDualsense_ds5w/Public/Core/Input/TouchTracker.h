@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Core/Structs/FSonyGamepadInputState.h"
+
+/**
+ * @brief Tracks the fingers on the touchpad across reports and recognizes gestures.
+ *
+ * Runs on the input reader thread, so every report is seen even when the game only consumes the
+ * latest one per frame. The tracker smooths the velocity of each contact, and recognizes taps,
+ * two-finger taps, swipes and pinches. Recognized gestures are queued as the names of the gesture
+ * keys registered by the module (FSonyGamepadKeyNames), and the game thread sends them to the engine
+ * as key presses. The velocities are kept out of the input state and read with GetContactVelocity.
+ */
+class WINDOWSDUALSENSE_DS5W_API FTouchTracker
+{
+public:
+	/**
+	 * Updates the contacts and their velocity from a decoded state. Must only be called from one thread at a time.
+	 *
+	 * @param State The freshly decoded state, with its Timestamp set.
+	 */
+	void Process(const FSonyGamepadInputState& State);
+	/**
+	 * Retrieves the oldest gesture recognized and not yet consumed. Must only be called from one thread at a time.
+	 *
+	 * @param OutKey Receives the name of the gesture key.
+	 * @return False if no gesture is pending.
+	 */
+	bool PopGesture(FName& OutKey)
+	{
+		return Gestures.Dequeue(OutKey);
+	}
+	/**
+	 * Retrieves the smoothed velocity of a contact. Lock-free, safe to call from any thread.
+	 *
+	 * @param Contact 0 for the first finger (Touch1), 1 for the second one (Touch2).
+	 * @return The velocity in touchpad units per second, zero while the finger is up.
+	 */
+	FVector2D GetContactVelocity(int32 Contact) const;
+	/**
+	 * Forgets the contacts and the pending gestures, e.g. when the device disconnects. Must not race with Process.
+	 */
+	void Reset();
+
+private:
+	/**
+	 * A finger, from the report it touched the pad to the one it left it.
+	 */
+	struct FContact
+	{
+		FVector2D StartPosition = FVector2D::ZeroVector;
+		FVector2D LastPosition = FVector2D::ZeroVector;
+		FVector2D Velocity = FVector2D::ZeroVector;
+		double LastTime = 0.0;
+		int32 Id = 0;
+		float Travel = 0.0f;
+		bool bDown = false;
+		bool bInGesture = false;
+	};
+
+	void UpdateContact(FContact& Contact, const FSonyGamepadTouch& Touch, double Timestamp);
+	void RecognizeEnd(double Timestamp);
+
+	FContact Contacts[2];
+	/**
+	 * The velocity of each contact, as two floats packed in one word, for the readers on other threads.
+	 */
+	std::atomic<uint64> PackedVelocities[2] = {};
+	TQueue<FName, EQueueMode::Spsc> Gestures;
+
+	/**
+	 * The current gesture: every report from the first finger landing to the last one leaving.
+	 */
+	double GestureStartTime = 0.0;
+	float PinchStartDistance = 0.0f;
+	int32 MaxFingers = 0;
+	bool bGestureActive = false;
+	bool bPinchRecognized = false;
+};
@@ -7,8 +7,10 @@
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
 #include "Core/Enums/EDeviceCommons.h"
+#include "Core/Enums/EPollingPolicy.h"
 #include "Core/Structs/FDeviceContext.h"
 #include "Core/Structs/FDeviceSettings.h"
+#include "Core/Structs/FInputLatencyStats.h"
 #include "InputCoreTypes.h"
 #include "Misc/CoreDelegates.h"
 #include "Runtime/ApplicationCore/Public/GenericPlatform/IInputInterface.h"
@@ -183,6 +185,30 @@ public:
 	 * This function must be implemented by any class inheriting this interface.
 	 */
 	virtual void SendOut() = 0;
+	/**
+	 * Retrieves the rate at which the device produces input reports.
+	 *
+	 * @return The measured report rate in Hz, around 250 Hz over USB and variable over Bluetooth.
+	 */
+	virtual float GetReportRate() const = 0;
+	/**
+	 * Sets how the pending input reports are consumed on the next UpdateInput call.
+	 *
+	 * @param Policy With NativeRate every pending report is delivered, with FixedRate the pending reports
+	 *               spaced FixedRateHz apart, otherwise only the latest one.
+	 * @param FixedRateHz Sampling rate used by EPollingPolicy::FixedRate.
+	 */
+	virtual void SetPollingPolicy(EPollingPolicy Policy, float FixedRateHz) = 0;
+	/**
+	 * Retrieves the latency between the arrival of input reports and their dispatch to the engine.
+	 *
+	 * @return The latency statistics accumulated since the last reset.
+	 */
+	virtual FInputLatencyStats GetInputLatency() const = 0;
+	/**
+	 * Clears the input latency statistics.
+	 */
+	virtual void ResetInputLatency() = 0;
 	/**
 	 * Updates input state for the gamepad.
 	 *
@@ -7,6 +7,8 @@
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
 #include "Templates/SharedPointer.h"
+#include "Core/Structs/FOutputContext.h"
+#include "Core/Structs/FSonyGamepadTriggerLayer.h"
 #include "SonyGamepadTriggerInterface.generated.h"
 
 // This class does not need to be modified.
@@ -47,8 +49,9 @@ public:
 	 * @param MiddleStrength The resistance strength applied during the middle point of the trigger pull.
 	 * @param EndStrength The resistance strength applied at the end point of the trigger pull.
 	 * @param Hand The controller hand (e.g., left or right) to which the resistance settings will be applied.
+	 * @param Layer The layer of the trigger effect stack the effect is written to, with its priority, lifetime and fade out.
 	 */
-	virtual void SetResistance(int32 BeginStrength, int32 MiddleStrength, int32 EndStrength, const EControllerHand& Hand) = 0;
+	virtual void SetResistance(int32 BeginStrength, int32 MiddleStrength, int32 EndStrength, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer) = 0;
 	/**
 	 * Sets the automatic gun trigger effects on a controller by defining resistance levels
 	 * across multiple stages and optionally retaining the effect across actions.
@@ -58,8 +61,9 @@ public:
 	 * @param EndStrength The resistance strength at the end stage of the trigger pull.
 	 * @param Hand The controller hand (e.g., left or right) where the effect will be applied.
 	 * @param KeepEffect Indicates whether the applied effect should persist after the action.
+	 * @param Layer The layer of the trigger effect stack the effect is written to, with its priority, lifetime and fade out.
 	 */
-	virtual void SetAutomaticGun(int32 BeginStrength, int32 MiddleStrength, int32 EndStrength, const EControllerHand& Hand, bool KeepEffect) = 0;
+	virtual void SetAutomaticGun(int32 BeginStrength, int32 MiddleStrength, int32 EndStrength, const EControllerHand& Hand, bool KeepEffect, const FSonyGamepadTriggerLayer& Layer) = 0;
 	/**
 	 * Configures continuous resistance for a gamepad trigger at a specific position
 	 * with a defined level of strength for a given controller hand.
@@ -67,8 +71,9 @@ public:
 	 * @param StartPosition The starting position on the trigger where the resistance begins to take effect.
 	 * @param Strength The level of resistance to be applied, typically within a valid range for the device.
 	 * @param Hand The controller hand (e.g., left or right) where the resistance effect will be applied.
+	 * @param Layer The layer of the trigger effect stack the effect is written to, with its priority, lifetime and fade out.
 	 */
-	virtual void SetContinuousResistance(int32 StartPosition, int32 Strength, const EControllerHand& Hand) = 0;
+	virtual void SetContinuousResistance(int32 StartPosition, int32 Strength, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer) = 0;
 	/**
 	 * Configures the galloping effect on a gamepad by specifying the start and end positions,
 	 * foot timings, frequency, and the hand to which the effect is applied.
@@ -79,8 +84,9 @@ public:
 	 * @param SecondFoot The timing or position representing the impact of the second foot.
 	 * @param Frequency The frequency of the galloping effect to determine its speed.
 	 * @param Hand The controller hand (e.g., left or right) where the effect will be applied.
+	 * @param Layer The layer of the trigger effect stack the effect is written to, with its priority, lifetime and fade out.
 	 */
-	virtual void SetGalloping(int32 StartPosition, int32 EndPosition, int32 FirstFoot, int32 SecondFoot, float Frequency, const EControllerHand& Hand) = 0;
+	virtual void SetGalloping(int32 StartPosition, int32 EndPosition, int32 FirstFoot, int32 SecondFoot, float Frequency, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer) = 0;
 	/**
 	 * Configures a custom machine effect on the gamepad triggers by defining start and end positions,
 	 * amplitude levels, frequency, and duration specifics for a given controller hand.
@@ -92,8 +98,9 @@ public:
 	 * @param Frequency The frequency of the effect to control its repetition rate.
 	 * @param Period The duration of one cycle of the effect.
 	 * @param Hand The controller hand (e.g., left or right) where the effect will be applied.
+	 * @param Layer The layer of the trigger effect stack the effect is written to, with its priority, lifetime and fade out.
 	 */
-	virtual void SetMachine(int32 StartPosition, int32 EndPosition, int32 AmplitudeBegin, int32 AmplitudeEnd, float Frequency, float Period, const EControllerHand& Hand) = 0;
+	virtual void SetMachine(int32 StartPosition, int32 EndPosition, int32 AmplitudeBegin, int32 AmplitudeEnd, float Frequency, float Period, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer) = 0;
 	/**
 	 * Configures the weapon effect on a gamepad's adaptive triggers based on specified parameters.
 	 *
@@ -101,8 +108,9 @@ public:
 	 * @param EndPosition The ending position for the trigger effect as an integer value.
 	 * @param Strength The intensity of the trigger effect as an integer value.
 	 * @param Hand A reference to the hand (left or right) where the effect should be applied, represented by EControllerHand.
+	 * @param Layer The layer of the trigger effect stack the effect is written to, with its priority, lifetime and fade out.
 	 */
-	virtual void SetWeapon(int32 StartPosition, int32 EndPosition, int32 Strength, const EControllerHand& Hand) = 0;
+	virtual void SetWeapon(int32 StartPosition, int32 EndPosition, int32 Strength, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer) = 0;
 	/**
 	 * Configures the bow tension effects on a gamepad trigger for a specified hand.
 	 *
@@ -111,14 +119,32 @@ public:
 	 * @param BegingStrength The intensity of the bow tension effect at the starting position.
 	 * @param EndStrength The intensity of the bow tension effect at the ending position.
 	 * @param Hand The controller hand to which the bow effect will be applied.
+	 * @param Layer The layer of the trigger effect stack the effect is written to, with its priority, lifetime and fade out.
 	 */
-	virtual void SetBow(int32 StartPosition, int32 EndPosition, int32 BegingStrength, int32 EndStrength, const EControllerHand& Hand) = 0;
+	virtual void SetBow(int32 StartPosition, int32 EndPosition, int32 BegingStrength, int32 EndStrength, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer) = 0;
 	/**
-	 * Disables the trigger effects on a gamepad for the specified controller hand.
+	 * Disables the trigger effects on a gamepad for the specified controller hand, on the default layer
+	 * of the trigger effect stack. ClearTriggerLayer clears the other layers.
 	 *
 	 * @param Hand An enum indicating which controller hand's trigger effects should be stopped.
 	 */
 	virtual void StopTrigger(const EControllerHand& Hand) = 0;
+	/**
+	 * Sets a trigger effect that is already encoded, e.g. a compiled trigger preset.
+	 *
+	 * @param Effect The effect.
+	 * @param Hand The controller hand to which the effect will be applied.
+	 * @param Layer The layer of the trigger effect stack the effect is written to, with its priority, lifetime and fade out.
+	 */
+	virtual void SetTriggerEffect(const FHapticTriggers& Effect, const EControllerHand& Hand, const FSonyGamepadTriggerLayer& Layer) = 0;
+	/**
+	 * Clears one layer of the trigger effect stack, revealing the effects of the layers below it.
+	 *
+	 * @param Layer The layer to clear.
+	 * @param Hand The controller hand whose trigger is cleared, or AnyHand for both.
+	 * @param FadeOut Time over which the effect of the layer fades out, in seconds.
+	 */
+	virtual void ClearTriggerLayer(ESonyGamepadTriggerLayer Layer, const EControllerHand& Hand, float FadeOut) = 0;
 
 	/**
 	 * Configures the gamepad vibration based on audio feedback parameters.
@@ -0,0 +1,175 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Structs/FOutputContext.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * "SGHC", the first four bytes of a haptic clip file.
+ */
+#define SONY_GAMEPAD_HAPTIC_CLIP_MAGIC 0x43484753
+/**
+ * Version of the haptic clip format written by FHapticClip::Encode. Readers reject newer versions.
+ */
+#define SONY_GAMEPAD_HAPTIC_CLIP_VERSION 1
+/**
+ * Number of frames between two key frames, which are the entries of the seek table.
+ */
+#define SONY_GAMEPAD_HAPTIC_CLIP_KEY_INTERVAL 64
+
+/**
+ * @brief The parts of the output state a haptic clip drives.
+ */
+enum class EHapticClipChannel : uint8
+{
+	None = 0,
+	Rumble = 1 << 0,
+	Lightbar = 1 << 1,
+	LeftTrigger = 1 << 2,
+	RightTrigger = 1 << 3,
+	All = Rumble | Lightbar | LeftTrigger | RightTrigger,
+};
+ENUM_CLASS_FLAGS(EHapticClipChannel);
+
+/**
+ * @brief The state of every channel of a clip at one keyframe.
+ *
+ * The rumble and the lightbar are interpolated between frames, the trigger effects hold until the next frame.
+ */
+struct FHapticClipFrame
+{
+	uint32 TimeMs = 0;
+	FRumbles Rumbles;
+	FLightbar Lightbar;
+	FHapticTriggers LeftTrigger;
+	FHapticTriggers RightTrigger;
+};
+
+/**
+ * @brief A compiled haptic clip, read in place from a memory-mapped file.
+ *
+ * The file starts with a 32-byte header (magic, version, channels, duration, frame count and the
+ * offsets of the frames and of the seek table), followed by the frames and the seek table. Each frame
+ * starts with a mask of the channels it changes and the time since the previous frame as a varint;
+ * the rumble and lightbar are stored as zigzag varint differences with the previous frame and the
+ * trigger effects as their fields. Every SONY_GAMEPAD_HAPTIC_CLIP_KEY_INTERVAL frames, a key frame
+ * stores its absolute time and every channel, and the seek table lists the time and offset of each
+ * key frame, so playback can start anywhere after decoding a single block.
+ *
+ * A clip is immutable once opened and is shared by every playback; only the pages being played are
+ * read from disk.
+ */
+class WINDOWSDUALSENSE_DS5W_API FHapticClip
+{
+public:
+	~FHapticClip();
+
+	/**
+	 * Maps a clip file into memory and validates its header and seek table.
+	 *
+	 * @param Filename The full path of the file.
+	 * @return The clip, or null if the file is missing or is not a valid clip.
+	 */
+	static TSharedPtr<const FHapticClip> Open(const FString& Filename);
+	/**
+	 * Wraps an encoded clip held in memory, e.g. to preview a clip in the editor before it is written.
+	 *
+	 * @param Data The encoded clip.
+	 * @return The clip, or null if the data is not a valid clip.
+	 */
+	static TSharedPtr<const FHapticClip> FromMemory(TArray<uint8>&& Data);
+	/**
+	 * Encodes frames into the clip format.
+	 *
+	 * @param Frames The frames, sorted by time.
+	 * @param Channels The channels the clip drives. Other channels of the frames are not stored.
+	 * @param DurationMs The length of the clip, at least the time of the last frame.
+	 * @param OutData Receives the encoded clip.
+	 */
+	static void Encode(const TArray<FHapticClipFrame>& Frames, EHapticClipChannel Channels, uint32 DurationMs, TArray<uint8>& OutData);
+
+	EHapticClipChannel GetChannels() const
+	{
+		return Channels;
+	}
+
+	uint32 GetDurationMs() const
+	{
+		return DurationMs;
+	}
+
+	uint32 GetFrameCount() const
+	{
+		return FrameCount;
+	}
+
+private:
+	friend class FHapticClipReader;
+
+	FHapticClip() = default;
+	bool Initialize(const uint8* InData, int64 InSize);
+	/**
+	 * @return The offset of the last key frame at or before a time, relative to the start of the data.
+	 */
+	uint32 FindKeyFrame(uint32 TimeMs) const;
+
+	IMappedFileHandle* MappedFile = nullptr;
+	IMappedFileRegion* MappedRegion = nullptr;
+	TArray<uint8> Memory;
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	EHapticClipChannel Channels = EHapticClipChannel::None;
+	uint32 DurationMs = 0;
+	uint32 FrameCount = 0;
+	uint32 FramesOffset = 0;
+	uint32 FramesEnd = 0;
+	uint32 SeekCount = 0;
+	uint32 SeekTableOffset = 0;
+};
+
+/**
+ * @brief Decodes a clip while it plays. Each playback owns one reader; the clip can be shared.
+ *
+ * Reading forward decodes one frame at a time; reading backwards, e.g. when a looping clip restarts,
+ * seeks to the nearest key frame first.
+ */
+class WINDOWSDUALSENSE_DS5W_API FHapticClipReader
+{
+public:
+	explicit FHapticClipReader(const TSharedRef<const FHapticClip>& InClip);
+
+	/**
+	 * Samples the clip.
+	 *
+	 * @param TimeMs Time since the start of the clip, in milliseconds.
+	 * @param OutFrame Receives the interpolated state.
+	 * @return False if the clip is corrupt, in which case the playback should stop.
+	 */
+	bool Sample(double TimeMs, FHapticClipFrame& OutFrame);
+
+	const FHapticClip& GetClip() const
+	{
+		return *Clip;
+	}
+
+private:
+	bool Seek(uint32 TimeMs);
+	/**
+	 * Decodes the frame at the current offset over the previous one.
+	 */
+	bool ReadFrame(FHapticClipFrame& InOutFrame);
+
+	TSharedRef<const FHapticClip> Clip;
+	uint32 Offset = 0;
+	FHapticClipFrame Previous;
+	FHapticClipFrame Next;
+	bool bHasNext = false;
+	bool bPositioned = false;
+};
@@ -0,0 +1,132 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Core/Output/HapticClip.h"
+#include "Core/Structs/FOutputContext.h"
+
+/**
+ * @brief A haptic clip to play on a controller.
+ */
+struct FHapticClipPlayback
+{
+	TSharedPtr<const FHapticClip> Clip;
+	/**
+	 * Time the playback starts, in seconds (FPlatformTime::Seconds()).
+	 */
+	double StartTime = 0.0;
+	/**
+	 * Position in the clip the playback starts from, in seconds.
+	 */
+	double StartPosition = 0.0;
+	/**
+	 * Time over which the clip fades in while the clip playing before it fades out, in seconds.
+	 */
+	float CrossFade = 0.0f;
+	/**
+	 * Restarts the clip when it ends, until it is stopped.
+	 */
+	bool bLoop = false;
+};
+
+/**
+ * @brief Streams the haptic clips of one controller into its output state on the output thread.
+ *
+ * One clip plays at a time; starting another cross-fades from the current one. The rumble and the
+ * lightbar are blended, the trigger effects switch at the middle of the fade. Channels the clip does
+ * not drive keep the values set by the commands. The rumble of the clips is returned apart, as the
+ * cinematic source of the rumble mixer.
+ *
+ * Play, Stop and Seek are lock-free and safe to call from any thread; Evaluate and Reset belong to the
+ * output thread.
+ */
+class WINDOWSDUALSENSE_DS5W_API FHapticClipPlayer
+{
+public:
+	/**
+	 * Queues a clip, which replaces the current one.
+	 *
+	 * @param Playback The clip and how to play it.
+	 */
+	void Play(const FHapticClipPlayback& Playback);
+	/**
+	 * Stops the current clip.
+	 *
+	 * @param FadeOut Time over which the clip fades out, in seconds.
+	 */
+	void Stop(float FadeOut);
+	/**
+	 * Moves the current clip to a position.
+	 *
+	 * @param Position The position, in seconds from the start of the clip.
+	 */
+	void Seek(double Position);
+	/**
+	 * Applies the queued requests and mixes the clips into an output state.
+	 *
+	 * @param Now The time to evaluate, in seconds.
+	 * @param InOutOutput The output state, which holds the commanded values on input.
+	 * @param OutRumbles Receives the rumble of the clips.
+	 * @param OutNextTime Receives the time of the next sample.
+	 * @return True while a clip is playing, fading out or waiting for its start time.
+	 */
+	bool Evaluate(double Now, FOutputContext& InOutOutput, FRumbles& OutRumbles, double& OutNextTime);
+	/**
+	 * Drops every clip and queued request, e.g. when the controller reconnects. Must not race with Evaluate.
+	 */
+	void Reset();
+
+private:
+	enum class ERequest : uint8
+	{
+		Play,
+		Stop,
+		Seek,
+	};
+
+	struct FRequest
+	{
+		ERequest Type = ERequest::Play;
+		FHapticClipPlayback Playback;
+		double Time = 0.0;
+		double Value = 0.0;
+	};
+
+	struct FVoice
+	{
+		FHapticClipPlayback Playback;
+		TUniquePtr<FHapticClipReader> Reader;
+		/**
+		 * Time the fade out started and its length, while the voice fades out.
+		 */
+		double FadeOutStart = -1.0;
+		double FadeOutTime = 0.0;
+
+		bool IsActive() const
+		{
+			return Reader.IsValid();
+		}
+	};
+
+	/**
+	 * @return The weight of a voice at a time, between 0 and 1.
+	 */
+	static float GetWeight(const FVoice& Voice, double Now);
+	/**
+	 * Samples a voice at a time.
+	 *
+	 * @return False once the voice is over, or if its clip is corrupt.
+	 */
+	static bool SampleVoice(FVoice& Voice, double Now, FHapticClipFrame& OutFrame);
+
+	TQueue<FRequest, EQueueMode::Mpsc> Requests;
+	FVoice Current;
+	/**
+	 * The clip fading out under the current one.
+	 */
+	FVoice Fading;
+};
@@ -0,0 +1,135 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Core/Structs/FOutputContext.h"
+#include "Core/Structs/FSonyGamepadLightAnimation.h"
+
+/**
+ * @brief Animates the lightbar and the player LEDs of one controller on the output thread.
+ *
+ * Gameplay queues an animation once instead of setting a color every frame. The output thread computes
+ * the color from the start time of the animation, on a grid of UpdateRate steps per second, or at the
+ * exact switching times of pulses and player LED patterns, and sleeps while the colors hold. An
+ * animation overrides the values set by the commands, which come back when it ends. Evaluate tells
+ * whether the 8-bit values changed, so the report is only rebuilt when they did.
+ *
+ * The Play, Stop and SetLightbarValue functions are lock-free and safe to call from any thread;
+ * Evaluate and Reset belong to the output thread.
+ */
+class WINDOWSDUALSENSE_DS5W_API FLightAnimator
+{
+public:
+	/**
+	 * Queues a lightbar animation, which replaces the current one.
+	 *
+	 * @param Animation The animation.
+	 * @param StartTime Time the animation starts, in seconds (FPlatformTime::Seconds()).
+	 */
+	void PlayLightbar(const FSonyGamepadLightbarAnimation& Animation, double StartTime);
+	/**
+	 * Stops the lightbar animation, giving the lightbar back to the commands.
+	 */
+	void StopLightbar();
+	/**
+	 * Moves the value gradients are sampled at when they are driven by a value. The value is kept
+	 * across animations and starts at 1.
+	 *
+	 * @param Value The value, in the unit of the times of the keys.
+	 */
+	void SetLightbarValue(float Value);
+	/**
+	 * Queues a player LED pattern, which replaces the current one.
+	 *
+	 * @param Animation The pattern.
+	 * @param StartTime Time the pattern starts, in seconds (FPlatformTime::Seconds()).
+	 */
+	void PlayPlayerLed(const FSonyGamepadPlayerLedAnimation& Animation, double StartTime);
+	/**
+	 * Stops the player LED pattern, giving the LEDs back to the commands.
+	 */
+	void StopPlayerLed();
+	/**
+	 * Applies the queued requests and animates an output state.
+	 *
+	 * @param Now The time to evaluate, in seconds.
+	 * @param InOutOutput The output state, which holds the commanded values on input.
+	 * @param OutNextTime Receives the time the colors change next.
+	 * @param bOutChanged Receives true if the lightbar or the player LEDs differ from the previous evaluation.
+	 * @return True while an animation plays or waits for its start time.
+	 */
+	bool Evaluate(double Now, FOutputContext& InOutOutput, double& OutNextTime, bool& bOutChanged);
+	/**
+	 * Drops every animation and queued request, e.g. when the controller reconnects. Must not race with Evaluate.
+	 */
+	void Reset();
+
+private:
+	enum class ERequest : uint8
+	{
+		PlayLightbar,
+		StopLightbar,
+		SetLightbarValue,
+		PlayPlayerLed,
+		StopPlayerLed,
+	};
+
+	struct FRequest
+	{
+		ERequest Type = ERequest::PlayLightbar;
+		FSonyGamepadLightbarAnimation Lightbar;
+		FSonyGamepadPlayerLedAnimation PlayerLed;
+		double Time = 0.0;
+		float Value = 0.0f;
+	};
+
+	/**
+	 * Computes the color of the lightbar animation.
+	 *
+	 * @return False once the animation is over.
+	 */
+	bool EvaluateLightbar(double Now, FLightbar& InOutLightbar, double& OutNextTime);
+	/**
+	 * Computes the LEDs of the player LED pattern.
+	 *
+	 * @return False once the pattern is over.
+	 */
+	bool EvaluatePlayerLed(double Now, FPlayerLed& InOutPlayerLed, double& OutNextTime);
+	/**
+	 * @return The value the gradient is sampled at, moving to the last value set.
+	 */
+	float GetLightbarValue(double Now) const;
+	/**
+	 * Interpolates a gradient.
+	 *
+	 * @param Keys The keys, sorted by time.
+	 * @param Position The time or value to sample.
+	 */
+	static FColor SampleGradient(const TArray<FSonyGamepadLightbarKey>& Keys, float Position);
+
+	TQueue<FRequest, EQueueMode::Mpsc> Requests;
+
+	FSonyGamepadLightbarAnimation Lightbar;
+	double LightbarStart = 0.0;
+	bool bLightbarActive = false;
+	/**
+	 * The value the gradient moves from, the one it moves to and the time the move started.
+	 */
+	float ValueFrom = 1.0f;
+	float ValueTo = 1.0f;
+	double ValueTime = 0.0;
+
+	FSonyGamepadPlayerLedAnimation PlayerLed;
+	double PlayerLedStart = 0.0;
+	bool bPlayerLedActive = false;
+
+	/**
+	 * The values of the previous evaluation, to tell whether the report needs to be rebuilt.
+	 */
+	FLightbar LastLightbar;
+	FPlayerLed LastPlayerLed;
+};
@@ -0,0 +1,178 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Core/Enums/ESonyGamepadRumbleSource.h"
+#include "Core/Structs/FOutputContext.h"
+#include "Core/Structs/FSonyGamepadTriggerLayer.h"
+
+class FRumbleMixer;
+class FTriggerStack;
+
+/**
+ * @brief The part of the output state a command replaces.
+ */
+enum class EOutputCommand : uint8
+{
+	/**
+	 * Changes nothing, but sends the report even if it is unchanged.
+	 */
+	Flush,
+	Rumble,
+	/**
+	 * The color and, on a DualShock 4, the flash times.
+	 */
+	Lightbar,
+	PlayerLed,
+	MicLed,
+	/**
+	 * Headset, speaker and microphone volumes, and the microphone status.
+	 */
+	AudioVolume,
+	AudioMode,
+	VibrationMode,
+	FeatureMode,
+	/**
+	 * Trigger softness and rumble reduction.
+	 */
+	Softness,
+	LeftTrigger,
+	RightTrigger,
+	/**
+	 * Only the frequency of the current left trigger effect.
+	 */
+	LeftTriggerFrequency,
+	/**
+	 * Only the frequency of the current right trigger effect.
+	 */
+	RightTriggerFrequency,
+	Count
+};
+
+/**
+ * @brief One change of the output state of a controller, as queued by any thread.
+ *
+ * Only the payload fields matching the type are read.
+ */
+struct FOutputCommand
+{
+	FOutputCommand() = default;
+	explicit FOutputCommand(const EOutputCommand InType)
+		: Type(InType)
+	{
+	}
+
+	EOutputCommand Type = EOutputCommand::Flush;
+	/**
+	 * Sends a report with this command applied before the commands queued after it are applied,
+	 * for sequences the device must see step by step, such as a reset followed by new settings.
+	 */
+	bool bBarrier = false;
+	/**
+	 * Order of the command among all the commands of the controller, stamped when it is queued.
+	 */
+	uint64 Sequence = 0;
+	/**
+	 * Time the command was queued, in seconds (FPlatformTime::Seconds()).
+	 */
+	double Timestamp = 0.0;
+	/**
+	 * The source a rumble command sets, each source being mixed apart by the output stage.
+	 */
+	ESonyGamepadRumbleSource RumbleSource = ESonyGamepadRumbleSource::Gameplay;
+	/**
+	 * The layer a trigger command sets, each layer being stacked apart by the output stage.
+	 */
+	FSonyGamepadTriggerLayer TriggerLayer;
+
+	FRumbles Rumbles;
+	FLightbar Lightbar;
+	FDualShockFlashLigthbar FlashLigthbar;
+	FPlayerLed PlayerLed;
+	FMicLight MicLight;
+	FAudioConfig Audio;
+	FFeatureConfig Feature;
+	FHapticTriggers Trigger;
+
+	/**
+	 * Writes the payload into an output state. A rumble replaces the rumble of the state, whatever its
+	 * source, and a trigger effect the effect of the trigger, whatever its layer, as done when no output
+	 * stage mixes the sources and stacks the layers.
+	 *
+	 * @param Output The output state to change.
+	 */
+	void Apply(FOutputContext& Output) const;
+};
+
+/**
+ * @brief Lock-free queue of the output commands of one controller.
+ *
+ * Any number of threads enqueue, e.g. audio callbacks driving the rumble, the game thread setting
+ * trigger effects and async tasks changing the lightbar, without taking a lock or touching the
+ * output state. A single consumer, the output stage, applies the commands to its own copy of the
+ * output state and builds the report from it.
+ *
+ * Commands of different producers may reach the queue in a different order than they were stamped.
+ * The consumer resolves this with the sequence numbers: a command is dropped when a newer one of the
+ * same type was already applied, so the last stamped value always wins.
+ */
+class WINDOWSDUALSENSE_DS5W_API FOutputCommandQueue
+{
+public:
+	/**
+	 * Stamps a command with its sequence number and time, and queues it. Safe to call from any thread.
+	 *
+	 * @param Command The command.
+	 * @return The sequence number of the command.
+	 */
+	uint64 Enqueue(FOutputCommand Command);
+	/**
+	 * Applies the queued commands in order, until the queue is empty or a barrier was applied.
+	 * Must only be called from one thread at a time.
+	 *
+	 * @param Output The output state the commands change.
+	 * @param Mixer The mixer the rumble commands are sent to, instead of the output state.
+	 * @param Triggers The stack the trigger commands are sent to, instead of the output state.
+	 * @param OutOldestTimestamp Receives the time the first applied command was queued.
+	 * @param bOutBarrier Receives true if draining stopped at a barrier.
+	 * @param bOutFlush Receives true if a flush was applied.
+	 * @return Number of commands dequeued, including the ones a newer command superseded.
+	 */
+	int32 Drain(FOutputContext& Output, FRumbleMixer& Mixer, FTriggerStack& Triggers, double& OutOldestTimestamp, bool& bOutBarrier, bool& bOutFlush);
+	/**
+	 * Drops every queued command, e.g. when the controller reconnects. Must not race with Drain.
+	 */
+	void Discard();
+	/**
+	 * @return True if no command is queued. Only meaningful on the consumer thread.
+	 */
+	bool IsEmpty() const
+	{
+		return Commands.IsEmpty();
+	}
+
+private:
+	/**
+	 * Types, then rumble sources, then the layers of each of the four trigger commands.
+	 */
+	static constexpr int32 SlotCount = static_cast<int32>(EOutputCommand::Count) + static_cast<int32>(ESonyGamepadRumbleSource::Count)
+		+ 4 * static_cast<int32>(ESonyGamepadTriggerLayer::Count);
+
+	/**
+	 * @return The slot a command is ordered in.
+	 */
+	static int32 GetSlot(const FOutputCommand& Command);
+
+	TQueue<FOutputCommand, EQueueMode::Mpsc> Commands;
+	std::atomic<uint64> NextSequence{1};
+	/**
+	 * Sequence number of the newest command applied, per slot.
+	 */
+	uint64 Applied[SlotCount] = {};
+};
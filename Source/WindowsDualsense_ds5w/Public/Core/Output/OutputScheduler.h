@@ -0,0 +1,410 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Core/Enums/EDeviceConnection.h"
+#include "Core/Input/SonyGamepadStateRegistry.h"
+#include "Core/Output/HapticClipPlayer.h"
+#include "Core/Output/LightAnimator.h"
+#include "Core/Output/OutputCommandQueue.h"
+#include "Core/Output/RumbleMixer.h"
+#include "Core/Output/RumbleSequencer.h"
+#include "Core/Output/TriggerStack.h"
+#include "Core/Output/TriggerTimelinePlayer.h"
+#include "Core/Structs/FOutputContext.h"
+#include "Core/Structs/FSonyGamepadBroadcastTarget.h"
+#include "Core/Structs/FSonyGamepadOutputBudget.h"
+#include "Core/Structs/FSonyGamepadOutputStats.h"
+
+class FEvent;
+class FRunnableThread;
+
+/**
+ * Size, in bytes, of the largest output report written to any supported device.
+ */
+#define SONY_GAMEPAD_MAX_OUTPUT_REPORT_SIZE 78
+
+/**
+ * @brief Sections of an output report, used to rank the pending reports of the controllers.
+ */
+enum class ESonyOutputSection : uint8
+{
+	None = 0,
+	Rumble = 1 << 0,
+	Triggers = 1 << 1,
+	Lightbar = 1 << 2,
+	PlayerLed = 1 << 3,
+	MicLed = 1 << 4,
+	Audio = 1 << 5,
+	Other = 1 << 6,
+};
+ENUM_CLASS_FLAGS(ESonyOutputSection);
+
+/**
+ * @brief Writes the output reports of every controller from one thread, within a bandwidth budget.
+ *
+ * The libraries queue output commands from any thread instead of changing the output state and
+ * writing a report. The scheduler thread drains the commands of each controller into its own copy
+ * of the output state, so producers never take a lock or race on the report, and builds a single
+ * report from all the commands that arrived since the previous one. The new report is compared with
+ * the previous one to know which sections changed; a report that changes nothing is not sent, and a
+ * pending report keeps the union of the sections changed until it is written.
+ *
+ * Each write takes a token from the bucket of the transport and, over Bluetooth, from the bucket
+ * of the adapter, so several controllers on one radio cannot saturate it and delay the input
+ * reports. When budget is short, the reports that change the rumble or the triggers go first,
+ * then the LEDs, then the audio and everything else, and controllers of the same rank are served
+ * in the order they were last served, so one busy controller cannot starve the others.
+ *
+ * Rumble curves and envelopes queued with PlayRumble and haptic clips queued with PlayClip are
+ * evaluated here as well, at SONY_GAMEPAD_RUMBLE_SAMPLE_RATE while they play, and mixed over the
+ * output state set by the commands. Trigger timelines queued with PlayTriggerTimeline wake the
+ * thread at the exact time of each key. The rumble of every source goes through the rumble mixer of the
+ * controller and the trigger effects through its trigger stack, once per report. Lightbar animations
+ * and player LED patterns wake the thread at their update rate and only rebuild the report when
+ * their 8-bit values change.
+ *
+ * Broadcasts queue the same commands to a set of controllers at once, into the command queue of each
+ * controller, so they keep their order with the commands queued directly. Every controller that
+ * received a broadcast since the previous pass is held until the budget allows all of their reports,
+ * then they are written together, so the effect starts on every controller at the same time.
+ *
+ * Writes happen outside the lock on duplicated handles, so queueing never waits for a device.
+ */
+class WINDOWSDUALSENSE_DS5W_API FOutputScheduler final : public FRunnable
+{
+public:
+	/**
+	 * @return The scheduler shared by every controller.
+	 */
+	static FOutputScheduler& Get();
+
+	/**
+	 * Starts scheduling the output of a controller, and the scheduler thread if needed. Called from the game thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param DeviceHandle The handle the library writes to. The scheduler writes through its own duplicate.
+	 * @param DeviceType The model, which defines the layout of the report.
+	 * @param Connection The connection, which defines the layout of the report and the budget it uses.
+	 * @param InitialOutput The output state the commands are applied to.
+	 * @return False if the output can not be scheduled, in which case the library writes its reports itself.
+	 */
+	bool Register(int32 ControllerId, void* DeviceHandle, EDeviceType DeviceType, EDeviceConnection Connection, const FOutputContext& InitialOutput);
+	/**
+	 * Stops scheduling the output of a controller and drops its pending report. Returns once no write
+	 * to the device is in progress, so the library can close its handle right after.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 */
+	void Unregister(int32 ControllerId);
+	/**
+	 * Queues an output command for a controller. Lock-free, safe to call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Command The command. Its sequence number and timestamp are stamped here.
+	 * @return False if the controller is not registered and the command was not queued.
+	 */
+	bool Enqueue(int32 ControllerId, const FOutputCommand& Command);
+	/**
+	 * Queues the same commands to a set of controllers, after the commands already queued to each of them.
+	 * They are applied to all of them in the same pass and written together. Lock-free, safe to call from
+	 * any thread.
+	 *
+	 * @param Target The controllers.
+	 * @param Commands The commands, applied in order.
+	 * @return The number of registered controllers the commands were queued to.
+	 */
+	int32 Broadcast(const FSonyGamepadBroadcastTarget& Target, TConstArrayView<FOutputCommand> Commands);
+	/**
+	 * Assigns a controller to a team, for the broadcasts to a team. The team is kept when the controller
+	 * reconnects. Safe to call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Team Any number identifying the team. Every controller starts in team 0.
+	 */
+	void SetTeam(int32 ControllerId, int32 Team);
+	/**
+	 * Queues a rumble curve or envelope, played by the scheduler thread from its start time. Lock-free,
+	 * safe to call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Playback The rumble.
+	 * @return A handle to stop the rumble with, or 0 if the controller is not registered.
+	 */
+	uint32 PlayRumble(int32 ControllerId, const FRumblePlayback& Playback);
+	/**
+	 * Stops a rumble queued with PlayRumble. Lock-free, safe to call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Handle The handle returned by PlayRumble, or 0 to stop every rumble of the controller.
+	 */
+	void StopRumble(int32 ControllerId, uint32 Handle);
+	/**
+	 * Queues a haptic clip, which replaces or cross-fades from the clip the controller plays. Lock-free,
+	 * safe to call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Playback The clip and how to play it.
+	 * @return False if the controller is not registered.
+	 */
+	bool PlayClip(int32 ControllerId, const FHapticClipPlayback& Playback);
+	/**
+	 * Stops the haptic clip of a controller. Lock-free, safe to call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param FadeOut Time over which the clip fades out, in seconds.
+	 */
+	void StopClip(int32 ControllerId, float FadeOut);
+	/**
+	 * Moves the haptic clip of a controller to a position. Lock-free, safe to call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Position The position, in seconds from the start of the clip.
+	 */
+	void SeekClip(int32 ControllerId, double Position);
+	/**
+	 * Queues a trigger timeline, which replaces the timeline the controller plays. Lock-free, safe to
+	 * call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Playback The timeline and how to play it.
+	 * @return False if the controller is not registered.
+	 */
+	bool PlayTriggerTimeline(int32 ControllerId, const FTriggerTimelinePlayback& Playback);
+	/**
+	 * Stops the trigger timeline of a controller. Lock-free, safe to call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 */
+	void StopTriggerTimeline(int32 ControllerId);
+	/**
+	 * Queues a lightbar animation, which replaces the animation of the controller. Lock-free, safe to
+	 * call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Animation The animation.
+	 * @param StartTime Time the animation starts, in seconds (FPlatformTime::Seconds()).
+	 * @return False if the controller is not registered.
+	 */
+	bool PlayLightbarAnimation(int32 ControllerId, const FSonyGamepadLightbarAnimation& Animation, double StartTime);
+	/**
+	 * Stops the lightbar animation of a controller. Lock-free, safe to call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 */
+	void StopLightbarAnimation(int32 ControllerId);
+	/**
+	 * Moves the value the lightbar gradient of a controller is sampled at. Lock-free, safe to call from
+	 * any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Value The value, e.g. the health of the player.
+	 */
+	void SetLightbarAnimationValue(int32 ControllerId, float Value);
+	/**
+	 * Queues a player LED pattern, which replaces the pattern of the controller. Lock-free, safe to call
+	 * from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Animation The pattern.
+	 * @param StartTime Time the pattern starts, in seconds (FPlatformTime::Seconds()).
+	 * @return False if the controller is not registered.
+	 */
+	bool PlayPlayerLedAnimation(int32 ControllerId, const FSonyGamepadPlayerLedAnimation& Animation, double StartTime);
+	/**
+	 * Stops the player LED pattern of a controller. Lock-free, safe to call from any thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 */
+	void StopPlayerLedAnimation(int32 ControllerId);
+	/**
+	 * Assigns a Bluetooth controller to an adapter. Windows does not tell which adapter a HID device is
+	 * paired with, so every controller starts on adapter 0; games that know better can split them.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param AdapterId Any number identifying the adapter.
+	 */
+	void SetAdapter(int32 ControllerId, int32 AdapterId);
+	/**
+	 * Replaces the budget. Safe to call from any thread.
+	 *
+	 * @param InBudget The rates and bursts of the transports and adapters.
+	 */
+	void SetBudget(const FSonyGamepadOutputBudget& InBudget);
+	/**
+	 * Replaces the settings of the rumble sources. Safe to call from any thread.
+	 *
+	 * @param InRumbleMix The priority, gain and blend mode of each source.
+	 */
+	void SetRumbleMix(const FSonyGamepadRumbleMix& InRumbleMix);
+	/**
+	 * @return The activity since the statistics were reset.
+	 */
+	FSonyGamepadOutputStats GetStats() const;
+	/**
+	 * Retrieves the activity of the rumble sources of a controller.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @return The activity of each source, in the order of ESonyGamepadRumbleSource, or nothing if the
+	 *         controller is not registered.
+	 */
+	TArray<FSonyGamepadRumbleSourceStats> GetRumbleStats(int32 ControllerId) const;
+	/**
+	 * Clears the statistics, including the ones of the rumble sources.
+	 */
+	void ResetStats();
+	/**
+	 * Stops the thread and releases every handle, e.g. when the module shuts down.
+	 */
+	void Shutdown();
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	FOutputScheduler();
+	virtual ~FOutputScheduler() override;
+
+	/**
+	 * Tokens of one transport or adapter, refilled continuously up to the burst.
+	 */
+	struct FTokenBucket
+	{
+		float Rate = 0.0f;
+		float Burst = 0.0f;
+		float Tokens = 0.0f;
+		double LastRefill = 0.0;
+
+		void Configure(const FSonyGamepadOutputRate& InRate);
+		void Refill(double Now);
+		double GetTimeUntilToken() const;
+	};
+
+	struct FDevice
+	{
+		/**
+		 * Duplicate of the handle of the library, null while the controller is not registered.
+		 */
+		void* Handle = nullptr;
+		/**
+		 * Set while the controller is registered, read by the producers without the lock.
+		 */
+		std::atomic<bool> bRegistered{false};
+		/**
+		 * The team of the controller, read by the broadcasts without the lock.
+		 */
+		std::atomic<int32> Team{0};
+		/**
+		 * Set by a broadcast after it queued its commands, so the scheduler thread holds the report with
+		 * the other controllers of the broadcast.
+		 */
+		std::atomic<bool> bBroadcastPending{false};
+		FOutputCommandQueue Commands;
+		/**
+		 * The output state the commands are applied to, owned by the scheduler thread.
+		 */
+		FOutputContext Output;
+		FRumbleSequencer Rumble;
+		FHapticClipPlayer Clips;
+		FRumbleMixer Mixer;
+		FTriggerStack Triggers;
+		FTriggerTimelinePlayer Timelines;
+		FLightAnimator Lights;
+		/**
+		 * Time of the next sample of the rumbles, clips, trigger fades, timeline keys and light animations,
+		 * meaningful while bSequencing or bAnimating is set.
+		 */
+		double NextSample = 0.0;
+		/**
+		 * Set while rumbles, clips or timelines play or trigger effects wait to expire, so the report is
+		 * rebuilt once more when the last one ends.
+		 */
+		bool bSequencing = false;
+		/**
+		 * Set while light animations play. They tell when their values change, so they do not need the
+		 * extra rebuild of bSequencing.
+		 */
+		bool bAnimating = false;
+		EDeviceType DeviceType = NotFound;
+		EDeviceConnection Connection = Unrecognized;
+		int32 AdapterId = 0;
+		/**
+		 * Section each byte of the report belongs to, None for the bytes that change on every report.
+		 */
+		ESonyOutputSection ByteSections[SONY_GAMEPAD_MAX_OUTPUT_REPORT_SIZE] = {};
+		/**
+		 * The last built report, pending or already written.
+		 */
+		unsigned char Report[SONY_GAMEPAD_MAX_OUTPUT_REPORT_SIZE] = {};
+		uint32 ReportLength = 0;
+		ESonyOutputSection PendingSections = ESonyOutputSection::None;
+		double PendingSince = 0.0;
+		double LastServed = 0.0;
+		bool bPending = false;
+		bool bDeferred = false;
+		/**
+		 * Set while the pending report ends on a barrier, so the next commands wait until it is written.
+		 */
+		bool bBarrier = false;
+		/**
+		 * The pass the broadcast commands of the device were applied in, or 0. Pending reports of the same
+		 * pass are written together.
+		 */
+		uint32 SyncGroup = 0;
+	};
+
+	static int32 GetPriority(ESonyOutputSection Sections);
+	static void BuildSectionMap(FDevice& Device);
+	static void ResetDevice(FDevice& Device);
+	/**
+	 * Applies the queued commands of a device, resolves its trigger stack, samples its rumbles, clips and
+	 * light animations and builds its report, which becomes pending if it changed.
+	 */
+	void UpdateDevice(FDevice& Device, double Now);
+	FTokenBucket& GetAdapterBucket(int32 AdapterId);
+	/**
+	 * @return A new sync group, never 0.
+	 */
+	uint32 NextSyncGroup();
+	/**
+	 * @return Time until the budget allows every pending report of a pass of broadcasts, or as many as
+	 *         the bursts allow, in seconds. Zero if they can be written now.
+	 */
+	double GetSyncGroupWait(uint32 SyncGroup);
+	/**
+	 * Writes every pending report the budget allows.
+	 *
+	 * @return Time until the next report can be written, in seconds.
+	 */
+	double ServePending();
+
+	/**
+	 * Guards the devices, the buckets and the statistics.
+	 */
+	mutable FCriticalSection Lock;
+	/**
+	 * Held by the scheduler thread while it writes, so unregistering waits for the write in progress.
+	 */
+	FCriticalSection WriteLock;
+
+	FDevice Devices[SONY_GAMEPAD_MAX_STATE_SLOTS];
+	uint32 LastSyncGroup = 0;
+	FTokenBucket UsbBucket;
+	FTokenBucket BluetoothBucket;
+	TMap<int32, FTokenBucket> AdapterBuckets;
+	FSonyGamepadOutputBudget Budget;
+	FSonyGamepadRumbleMix RumbleMix;
+
+	FSonyGamepadOutputStats Stats;
+	double TotalQueueDelay = 0.0;
+
+	FEvent* WakeEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopping{false};
+};
@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Structs/FOutputContext.h"
+#include "Core/Structs/FSonyGamepadRumbleMix.h"
+
+/**
+ * Number of rumble sources a controller mixes.
+ */
+#define SONY_GAMEPAD_RUMBLE_SOURCES static_cast<int32>(ESonyGamepadRumbleSource::Count)
+
+/**
+ * @brief Mixes the rumble of every source of one controller into the rumble it plays.
+ *
+ * Each source keeps the last value it set, so sources no longer overwrite each other and the last
+ * writer no longer wins. The output thread mixes them once per report, from the lowest priority to
+ * the highest, each source blending over the mix below it with its gain and blend mode.
+ *
+ * Owned by the output thread; not thread-safe.
+ */
+class WINDOWSDUALSENSE_DS5W_API FRumbleMixer
+{
+public:
+	/**
+	 * Sets the rumble a source plays until its next value.
+	 *
+	 * @param Source The source.
+	 * @param Rumbles The level of the motors.
+	 */
+	void Set(ESonyGamepadRumbleSource Source, const FRumbles& Rumbles);
+	/**
+	 * Mixes the sources.
+	 *
+	 * @param Settings The priority, gain and blend mode of each source.
+	 * @param Extra Rumble the output thread plays for each source on top of its value, e.g. the sequenced
+	 *              rumble of the gameplay or the rumble of the clips. The stronger of the two is used.
+	 * @return The rumble to play.
+	 */
+	FRumbles Mix(const FSonyGamepadRumbleMix& Settings, const FRumbles (&Extra)[SONY_GAMEPAD_RUMBLE_SOURCES]);
+	/**
+	 * @param OutStats Receives the activity of each source, in the order of ESonyGamepadRumbleSource.
+	 */
+	void GetStats(TArray<FSonyGamepadRumbleSourceStats>& OutStats) const;
+	void ResetStats();
+	/**
+	 * Silences every source and clears the statistics, e.g. when the controller reconnects.
+	 */
+	void Reset();
+
+private:
+	FRumbles Levels[SONY_GAMEPAD_RUMBLE_SOURCES];
+	FSonyGamepadRumbleSourceStats Stats[SONY_GAMEPAD_RUMBLE_SOURCES];
+};
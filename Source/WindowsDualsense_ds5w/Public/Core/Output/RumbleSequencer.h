@@ -0,0 +1,150 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Core/Structs/FOutputContext.h"
+#include "Core/Structs/FSonyGamepadRumbleEnvelope.h"
+
+class UForceFeedbackEffect;
+
+/**
+ * Rate, in samples per second, at which the rumble curves are baked and the sequencer is evaluated.
+ */
+#define SONY_GAMEPAD_RUMBLE_SAMPLE_RATE 250
+
+/**
+ * @brief Rumble curve sampled at a fixed rate, immutable once baked so any thread can read it.
+ */
+struct WINDOWSDUALSENSE_DS5W_API FRumbleCurve
+{
+	float SampleRate = SONY_GAMEPAD_RUMBLE_SAMPLE_RATE;
+	TArray<FRumbles> Samples;
+
+	/**
+	 * @return The length of the curve, in seconds.
+	 */
+	double GetDuration() const
+	{
+		return Samples.Num() > 1 ? (Samples.Num() - 1) / static_cast<double>(SampleRate) : 0.0;
+	}
+
+	/**
+	 * Interpolates the curve.
+	 *
+	 * @param Time Time since the start of the curve, in seconds, clamped to the curve.
+	 * @param OutLeft Receives the left motor level, between 0 and 1.
+	 * @param OutRight Receives the right motor level, between 0 and 1.
+	 */
+	void Evaluate(double Time, float& OutLeft, float& OutRight) const;
+
+	/**
+	 * Samples the channels of a force feedback effect. The large and small motors of each side are
+	 * merged, as the controllers have one motor per side. Must be called from the game thread.
+	 *
+	 * @param Effect The effect.
+	 * @return The baked curve, or null if the effect is invalid or empty.
+	 */
+	static TSharedPtr<const FRumbleCurve> Bake(UForceFeedbackEffect* Effect);
+};
+
+/**
+ * @brief A rumble to play: a baked curve, or an envelope when there is no curve.
+ */
+struct FRumblePlayback
+{
+	TSharedPtr<const FRumbleCurve> Curve;
+	FSonyGamepadRumbleEnvelope Envelope;
+	/**
+	 * Time the rumble starts, in seconds (FPlatformTime::Seconds()). It is evaluated from that time
+	 * on, whatever the moment the output thread wakes up.
+	 */
+	double StartTime = 0.0;
+	float Scale = 1.0f;
+	/**
+	 * Restarts the curve when it ends, until the rumble is stopped. Ignored by envelopes.
+	 */
+	bool bLoop = false;
+};
+
+/**
+ * @brief Plays the rumble curves and envelopes of one controller on the output thread.
+ *
+ * Gameplay queues a rumble once instead of pushing a value every frame. The output thread evaluates
+ * the active rumbles at a fixed rate from their own start times, so the motors follow the curves with
+ * the resolution of the output reports rather than the frame rate, and the game thread does no work
+ * while they play. Overlapping rumbles are mixed by taking the strongest level of each motor.
+ *
+ * Play and Stop are lock-free and safe to call from any thread; Evaluate and Reset belong to the
+ * output thread.
+ */
+class WINDOWSDUALSENSE_DS5W_API FRumbleSequencer
+{
+public:
+	/**
+	 * Queues a rumble.
+	 *
+	 * @param Playback The rumble.
+	 * @return A handle to stop it with, never 0.
+	 */
+	uint32 Play(const FRumblePlayback& Playback);
+	/**
+	 * Stops a rumble. An envelope fades out over its release time, a curve stops at once.
+	 *
+	 * @param Handle The handle returned by Play, or 0 to stop every rumble.
+	 */
+	void Stop(uint32 Handle);
+	/**
+	 * Applies the queued requests and evaluates the rumbles.
+	 *
+	 * @param Now The time to evaluate, in seconds.
+	 * @param OutRumbles Receives the mixed level of the motors.
+	 * @param OutNextTime Receives the time of the next sample.
+	 * @return True while a rumble is playing or waiting for its start time.
+	 */
+	bool Evaluate(double Now, FRumbles& OutRumbles, double& OutNextTime);
+	/**
+	 * Drops every rumble and queued request, e.g. when the controller reconnects. Must not race with Evaluate.
+	 */
+	void Reset();
+
+private:
+	struct FVoice
+	{
+		FRumblePlayback Playback;
+		uint32 Handle = 0;
+		/**
+		 * Time the rumble was stopped, or a negative value while it plays.
+		 */
+		double StopTime = -1.0;
+	};
+
+	struct FRequest
+	{
+		FVoice Voice;
+		bool bStop = false;
+	};
+
+	/**
+	 * Evaluates an envelope.
+	 *
+	 * @param Envelope The envelope.
+	 * @param Time Time since the start, in seconds.
+	 * @param StopTime Time since the start at which it was stopped, or a negative value.
+	 * @param bOutFinished Receives true once the release is over.
+	 * @return The level, between 0 and 1.
+	 */
+	static float EvaluateEnvelope(const FSonyGamepadRumbleEnvelope& Envelope, double Time, double StopTime, bool& bOutFinished);
+
+	TQueue<FRequest, EQueueMode::Mpsc> Requests;
+	std::atomic<uint32> NextHandle{1};
+	/**
+	 * The rumbles playing or waiting for their start time, owned by the output thread.
+	 */
+	TArray<FVoice> Voices;
+};
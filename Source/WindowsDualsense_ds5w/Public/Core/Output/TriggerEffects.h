@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Structs/FOutputContext.h"
+#include "Core/Structs/FSonyGamepadTriggerEffect.h"
+
+/**
+ * @brief Encodes the adaptive trigger effects of a DualSense into their output state.
+ *
+ * Shared by the trigger setters of UDualSenseLibrary and the effects authored in assets, so an effect
+ * played from a timeline is the same as the one set from Blueprint. Parameters are expected in range,
+ * as validated by UDualSenseProxy.
+ */
+class WINDOWSDUALSENSE_DS5W_API FTriggerEffects
+{
+public:
+	static FHapticTriggers ContinuousResistance(int32 StartPosition, int32 Strength);
+	static FHapticTriggers Resistance(int32 BeginStrength, int32 MiddleStrength, int32 EndStrength);
+	static FHapticTriggers Weapon(int32 StartPosition, int32 EndPosition, int32 Strength);
+	static FHapticTriggers Galloping(int32 StartPosition, int32 EndPosition, int32 FirstFoot, int32 SecondFoot, float Frequency);
+	static FHapticTriggers Machine(int32 StartPosition, int32 EndPosition, int32 AmplitudeBegin, int32 AmplitudeEnd, float Frequency, float Period);
+	static FHapticTriggers Bow(int32 StartPosition, int32 EndPosition, int32 BeginStrength, int32 EndStrength);
+	static FHapticTriggers AutomaticGun(int32 BeginStrength, int32 MiddleStrength, int32 EndStrength, bool bKeepEffect);
+	/**
+	 * Vibrates the trigger from a position to the end of its travel.
+	 *
+	 * @param StartPosition First zone that vibrates, from 0 to 8.
+	 * @param Strength Strength of the vibration, from 1 to 8.
+	 * @param Frequency Frequency of the vibration, from 0 to 1.
+	 */
+	static FHapticTriggers Vibration(int32 StartPosition, int32 Strength, float Frequency);
+	/**
+	 * Encodes an authored effect, clamping its parameters to their range.
+	 *
+	 * @param Effect The effect and its parameters.
+	 * @return The effect, of mode 0 for Off.
+	 */
+	static FHapticTriggers Build(const FSonyGamepadTriggerEffect& Effect);
+	/**
+	 * Encodes an effect into the bytes of its block in the output report.
+	 *
+	 * @param Effect The effect.
+	 * @param OutBytes Receives SONY_GAMEPAD_TRIGGER_EFFECT_SIZE bytes.
+	 */
+	static void Encode(const FHapticTriggers& Effect, unsigned char* OutBytes);
+	/**
+	 * Wraps the bytes of an encoded effect, which are then copied to the report as they are.
+	 *
+	 * @param Bytes SONY_GAMEPAD_TRIGGER_EFFECT_SIZE bytes, as written by Encode.
+	 * @return The encoded effect.
+	 */
+	static FHapticTriggers FromEncoded(const unsigned char* Bytes);
+	/**
+	 * Changes the frequency of an effect, in its encoded bytes as well.
+	 *
+	 * @param Effect The effect to change.
+	 * @param Frequency The frequency, as sent to the device.
+	 */
+	static void SetFrequency(FHapticTriggers& Effect, unsigned char Frequency);
+};
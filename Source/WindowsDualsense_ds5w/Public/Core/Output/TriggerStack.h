@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Structs/FOutputContext.h"
+#include "Core/Structs/FSonyGamepadTriggerLayer.h"
+
+/**
+ * Number of layers each trigger stacks.
+ */
+#define SONY_GAMEPAD_TRIGGER_LAYERS static_cast<int32>(ESonyGamepadTriggerLayer::Count)
+
+/**
+ * @brief Resolves the layered trigger effects of one controller into the single effect of each trigger.
+ *
+ * Gameplay systems write their own layer instead of the trigger, so an environment resistance, the
+ * weapon and a short feedback no longer overwrite each other and the trigger no longer flips between
+ * them on every call. The output thread resolves the stack once per report: expired effects leave,
+ * fading ones lose strength or hand over to the layer below, and the effect of highest priority is sent.
+ *
+ * Owned by the output thread; not thread-safe.
+ */
+class WINDOWSDUALSENSE_DS5W_API FTriggerStack
+{
+public:
+	/**
+	 * Sets the effect of one layer of a trigger. An effect of mode 0 clears the layer, fading out the
+	 * effect it holds over the fade out time of the layer settings.
+	 *
+	 * @param bRightTrigger The trigger, left if false.
+	 * @param Layer The layer, its priority, lifetime and fade out.
+	 * @param Effect The effect.
+	 * @param Time Time the effect was set, which starts its lifetime, in seconds.
+	 */
+	void Set(bool bRightTrigger, const FSonyGamepadTriggerLayer& Layer, const FHapticTriggers& Effect, double Time);
+	/**
+	 * Changes the frequency of the effect one layer of a trigger holds.
+	 *
+	 * @param bRightTrigger The trigger, left if false.
+	 * @param Layer The layer.
+	 * @param Frequency The frequency, as sent to the device.
+	 */
+	void SetFrequency(bool bRightTrigger, ESonyGamepadTriggerLayer Layer, unsigned char Frequency);
+	/**
+	 * Resolves the effect of each trigger.
+	 *
+	 * @param Now The time to resolve, in seconds.
+	 * @param OutLeft Receives the effect of the left trigger.
+	 * @param OutRight Receives the effect of the right trigger.
+	 * @param OutNextTime Receives the time the result changes next, when an effect expires or fades.
+	 * @return True while an effect has a lifetime or fades, so the stack must be resolved again at OutNextTime.
+	 */
+	bool Resolve(double Now, FHapticTriggers& OutLeft, FHapticTriggers& OutRight, double& OutNextTime);
+	/**
+	 * Clears every layer, e.g. when the controller reconnects.
+	 */
+	void Reset();
+
+private:
+	struct FEntry
+	{
+		FHapticTriggers Effect;
+		int32 Priority = 0;
+		/**
+		 * Time the lifetime ends and the fade out starts, negative for an effect without lifetime.
+		 */
+		double Expire = -1.0;
+		float FadeOut = 0.0f;
+		bool bActive = false;
+	};
+
+	/**
+	 * @return The weight of an entry at a time, between 0 and 1, 0 once it has faded out.
+	 */
+	static float GetWeight(const FEntry& Entry, double Now);
+	/**
+	 * Picks the effect of one trigger.
+	 */
+	static void ResolveTrigger(FEntry (&Layers)[SONY_GAMEPAD_TRIGGER_LAYERS], double Now, FHapticTriggers& OutEffect, bool& bOutTimed, double& OutNextTime);
+
+	FEntry Left[SONY_GAMEPAD_TRIGGER_LAYERS];
+	FEntry Right[SONY_GAMEPAD_TRIGGER_LAYERS];
+};
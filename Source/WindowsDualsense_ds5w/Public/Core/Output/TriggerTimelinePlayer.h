@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Core/Structs/FOutputContext.h"
+#include "Core/Structs/FSonyGamepadTriggerLayer.h"
+
+class FTriggerStack;
+
+/**
+ * @brief A compiled sequence of trigger effects, immutable and shared by every playback.
+ */
+struct FTriggerTimeline
+{
+	struct FKey
+	{
+		/**
+		 * Offset of the key from the start of the timeline, in seconds.
+		 */
+		double Time = 0.0;
+		bool bLeft = false;
+		bool bRight = false;
+		FHapticTriggers Effect;
+	};
+
+	/**
+	 * The keys, sorted by time.
+	 */
+	TArray<FKey> Keys;
+	/**
+	 * Length of one cycle, in seconds, at least the time of the last key.
+	 */
+	double Duration = 0.0;
+	/**
+	 * The layer of the trigger effect stack the keys are written to, and the fade out when the timeline stops.
+	 */
+	FSonyGamepadTriggerLayer Layer;
+	/**
+	 * Keeps the effect of the last key once the timeline ends, instead of clearing its layer.
+	 */
+	bool bHoldLastEffect = false;
+};
+
+/**
+ * @brief A trigger timeline to play on a controller.
+ */
+struct FTriggerTimelinePlayback
+{
+	TSharedPtr<const FTriggerTimeline> Timeline;
+	/**
+	 * Time the playback starts, in seconds (FPlatformTime::Seconds()).
+	 */
+	double StartTime = 0.0;
+	/**
+	 * Restarts the timeline when it ends, until it is stopped.
+	 */
+	bool bLoop = false;
+};
+
+/**
+ * @brief Plays the trigger timelines of one controller on the output thread.
+ *
+ * Each key is written to the trigger effect stack at the time it is due, and the output thread
+ * wakes for the next key instead of waiting for a frame, so the effects keep their exact offsets
+ * whatever the frame rate. One timeline plays at a time; starting another stops the current one.
+ *
+ * Play and Stop are lock-free and safe to call from any thread; Evaluate and Reset belong to the
+ * output thread.
+ */
+class WINDOWSDUALSENSE_DS5W_API FTriggerTimelinePlayer
+{
+public:
+	/**
+	 * Queues a timeline, which replaces the current one.
+	 *
+	 * @param Playback The timeline and how to play it.
+	 */
+	void Play(const FTriggerTimelinePlayback& Playback);
+	/**
+	 * Stops the current timeline and clears its layer.
+	 */
+	void Stop();
+	/**
+	 * Applies the queued requests and writes the keys due by a time.
+	 *
+	 * @param Now The time to evaluate, in seconds.
+	 * @param Triggers The trigger effect stack the keys are written to.
+	 * @param OutNextTime Receives the time of the next key, or of the end of the timeline.
+	 * @return True while a timeline plays or waits for its start time.
+	 */
+	bool Evaluate(double Now, FTriggerStack& Triggers, double& OutNextTime);
+	/**
+	 * Drops the timeline and every queued request, e.g. when the controller reconnects. Must not race with Evaluate.
+	 */
+	void Reset();
+
+private:
+	struct FRequest
+	{
+		FTriggerTimelinePlayback Playback;
+		double Time = 0.0;
+		bool bStop = false;
+	};
+
+	/**
+	 * Ends the current timeline, clearing its layer on the triggers it drives.
+	 */
+	void Finish(FTriggerStack& Triggers, double Time);
+
+	TQueue<FRequest, EQueueMode::Mpsc> Requests;
+	FTriggerTimelinePlayback Current;
+	/**
+	 * Start of the current cycle of the timeline, in seconds.
+	 */
+	double CycleStart = 0.0;
+	int32 NextKey = 0;
+};
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SceneViewExtension.h"
+#include "Core/Structs/FSonyGamepadLateLatchSettings.h"
+
+/**
+ * @brief Late-latches the controller motion into the camera on the render thread.
+ *
+ * When the view family is handed to the renderer, the extension records the orientation published
+ * by the controller. When the render thread starts rendering the family, it reads the newest state,
+ * which the input reader thread keeps publishing at the device rate, once for every view of the family.
+ * The rotation in between is added to the rotation of each view, so what reaches the screen is no
+ * longer a full frame behind the hand, and the views of a stereo pair get the same correction.
+ */
+class WINDOWSDUALSENSE_DS5W_API FSonyGamepadViewExtension final : public FSceneViewExtensionBase
+{
+public:
+	explicit FSonyGamepadViewExtension(const FAutoRegister& AutoRegister);
+
+	/**
+	 * Sets the correction settings. Game thread only.
+	 *
+	 * @param InSettings The new settings, used from the next rendered frame.
+	 */
+	void SetSettings(const FSonyGamepadLateLatchSettings& InSettings)
+	{
+		Settings = InSettings;
+	}
+	/**
+	 * @return The correction settings.
+	 */
+	const FSonyGamepadLateLatchSettings& GetSettings() const
+	{
+		return Settings;
+	}
+
+	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override;
+	virtual void PreRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily) override;
+	virtual void PreRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView) override;
+
+protected:
+	virtual bool IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const override
+	{
+		return Settings.bEnabled;
+	}
+
+private:
+	/**
+	 * Controller motion as seen by the game thread when the frame was handed to the renderer.
+	 */
+	struct FLatchSample
+	{
+		FSonyGamepadLateLatchSettings Settings;
+		FQuat4f Orientation = FQuat4f::Identity;
+		double Time = 0.0;
+		bool bValid = false;
+	};
+
+	FSonyGamepadLateLatchSettings Settings;
+	FLatchSample GameSample_RenderThread;
+	/**
+	 * Correction computed from the newest state when the render thread started the family, applied to each of its views.
+	 */
+	FRotator Correction_RenderThread = FRotator::ZeroRotator;
+};
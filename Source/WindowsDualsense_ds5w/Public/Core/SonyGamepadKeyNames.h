@@ -0,0 +1,51 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Names of the PlayStation-specific keys registered by the module, in the spirit of FGamepadKeyNames.
+ * Built once, so dispatching input does not construct an FName per button and per poll.
+ */
+struct WINDOWSDUALSENSE_DS5W_API FSonyGamepadKeyNames
+{
+	static const FName Mic;
+	static const FName Menu;
+	static const FName Share;
+	static const FName TouchButton;
+	static const FName PlayStationButton;
+	static const FName PushLeftStick;
+	static const FName PushRightStick;
+	static const FName FunctionL;
+	static const FName FunctionR;
+	static const FName PaddleL;
+	static const FName PaddleR;
+	static const FName TouchTap;
+	static const FName TouchTwoFingerTap;
+	static const FName TouchSwipeLeft;
+	static const FName TouchSwipeRight;
+	static const FName TouchSwipeUp;
+	static const FName TouchSwipeDown;
+	static const FName TouchPinchIn;
+	static const FName TouchPinchOut;
+	static const FName GyroPitch;
+	static const FName GyroYaw;
+	static const FName GyroRoll;
+	static const FName Gyro;
+	static const FName TiltPitch;
+	static const FName TiltYaw;
+	static const FName TiltRoll;
+	static const FName Tilt;
+	static const FName GravityX;
+	static const FName GravityY;
+	static const FName GravityZ;
+	static const FName Touch1X;
+	static const FName Touch1Y;
+	static const FName Touch1;
+	static const FName Touch2X;
+	static const FName Touch2Y;
+	static const FName Touch2;
+};
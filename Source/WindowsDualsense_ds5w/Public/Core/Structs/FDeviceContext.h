@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "FOutputContext.h"
+#include "FImuCalibration.h"
 #include "Core/Enums/EDeviceConnection.h"
 #include "FDeviceContext.generated.h"
 
@@ -141,4 +142,9 @@ struct FDeviceContext
 	 * initialization, compatibility checks, and tailored input/output processing.
 	 */
 	EDeviceType DeviceType;
+	/**
+	 * Factory calibration of the gyroscope and accelerometer, read by UDeviceHIDManager::FindDevices
+	 * and applied by the input decoders.
+	 */
+	FImuCalibration Calibration;
 };
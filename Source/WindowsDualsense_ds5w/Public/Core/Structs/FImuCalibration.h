@@ -0,0 +1,50 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FImuCalibration.generated.h"
+
+/**
+ * Number of calibrated IMU axes: gyroscope X, Y, Z, then accelerometer X, Y, Z.
+ */
+#define IMU_CALIBRATION_AXES 6
+
+/**
+ * @brief Factory calibration of the gyroscope and accelerometer of a device.
+ *
+ * The calibration block is read once per device from its feature report, and converted into a
+ * bias and a 16.16 fixed-point scale per axis. Calibrated samples keep the nominal units of the
+ * sensors (GYRO_RAW_PER_DEGREE_S and ACCEL_RAW_PER_G), so the rest of the pipeline is unchanged,
+ * and applying the calibration costs one subtraction, one multiplication and one shift per axis.
+ */
+USTRUCT()
+struct FImuCalibration
+{
+	GENERATED_BODY()
+
+	/**
+	 * Raw value each axis reports at rest, subtracted before scaling.
+	 */
+	int32 Bias[IMU_CALIBRATION_AXES] = {0, 0, 0, 0, 0, 0};
+	/**
+	 * Scale of each axis, in 16.16 fixed point. 65536 leaves the axis unscaled.
+	 */
+	int32 Scale[IMU_CALIBRATION_AXES] = {65536, 65536, 65536, 65536, 65536, 65536};
+	/**
+	 * True when the values were read from the device, false while the identity calibration is used.
+	 */
+	bool bValid = false;
+
+	/**
+	 * @param Axis Index of the axis, 0-2 for the gyroscope and 3-5 for the accelerometer.
+	 * @param Raw The raw sample of the axis.
+	 * @return The calibrated sample, in the nominal units of the sensor.
+	 */
+	int32 Apply(const int32 Axis, const int16 Raw) const
+	{
+		return static_cast<int32>((static_cast<int64>(Raw - Bias[Axis]) * Scale[Axis]) >> 16);
+	}
+};
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FInputLatencyStats.generated.h"
+
+/**
+ * @brief Latency between the arrival of an input report and its dispatch to the engine.
+ *
+ * Arrival is stamped by the input reader thread as soon as the report is read from the device,
+ * dispatch is the moment the report is consumed by the game thread. The time the engine takes
+ * from dispatch to the frame presented on screen is not part of the measure.
+ */
+USTRUCT(BlueprintType)
+struct FInputLatencyStats
+{
+	GENERATED_BODY()
+
+	/**
+	 * Latency of the last dispatched report, in milliseconds.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Latency")
+	float LastMs = 0.0f;
+	/**
+	 * Average latency since the statistics were reset, in milliseconds.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Latency")
+	float AverageMs = 0.0f;
+	/**
+	 * Highest latency since the statistics were reset, in milliseconds.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Latency")
+	float MaxMs = 0.0f;
+	/**
+	 * Average number of engine frames between arrival and dispatch.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Latency")
+	float AverageFrames = 0.0f;
+	/**
+	 * Number of reports measured since the statistics were reset.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Latency")
+	int32 Samples = 0;
+};
@@ -7,6 +7,11 @@
 #include "CoreMinimal.h"
 #include "FOutputContext.generated.h"
 
+/**
+ * Size, in bytes, of the block of one trigger effect in a DualSense output report.
+ */
+#define SONY_GAMEPAD_TRIGGER_EFFECT_SIZE 11
+
 /**
  * @class FAudioConfig
  *
@@ -443,6 +448,15 @@ struct FHapticTriggers
 	 * response patterns.
 	 */
 	FStrengths Strengths;
+	/**
+	 * Set when Encoded holds the final bytes of the effect, e.g. for a precompiled trigger preset. The
+	 * bytes are then copied to the report as they are, and the fields other than Mode may be unset.
+	 */
+	bool bEncoded = false;
+	/**
+	 * The trigger effect block of the report, meaningful while bEncoded is set.
+	 */
+	unsigned char Encoded[SONY_GAMEPAD_TRIGGER_EFFECT_SIZE] = {};
 };
 
 /**
@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/ESonyGamepadDeadzone.h"
+#include "FSonyGamepadAnalogSettings.generated.h"
+
+/**
+ * @brief Deadzones, response curves and event filtering of the sticks and triggers of a controller.
+ *
+ * The settings are compiled once into lookup tables by FAnalogConditioner, so conditioning a report
+ * costs a few table reads on the input reader thread. The defaults leave the values untouched.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadAnalogSettings
+{
+	GENERATED_BODY()
+
+	/**
+	 * How the stick deadzone is applied.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Analog")
+	ESonyGamepadDeadzone StickDeadzoneType = ESonyGamepadDeadzone::None;
+	/**
+	 * Deflection of the sticks below which the output is zero, in the [0, 1] range.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Analog", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float StickInnerDeadzone = 0.0f;
+	/**
+	 * Deflection of the sticks above which the output is full, in the [0, 1] range.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Analog", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float StickOuterDeadzone = 1.0f;
+	/**
+	 * Smallest output right outside the deadzone, to skip the deadzone the game applies on its side.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Analog", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float StickAntiDeadzone = 0.0f;
+	/**
+	 * Exponent of the stick response curve. 1 is linear, higher values give finer control near the center.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Analog", meta = (ClampMin = "0.1"))
+	float StickCurveExponent = 1.0f;
+	/**
+	 * Pull of the triggers below which the output is zero, in the [0, 1] range.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Analog", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float TriggerInnerDeadzone = 0.0f;
+	/**
+	 * Pull of the triggers above which the output is full, in the [0, 1] range.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Analog", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float TriggerOuterDeadzone = 1.0f;
+	/**
+	 * Smallest trigger output right outside the deadzone.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Analog", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float TriggerAntiDeadzone = 0.0f;
+	/**
+	 * Exponent of the trigger response curve. 1 is linear.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Analog", meta = (ClampMin = "0.1"))
+	float TriggerCurveExponent = 1.0f;
+	/**
+	 * Smallest change of a conditioned axis that is reported. Smaller changes keep the previous value, so
+	 * sensor noise does not generate analog events. Rest and full deflection are always reported.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Analog", meta = (ClampMin = "0.0"))
+	float ChangeEpsilon = 0.0f;
+};
@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/ESonyGamepadBroadcastScope.h"
+#include "FSonyGamepadBroadcastTarget.generated.h"
+
+/**
+ * @brief The set of controllers a broadcast effect is sent to. Controllers that are not connected are skipped.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadBroadcastTarget
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Broadcast")
+	ESonyGamepadBroadcastScope Scope = ESonyGamepadBroadcastScope::All;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Broadcast",
+		meta = (EditCondition = "Scope == ESonyGamepadBroadcastScope::Team", EditConditionHides))
+	int32 Team = 0;
+	/**
+	 * Bit N selects the controller of ID N.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Broadcast",
+		meta = (EditCondition = "Scope == ESonyGamepadBroadcastScope::Mask", EditConditionHides))
+	int32 Mask = 0;
+};
@@ -0,0 +1,33 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/ESonyGamepadButton.h"
+#include "FSonyGamepadButtonRemap.generated.h"
+
+/**
+ * @brief A button remapping profile for a controller.
+ *
+ * The profile is compiled by FButtonRemapper into a table applied to the button word of every
+ * report, before the button events are generated, so the game only sees the remapped buttons.
+ * Buttons that are neither remapped nor disabled keep their own function.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadButtonRemap
+{
+	GENERATED_BODY()
+
+	/**
+	 * The button each physical button acts as, e.g. PaddleL to Cross. Several buttons may act as the same one.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Remap")
+	TMap<ESonyGamepadButton, ESonyGamepadButton> Remap;
+	/**
+	 * Physical buttons that are ignored.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Remap")
+	TSet<ESonyGamepadButton> Disabled;
+};
@@ -0,0 +1,78 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/ESonyGamepadGyroSpace.h"
+#include "FSonyGamepadGyroLookSettings.generated.h"
+
+/**
+ * @brief Configures how a controller's gyroscope and right stick turn into camera rotation.
+ *
+ * The settings are applied by FGyroLookProcessor on the input reader thread, for every report,
+ * and the resulting rotation is accumulated until the game consumes it.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadGyroLookSettings
+{
+	GENERATED_BODY()
+
+	/**
+	 * Enables gyro aiming.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look")
+	bool bEnabled = false;
+	/**
+	 * Which rotation of the controller turns the camera horizontally.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look")
+	ESonyGamepadGyroSpace Space = ESonyGamepadGyroSpace::Player;
+	/**
+	 * Degrees of camera rotation per degree of controller rotation, at slow speeds.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look", meta = (ClampMin = "0.0"))
+	float Sensitivity = 1.0f;
+	/**
+	 * Multiplier of the pitch sensitivity relative to the yaw one.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look", meta = (ClampMin = "0.0"))
+	float PitchScale = 1.0f;
+	/**
+	 * Multiplier applied to the sensitivity at fast speeds. 1 disables the acceleration.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look", meta = (ClampMin = "0.0"))
+	float AccelerationMultiplier = 1.0f;
+	/**
+	 * Controller speed, in degrees per second, below which the base sensitivity applies.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look", meta = (ClampMin = "0.0"))
+	float SlowSpeed = 10.0f;
+	/**
+	 * Controller speed, in degrees per second, above which the full acceleration applies.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look", meta = (ClampMin = "0.0"))
+	float FastSpeed = 75.0f;
+	/**
+	 * Inverts the vertical rotation.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look")
+	bool bInvertPitch = false;
+	/**
+	 * Maps the right stick to flick stick: pushing it turns the camera towards the stick direction,
+	 * rotating it while held keeps turning by the same angle.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look")
+	bool bFlickStick = false;
+	/**
+	 * Stick deflection, in the [0, 1] range, that starts a flick.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float FlickThreshold = 0.9f;
+	/**
+	 * Duration over which a flick turn is spread, in seconds. Zero turns instantly.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Gyro Look", meta = (ClampMin = "0.0"))
+	float FlickTime = 0.1f;
+};
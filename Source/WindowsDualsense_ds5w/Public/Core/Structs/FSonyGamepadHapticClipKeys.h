@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FSonyGamepadHapticClipKeys.generated.h"
+
+/**
+ * @brief Trigger effects a haptic clip can switch to.
+ */
+UENUM(BlueprintType)
+enum class ESonyGamepadClipTriggerEffect : uint8
+{
+	Off UMETA(DisplayName = "Off"),
+	/**
+	 * Constant resistance from the start position to the end of the travel.
+	 */
+	Resistance UMETA(DisplayName = "Resistance"),
+	/**
+	 * Vibration from the start position to the end of the travel.
+	 */
+	Vibration UMETA(DisplayName = "Vibration"),
+};
+
+/**
+ * @brief Rumble of both motors at a time of a haptic clip, interpolated linearly to the next key.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadClipRumbleKey
+{
+	GENERATED_BODY()
+
+	/**
+	 * Time of the key, in seconds from the start of the clip.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Haptic Clip", meta = (ClampMin = "0.0"))
+	float Time = 0.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Haptic Clip", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float Left = 0.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Haptic Clip", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float Right = 0.0f;
+};
+
+/**
+ * @brief Lightbar color at a time of a haptic clip, interpolated linearly to the next key.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadClipLightbarKey
+{
+	GENERATED_BODY()
+
+	/**
+	 * Time of the key, in seconds from the start of the clip.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Haptic Clip", meta = (ClampMin = "0.0"))
+	float Time = 0.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Haptic Clip")
+	FColor Color = FColor::Black;
+};
+
+/**
+ * @brief Trigger effect from a time of a haptic clip until the next key.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadClipTriggerKey
+{
+	GENERATED_BODY()
+
+	/**
+	 * Time of the key, in seconds from the start of the clip.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Haptic Clip", meta = (ClampMin = "0.0"))
+	float Time = 0.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Haptic Clip")
+	ESonyGamepadClipTriggerEffect Effect = ESonyGamepadClipTriggerEffect::Off;
+	/**
+	 * Position the effect starts at, from 0 (released) to 8.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Haptic Clip", meta = (ClampMin = "0", ClampMax = "8"))
+	int32 StartPosition = 0;
+	/**
+	 * Strength of the effect, from 1 to 8.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Haptic Clip", meta = (ClampMin = "1", ClampMax = "8"))
+	int32 Strength = 8;
+	/**
+	 * Frequency of the vibration, from 0 to 1.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Haptic Clip", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "Effect == ESonyGamepadClipTriggerEffect::Vibration"))
+	float Frequency = 0.2f;
+};
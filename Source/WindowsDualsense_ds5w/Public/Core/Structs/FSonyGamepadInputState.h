@@ -0,0 +1,160 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/EDeviceCommons.h"
+#include "Core/Enums/ESonyGamepadButton.h"
+#include "FSonyGamepadInputState.generated.h"
+
+/**
+ * @brief A finger on the touchpad, as reported by the device.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadTouch
+{
+	GENERATED_BODY()
+
+	/**
+	 * Horizontal position on the touchpad, in device units (0-1919 on DualSense and DualShock 4).
+	 */
+	UPROPERTY()
+	int16 X = 0;
+	/**
+	 * Vertical position on the touchpad, in device units (0-1079 on DualSense, 0-941 on DualShock 4).
+	 */
+	UPROPERTY()
+	int16 Y = 0;
+	/**
+	 * Tracking id assigned by the device, incremented for each new contact.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Input State")
+	uint8 Id = 0;
+	/**
+	 * True while the finger touches the pad.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Input State")
+	bool bDown = false;
+
+	/**
+	 * @return Position on the touchpad, in device units.
+	 */
+	FVector2D GetPosition() const
+	{
+		return FVector2D(X, Y);
+	}
+};
+
+/**
+ * @brief Input state of a Sony gamepad, decoded from a single input report.
+ *
+ * The state is a compact POD, copied into every slot of the report ring and of the state buffers on each
+ * report: single-precision vectors, the orientation as four packed floats and the buttons packed in a single
+ * word indexed by ESonyGamepadButton. Values derived from other fields, such as the gravity or the linear
+ * acceleration, are computed on demand instead of being stored.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadInputState
+{
+	GENERATED_BODY()
+
+	/**
+	 * Left stick, each axis in the [-1, 1] range, Y up.
+	 */
+	UPROPERTY()
+	FVector2f LeftStick = FVector2f::ZeroVector;
+	/**
+	 * Right stick, each axis in the [-1, 1] range, Y up.
+	 */
+	UPROPERTY()
+	FVector2f RightStick = FVector2f::ZeroVector;
+	/**
+	 * Left trigger, in the [0, 1] range.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Input State")
+	float LeftTrigger = 0.0f;
+	/**
+	 * Right trigger, in the [0, 1] range.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Input State")
+	float RightTrigger = 0.0f;
+	/**
+	 * Pressed buttons, one bit per ESonyGamepadButton.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Input State")
+	int32 Buttons = 0;
+	/**
+	 * First finger on the touchpad.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Input State")
+	FSonyGamepadTouch Touch1;
+	/**
+	 * Second finger on the touchpad.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Input State")
+	FSonyGamepadTouch Touch2;
+	/**
+	 * Angular velocity reported by the gyroscope, calibrated, in sensor units (GYRO_RAW_PER_DEGREE_S per deg/s).
+	 */
+	UPROPERTY()
+	FVector3f Gyroscope = FVector3f::ZeroVector;
+	/**
+	 * Acceleration reported by the accelerometer, calibrated, in sensor units (ACCEL_RAW_PER_G per g).
+	 */
+	UPROPERTY()
+	FVector3f Accelerometer = FVector3f::ZeroVector;
+	/**
+	 * Orientation of the controller, fused from the gyroscope and the accelerometer. Identity when the
+	 * controller lies flat; the heading is relative to the one the controller had when it connected.
+	 */
+	UPROPERTY()
+	FQuat4f Orientation = FQuat4f::Identity;
+	/**
+	 * Angular velocity of the controller in its own frame, in rad/s, with the learned gyroscope bias removed.
+	 */
+	UPROPERTY()
+	FVector3f AngularVelocity = FVector3f::ZeroVector;
+	/**
+	 * Arrival time of the report the state was decoded from, in seconds (FPlatformTime::Seconds()). Kept in
+	 * double precision: a float loses millisecond precision after a few hours of uptime.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Input State")
+	double Timestamp = 0.0;
+	/**
+	 * Index of the report the state was decoded from, wrapping around after 2^32 reports.
+	 */
+	UPROPERTY()
+	uint32 Sequence = 0;
+	/**
+	 * Battery level, in percent.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Input State")
+	uint8 Battery = 0;
+
+	/**
+	 * @param Button The button to test.
+	 * @return True if the button is pressed.
+	 */
+	bool IsButtonDown(const ESonyGamepadButton Button) const
+	{
+		return (static_cast<uint32>(Buttons) >> static_cast<uint8>(Button)) & 1;
+	}
+	/**
+	 * @return Gravity in the frame of the controller, in m/s^2, pointing down.
+	 */
+	FVector3f GetGravity() const
+	{
+		// The accelerometer reads +1 g on Y when the controller lies flat, where the orientation is the identity.
+		return -Orientation.UnrotateVector(FVector3f(0.0f, 1.0f, 0.0f)) * STANDARD_GRAVITY;
+	}
+	/**
+	 * @return Acceleration of the controller in its own frame, in m/s^2, with gravity removed.
+	 */
+	FVector3f GetLinearAcceleration() const
+	{
+		// At rest the accelerometer reads the upward reaction to gravity, which the gravity vector cancels.
+		return Accelerometer * (STANDARD_GRAVITY / ACCEL_RAW_PER_G) + GetGravity();
+	}
+};
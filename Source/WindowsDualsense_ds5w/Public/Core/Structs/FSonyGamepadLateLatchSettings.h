@@ -0,0 +1,61 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FSonyGamepadLateLatchSettings.generated.h"
+
+/**
+ * @brief Configures the render-thread camera correction driven by a controller.
+ *
+ * The camera rotation computed by the game thread is corrected, right before the view matrices are
+ * finalized, by the gyroscope rotation and the right stick movement that happened since the view was set up.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadLateLatchSettings
+{
+	GENERATED_BODY()
+
+	/**
+	 * Enables the correction.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Late Latch")
+	bool bEnabled = false;
+	/**
+	 * The controller whose motion drives the camera.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Late Latch")
+	int32 ControllerId = 0;
+	/**
+	 * Player index of the corrected view, or -1 to correct every game view.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Late Latch")
+	int32 PlayerIndex = -1;
+	/**
+	 * Degrees of camera yaw per degree of controller rotation around its vertical axis. Must match the game's gyro aiming.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Late Latch")
+	float GyroYawScale = 1.0f;
+	/**
+	 * Degrees of camera pitch per degree of controller rotation around its lateral axis. Must match the game's gyro aiming.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Late Latch")
+	float GyroPitchScale = 1.0f;
+	/**
+	 * Camera yaw rate at full right stick deflection, in degrees per second. Zero ignores the stick.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Late Latch")
+	float StickYawRate = 0.0f;
+	/**
+	 * Camera pitch rate at full right stick deflection, in degrees per second. Zero ignores the stick.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Late Latch")
+	float StickPitchRate = 0.0f;
+	/**
+	 * Largest correction applied to a frame, in degrees per axis.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Late Latch", meta = (ClampMin = "0.0"))
+	float MaxCorrection = 5.0f;
+};
@@ -0,0 +1,145 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/EDeviceCommons.h"
+#include "Core/Enums/ESonyGamepadLightAnimation.h"
+#include "FSonyGamepadLightAnimation.generated.h"
+
+/**
+ * @brief A color of a lightbar gradient.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadLightbarKey
+{
+	GENERATED_BODY()
+
+	/**
+	 * Position of the key: seconds from the start of the animation, or the value it stands for when the
+	 * gradient is driven by a value.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation")
+	float Time = 0.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation")
+	FColor Color = FColor::White;
+	/**
+	 * How the color moves from this key to the next one.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation")
+	ESonyGamepadLightEasing Easing = ESonyGamepadLightEasing::Linear;
+};
+
+/**
+ * @brief A lightbar animation, played by the output thread over the color set with SetLightbar.
+ *
+ * The color is computed at most UpdateRate times per second and a report is only written when the
+ * 8-bit color actually changes, so slow animations cost few reports.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadLightbarAnimation
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation")
+	ESonyGamepadLightbarMode Mode = ESonyGamepadLightbarMode::Breathe;
+	/**
+	 * The colors of the gradient, in any order.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (EditCondition = "Mode == ESonyGamepadLightbarMode::Gradient", EditConditionHides))
+	TArray<FSonyGamepadLightbarKey> Keys;
+	/**
+	 * Restarts the gradient after its last key. Otherwise the last color holds.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (EditCondition = "Mode == ESonyGamepadLightbarMode::Gradient && !bDrivenByValue", EditConditionHides))
+	bool bLoop = true;
+	/**
+	 * Samples the gradient at the value set with SetLightbarAnimationValue instead of the time, e.g. to
+	 * show the health of the player.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (EditCondition = "Mode == ESonyGamepadLightbarMode::Gradient", EditConditionHides))
+	bool bDrivenByValue = false;
+	/**
+	 * Time over which the gradient moves to a new value, in seconds.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (ClampMin = "0.0", EditCondition = "Mode == ESonyGamepadLightbarMode::Gradient && bDrivenByValue", EditConditionHides))
+	float ValueBlendTime = 0.25f;
+	/**
+	 * Color of the pulse, or of the top of the breath.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (EditCondition = "Mode == ESonyGamepadLightbarMode::Pulse || Mode == ESonyGamepadLightbarMode::Breathe", EditConditionHides))
+	FColor Color = FColor::White;
+	/**
+	 * Color between the pulses, or of the bottom of the breath.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (EditCondition = "Mode == ESonyGamepadLightbarMode::Pulse || Mode == ESonyGamepadLightbarMode::Breathe", EditConditionHides))
+	FColor SecondColor = FColor::Black;
+	/**
+	 * Length of one pulse, breath or turn of the color wheel, in seconds.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (ClampMin = "0.01", EditCondition = "Mode != ESonyGamepadLightbarMode::Gradient", EditConditionHides))
+	float Period = 2.0f;
+	/**
+	 * Fraction of the period the pulse shows its color.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "Mode == ESonyGamepadLightbarMode::Pulse", EditConditionHides))
+	float DutyCycle = 0.5f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "Mode == ESonyGamepadLightbarMode::Rainbow", EditConditionHides))
+	float Saturation = 1.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "Mode == ESonyGamepadLightbarMode::Rainbow", EditConditionHides))
+	float Brightness = 1.0f;
+	/**
+	 * Time after which the animation ends and the color set with SetLightbar comes back, in seconds.
+	 * Zero plays until the animation is stopped or replaced.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation", meta = (ClampMin = "0.0"))
+	float Duration = 0.0f;
+	/**
+	 * Most times per second the color is computed. Pulses switch at their exact time regardless.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation", meta = (ClampMin = "1.0", ClampMax = "250.0"))
+	float UpdateRate = 30.0f;
+};
+
+/**
+ * @brief A pattern of the player LEDs, played by the output thread over the LEDs set with SetPlayerLed.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadPlayerLedAnimation
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation")
+	ESonyGamepadPlayerLedPattern Pattern = ESonyGamepadPlayerLedPattern::Chase;
+	/**
+	 * The LEDs that blink.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation",
+		meta = (EditCondition = "Pattern == ESonyGamepadPlayerLedPattern::Blink", EditConditionHides))
+	ELedPlayerEnum Led = ELedPlayerEnum::All;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation")
+	ELedBrightnessEnum Brightness = ELedBrightnessEnum::High;
+	/**
+	 * Length of one cycle of the pattern, in seconds.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation", meta = (ClampMin = "0.01"))
+	float Period = 1.0f;
+	/**
+	 * Time after which the pattern ends and the LEDs set with SetPlayerLed come back, in seconds. Zero
+	 * plays until the pattern is stopped or replaced.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Light Animation", meta = (ClampMin = "0.0"))
+	float Duration = 0.0f;
+};
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FSonyGamepadOutputBudget.generated.h"
+
+/**
+ * @brief Rate and burst of one token bucket of the output scheduler.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadOutputRate
+{
+	GENERATED_BODY()
+
+	FSonyGamepadOutputRate() = default;
+	FSonyGamepadOutputRate(const float InReportsPerSecond, const float InBurst)
+		: ReportsPerSecond(InReportsPerSecond)
+		, Burst(InBurst)
+	{
+	}
+
+	/**
+	 * Sustained number of output reports per second the bucket allows.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Output", meta = (ClampMin = "1.0"))
+	float ReportsPerSecond = 250.0f;
+	/**
+	 * Number of reports that can be sent back to back after the bucket was idle.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Output", meta = (ClampMin = "1.0"))
+	float Burst = 4.0f;
+};
+
+/**
+ * @brief Bandwidth the output scheduler shares between the controllers.
+ *
+ * Every output report takes a token from the bucket of its transport and, over Bluetooth, from the
+ * bucket of the adapter the controller is paired with. Controllers that find a bucket empty keep
+ * their pending report, which is merged with the next updates and sent when tokens are available.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadOutputBudget
+{
+	GENERATED_BODY()
+
+	/**
+	 * Budget of all the controllers connected over USB.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Output")
+	FSonyGamepadOutputRate Usb = FSonyGamepadOutputRate(1000.0f, 16.0f);
+	/**
+	 * Budget of all the controllers connected over Bluetooth.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Output")
+	FSonyGamepadOutputRate Bluetooth = FSonyGamepadOutputRate(500.0f, 8.0f);
+	/**
+	 * Budget of each Bluetooth adapter, shared by the controllers paired with it. The radio also carries
+	 * the input reports, so this is lower than what the link could send with no input at all.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Output")
+	FSonyGamepadOutputRate BluetoothAdapter = FSonyGamepadOutputRate(250.0f, 4.0f);
+};
@@ -0,0 +1,51 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FSonyGamepadOutputStats.generated.h"
+
+/**
+ * @brief Activity of the output scheduler, across all the controllers.
+ *
+ * The queue delay runs from the first update of a pending report to the moment it is written to the
+ * device. A rising delay or deferred count means the budget is too low for the feedback the game sends.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadOutputStats
+{
+	GENERATED_BODY()
+
+	/**
+	 * Number of output reports written to the devices.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Output")
+	int32 SentReports = 0;
+	/**
+	 * Number of output commands folded into a report with other commands, and never sent on their own.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Output")
+	int32 MergedUpdates = 0;
+	/**
+	 * Number of times a pending report was held back because its transport or adapter had no budget left.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Output")
+	int32 DeferredUpdates = 0;
+	/**
+	 * Number of reports the device did not accept.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Output")
+	int32 FailedWrites = 0;
+	/**
+	 * Average queue delay of the sent reports, in milliseconds.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Output")
+	float AverageQueueDelayMs = 0.0f;
+	/**
+	 * Highest queue delay of the sent reports, in milliseconds.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Output")
+	float MaxQueueDelayMs = 0.0f;
+};
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FSonyGamepadPredictionSettings.generated.h"
+
+/**
+ * @brief How far and how strongly one input channel is extrapolated.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadChannelPrediction
+{
+	GENERATED_BODY()
+
+	/**
+	 * Longest time the channel is extrapolated past its newest sample, in seconds. Target times further
+	 * away are predicted as if they were at the horizon.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Prediction", meta = (ClampMin = "0.0"))
+	float Horizon = 0.02f;
+	/**
+	 * Largest correction applied to the newest sample, in the unit of the channel: stick deflection for
+	 * the sticks, degrees per second for the gyroscope.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Prediction", meta = (ClampMin = "0.0"))
+	float MaxCorrection = 0.25f;
+};
+
+/**
+ * @brief Settings of the extrapolation of the sticks and angular velocity of a controller to a target time.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadPredictionSettings
+{
+	GENERATED_BODY()
+
+	/**
+	 * Extrapolates the channels. When disabled, predictions return the newest state unchanged.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Prediction")
+	bool bEnabled = false;
+	/**
+	 * Number of recent samples the rate of change of each channel is fitted on. More samples filter
+	 * more noise, but react later to a change of direction.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Prediction", meta = (ClampMin = "2", ClampMax = "8"))
+	int32 FitSamples = 4;
+	/**
+	 * Prediction of the left stick.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Prediction")
+	FSonyGamepadChannelPrediction LeftStick;
+	/**
+	 * Prediction of the right stick.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Prediction")
+	FSonyGamepadChannelPrediction RightStick;
+	/**
+	 * Prediction of the angular velocity.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Prediction")
+	FSonyGamepadChannelPrediction Gyroscope = {0.02f, 180.0f};
+};
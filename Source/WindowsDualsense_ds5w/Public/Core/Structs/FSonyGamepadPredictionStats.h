@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FSonyGamepadPredictionStats.generated.h"
+
+/**
+ * @brief Error of the predictions of one input channel against the values the device reported at the target times.
+ *
+ * The baseline is the error of using the newest sample as is, without prediction: a prediction
+ * only helps while its mean error stays below the baseline.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadPredictionError
+{
+	GENERATED_BODY()
+
+	/**
+	 * Number of predictions compared to the reported values since the statistics were reset.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Prediction")
+	int32 Samples = 0;
+	/**
+	 * Average error of the predictions, in the unit of the channel.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Prediction")
+	float MeanAbsolute = 0.0f;
+	/**
+	 * Root mean square of the error of the predictions, in the unit of the channel.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Prediction")
+	float RootMeanSquare = 0.0f;
+	/**
+	 * Largest error of the predictions, in the unit of the channel.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Prediction")
+	float Max = 0.0f;
+	/**
+	 * Average error of the newest sample at the same target times, in the unit of the channel.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Prediction")
+	float BaselineMeanAbsolute = 0.0f;
+};
+
+/**
+ * @brief Prediction error of the sticks, in stick deflection, and of the angular velocity, in degrees per second.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadPredictionStats
+{
+	GENERATED_BODY()
+
+	/**
+	 * Error of the left stick, as the distance between the predicted and reported positions.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Prediction")
+	FSonyGamepadPredictionError LeftStick;
+	/**
+	 * Error of the right stick, as the distance between the predicted and reported positions.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Prediction")
+	FSonyGamepadPredictionError RightStick;
+	/**
+	 * Error of the angular velocity, as the length of the difference between the predicted and reported rates.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Prediction")
+	FSonyGamepadPredictionError Gyroscope;
+};
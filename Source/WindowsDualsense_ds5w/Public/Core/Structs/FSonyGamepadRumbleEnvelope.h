@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FSonyGamepadRumbleEnvelope.generated.h"
+
+/**
+ * @brief Attack, decay, sustain and release envelope of a rumble, evaluated on the output thread.
+ *
+ * The level rises from zero to the peak during the attack, falls to the sustain level during the decay,
+ * holds it for the sustain time and fades to zero during the release. The peak is scaled per motor by
+ * the amplitudes.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadRumbleEnvelope
+{
+	GENERATED_BODY()
+
+	/**
+	 * Time to rise from zero to the peak, in seconds.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Force Feedback", meta = (ClampMin = "0.0"))
+	float AttackTime = 0.01f;
+	/**
+	 * Time to fall from the peak to the sustain level, in seconds.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Force Feedback", meta = (ClampMin = "0.0"))
+	float DecayTime = 0.05f;
+	/**
+	 * Level held after the decay, as a fraction of the peak.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Force Feedback", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float SustainLevel = 0.6f;
+	/**
+	 * Time the sustain level is held, in seconds. A negative time holds it until the rumble is stopped.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Force Feedback")
+	float SustainTime = 0.2f;
+	/**
+	 * Time to fade from the current level to zero, in seconds.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Force Feedback", meta = (ClampMin = "0.0"))
+	float ReleaseTime = 0.1f;
+	/**
+	 * Peak of the left (large) motor.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Force Feedback", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float LeftAmplitude = 1.0f;
+	/**
+	 * Peak of the right (small) motor.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Force Feedback", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float RightAmplitude = 1.0f;
+};
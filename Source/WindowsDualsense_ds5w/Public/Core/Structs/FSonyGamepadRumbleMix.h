@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/ESonyGamepadRumbleSource.h"
+#include "FSonyGamepadRumbleMix.generated.h"
+
+/**
+ * @brief How one rumble source enters the mix.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadRumbleSourceSettings
+{
+	GENERATED_BODY()
+
+	FSonyGamepadRumbleSourceSettings() = default;
+	FSonyGamepadRumbleSourceSettings(const int32 InPriority, const ESonyGamepadRumbleBlend InBlend)
+		: Priority(InPriority)
+		, Blend(InBlend)
+	{
+	}
+
+	/**
+	 * Sources are mixed from the lowest priority to the highest, so a source blends over the ones below it.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Rumble Mix")
+	int32 Priority = 0;
+	/**
+	 * Multiplier applied to the source before it is mixed.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Rumble Mix", meta = (ClampMin = "0.0"))
+	float Gain = 1.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Rumble Mix")
+	ESonyGamepadRumbleBlend Blend = ESonyGamepadRumbleBlend::Max;
+	/**
+	 * Fraction of the lower priority mix kept while a ducking source plays.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Rumble Mix", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "Blend == ESonyGamepadRumbleBlend::Duck"))
+	float DuckLevel = 0.25f;
+};
+
+/**
+ * @brief Settings of every rumble source, shared by all the controllers.
+ *
+ * By default the audio sits under the gameplay, the interface feedback adds to both, and the cinematic
+ * clips duck everything else while they rumble.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadRumbleMix
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Rumble Mix")
+	FSonyGamepadRumbleSourceSettings Gameplay = FSonyGamepadRumbleSourceSettings(1, ESonyGamepadRumbleBlend::Max);
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Rumble Mix")
+	FSonyGamepadRumbleSourceSettings Audio = FSonyGamepadRumbleSourceSettings(0, ESonyGamepadRumbleBlend::Max);
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Rumble Mix")
+	FSonyGamepadRumbleSourceSettings UI = FSonyGamepadRumbleSourceSettings(2, ESonyGamepadRumbleBlend::SumClamp);
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Rumble Mix")
+	FSonyGamepadRumbleSourceSettings Cinematic = FSonyGamepadRumbleSourceSettings(3, ESonyGamepadRumbleBlend::Duck);
+
+	const FSonyGamepadRumbleSourceSettings& Get(const ESonyGamepadRumbleSource Source) const
+	{
+		switch (Source)
+		{
+		case ESonyGamepadRumbleSource::Audio:
+			return Audio;
+		case ESonyGamepadRumbleSource::UI:
+			return UI;
+		case ESonyGamepadRumbleSource::Cinematic:
+			return Cinematic;
+		default:
+			return Gameplay;
+		}
+	}
+};
+
+/**
+ * @brief Activity of one rumble source on one controller.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadRumbleSourceStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Rumble Mix")
+	ESonyGamepadRumbleSource Source = ESonyGamepadRumbleSource::Gameplay;
+	/**
+	 * Number of rumble values the source set.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Rumble Mix")
+	int32 Updates = 0;
+	/**
+	 * Number of mixes the source rumbled in.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Rumble Mix")
+	int32 ActiveMixes = 0;
+	/**
+	 * Number of mixes the source was lowered by a ducking source of higher priority.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Rumble Mix")
+	int32 DuckedMixes = 0;
+	/**
+	 * Strongest motor level of the source in the last mix, before its gain.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "SonyGamepad: Rumble Mix")
+	float LastLevel = 0.0f;
+};
@@ -0,0 +1,78 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/ESonyGamepadTriggerEffect.h"
+#include "FSonyGamepadTriggerEffect.generated.h"
+
+/**
+ * @brief One adaptive trigger effect and its parameters, for effects authored in assets.
+ *
+ * Only the parameters of the selected effect are used; they match the parameters of the trigger
+ * effect functions of UDualSenseProxy.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadTriggerEffect
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect")
+	ESonyGamepadTriggerEffect Effect = ESonyGamepadTriggerEffect::Off;
+	/**
+	 * Position the effect starts at, from 0 (released) to 8.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect", meta = (ClampMin = "0", ClampMax = "8",
+		EditCondition = "Effect == ESonyGamepadTriggerEffect::ContinuousResistance || Effect == ESonyGamepadTriggerEffect::Weapon || Effect == ESonyGamepadTriggerEffect::Galloping || Effect == ESonyGamepadTriggerEffect::Machine || Effect == ESonyGamepadTriggerEffect::Bow"))
+	int32 StartPosition = 0;
+	/**
+	 * Position the effect ends at, from 0 (released) to 8.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect", meta = (ClampMin = "0", ClampMax = "8",
+		EditCondition = "Effect == ESonyGamepadTriggerEffect::Weapon || Effect == ESonyGamepadTriggerEffect::Galloping || Effect == ESonyGamepadTriggerEffect::Machine || Effect == ESonyGamepadTriggerEffect::Bow"))
+	int32 EndPosition = 8;
+	/**
+	 * Strength at the beginning of the travel, the strength of a continuous resistance or weapon, or the
+	 * first amplitude of a machine.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect", meta = (ClampMin = "0", ClampMax = "8",
+		EditCondition = "Effect != ESonyGamepadTriggerEffect::Off && Effect != ESonyGamepadTriggerEffect::Galloping"))
+	int32 BeginStrength = 8;
+	/**
+	 * Strength at the middle of the travel.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect", meta = (ClampMin = "0", ClampMax = "8",
+		EditCondition = "Effect == ESonyGamepadTriggerEffect::Resistance || Effect == ESonyGamepadTriggerEffect::AutomaticGun"))
+	int32 MiddleStrength = 8;
+	/**
+	 * Strength at the end of the travel, or the second amplitude of a machine.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect", meta = (ClampMin = "0", ClampMax = "8",
+		EditCondition = "Effect == ESonyGamepadTriggerEffect::Resistance || Effect == ESonyGamepadTriggerEffect::AutomaticGun || Effect == ESonyGamepadTriggerEffect::Bow || Effect == ESonyGamepadTriggerEffect::Machine"))
+	int32 EndStrength = 8;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect", meta = (ClampMin = "0", ClampMax = "7",
+		EditCondition = "Effect == ESonyGamepadTriggerEffect::Galloping"))
+	int32 FirstFoot = 2;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect", meta = (ClampMin = "0", ClampMax = "7",
+		EditCondition = "Effect == ESonyGamepadTriggerEffect::Galloping"))
+	int32 SecondFoot = 7;
+	/**
+	 * Frequency of the effect, from 0 to 1.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect", meta = (ClampMin = "0.0", ClampMax = "1.0",
+		EditCondition = "Effect == ESonyGamepadTriggerEffect::Galloping || Effect == ESonyGamepadTriggerEffect::Machine"))
+	float Frequency = 0.5f;
+	/**
+	 * Period of a machine, from 0 to 3.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect", meta = (ClampMin = "0.0", ClampMax = "3.0",
+		EditCondition = "Effect == ESonyGamepadTriggerEffect::Machine"))
+	float Period = 1.0f;
+	/**
+	 * Keeps an automatic gun vibrating at full strength at the end of the travel.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Effect", meta = (EditCondition = "Effect == ESonyGamepadTriggerEffect::AutomaticGun"))
+	bool bKeepEffect = false;
+};
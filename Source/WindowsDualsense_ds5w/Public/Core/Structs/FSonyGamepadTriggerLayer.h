@@ -0,0 +1,41 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Enums/ESonyGamepadTriggerLayer.h"
+#include "FSonyGamepadTriggerLayer.generated.h"
+
+/**
+ * @brief Where a trigger effect goes in the trigger effect stack, and how long it stays there.
+ *
+ * An effect replaces the previous effect of its layer only. Once per output report, the effect of
+ * highest priority among the layers of a trigger is sent to the device; layers of equal priority are
+ * ranked by their order in ESonyGamepadTriggerLayer, Feedback on top.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadTriggerLayer
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Layers")
+	ESonyGamepadTriggerLayer Layer = ESonyGamepadTriggerLayer::Weapon;
+	/**
+	 * The effect of highest priority is played. Equal priorities are ranked by layer.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Layers")
+	int32 Priority = 0;
+	/**
+	 * Time the effect stays in its layer, in seconds. Zero keeps it until it is replaced or cleared.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Layers", meta = (ClampMin = "0.0"))
+	float Lifetime = 0.0f;
+	/**
+	 * Time the effect fades out once its lifetime ends, in seconds. Resistance, multi-zone and machine
+	 * effects lose strength; other effects hand the trigger to the layer below halfway through the fade.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Layers", meta = (ClampMin = "0.0"))
+	float FadeOut = 0.0f;
+};
@@ -0,0 +1,32 @@
+// Copyright (c) 2025 Rafael Valoto/Publisher. All rights reserved.
+// Created for: WindowsDualsense_ds5w - Plugin to support DualSense controller on Windows.
+// Planned Release Year: 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "Core/Structs/FSonyGamepadTriggerEffect.h"
+#include "FSonyGamepadTriggerTimelineKey.generated.h"
+
+/**
+ * @brief Trigger effect set at a time of a trigger timeline, held until the next key of the same trigger.
+ */
+USTRUCT(BlueprintType)
+struct FSonyGamepadTriggerTimelineKey
+{
+	GENERATED_BODY()
+
+	/**
+	 * Time of the key, in seconds from the start of the timeline.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Timeline", meta = (ClampMin = "0.0"))
+	float Time = 0.0f;
+	/**
+	 * The trigger the effect is set on, AnyHand for both.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Timeline")
+	EControllerHand Hand = EControllerHand::AnyHand;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SonyGamepad: Trigger Timeline")
+	FSonyGamepadTriggerEffect Effect;
+};
@@ -7,6 +7,9 @@
 #include "CoreMinimal.h"
 #include "IHapticDevice.h"
 #include "IInputDevice.h"
+#include "Core/Enums/EPollingPolicy.h"
+#include "Core/Enums/EInputSamplingPoint.h"
+#include "Core/Enums/EDeviceConnection.h"
 
 
 /**
@@ -128,13 +131,55 @@ public:
 	{
 		LazyLoading = IsLazy;
 	}
+	/**
+	 * Sets how the reports buffered on the reader thread of each connected device are sampled.
+	 *
+	 * @param Policy The polling policy applied to every connected device.
+	 * @param FixedRateHz Sampling rate used by EPollingPolicy::FixedRate, between 1 Hz and the report rate of the
+	 *                    devices. Higher rates deliver every report, like EPollingPolicy::NativeRate.
+	 */
+	void SetPollingPolicy(const EPollingPolicy Policy, const float FixedRateHz = 125.0f)
+	{
+		PollingPolicy = Policy;
+		FixedPollRate = FMath::Max(FixedRateHz, 1.0f);
+	}
+	/**
+	 * @return The polling policy currently applied to connected devices.
+	 */
+	EPollingPolicy GetPollingPolicy() const
+	{
+		return PollingPolicy;
+	}
+	/**
+	 * @return The highest report rate measured on the connected devices, in Hz.
+	 */
+	float GetDetectedReportRate() const
+	{
+		return DetectedReportRate;
+	}
+	/**
+	 * Sets at which point of the frame the buffered input reports are consumed and dispatched.
+	 *
+	 * @param Point The sampling point used for every connected device.
+	 */
+	void SetSamplingPoint(const EInputSamplingPoint Point)
+	{
+		SamplingPoint = Point;
+	}
+	/**
+	 * @return The point of the frame at which input reports are consumed.
+	 */
+	EInputSamplingPoint GetSamplingPoint() const
+	{
+		return SamplingPoint;
+	}
 	/**
 	 * Handles user login state changes
 	 * @param bLoggedIn Whether user is logged in
 	 * @param UserId Platform-specific user identifier
 	 * @param UserIndex Index of the user
 	 */
-	void OnUserLoginChangedEvent(bool bLoggedIn, int32 UserId, int32 UserIndex) const;
+	void OnUserLoginChangedEvent(bool bLoggedIn, int32 UserId, int32 UserIndex);
 	/**
 	 * Handles controller connection state changes
 	 * @param Connected New connection state
@@ -142,7 +187,7 @@ public:
 	 * @param InputDeviceId Identifier of the input device
 	 */
 	void OnConnectionChange(EInputDeviceConnectionState Connected, FPlatformUserId PlatformUserId,
-	                        FInputDeviceId InputDeviceId) const;
+	                        FInputDeviceId InputDeviceId);
 
 	/**
 	 * Assigns a specified input device to a platform user and establishes its connection state.
@@ -167,12 +212,10 @@ public:
 	}
 	/**
 	 * Sends controller input events to the appropriate systems for processing.
-	 * This method is overridden to handle specific input events from the DualSense controller,
-	 * ensuring they are relayed correctly within the application.
+	 * Called by the application right after Tick when it polls the game devices. With
+	 * EInputSamplingPoint::SendControllerEvents the reports are consumed here.
 	 */
-	virtual void SendControllerEvents() override
-	{
-	}
+	virtual void SendControllerEvents() override;
 	/**
 	 * Sets the message handler for the application to process input events.
 	 *
@@ -204,6 +247,27 @@ protected:
 	 * @param Device Identifier of device to disconnect
 	 */
 	void Disconnect(const FInputDeviceId& Device) const;
+	/**
+	 * Consumes the pending input reports of every connected device and dispatches them
+	 * to the message handler, honoring the polling policy.
+	 */
+	void PollDevices();
+	/**
+	 * Frame-begin hook, polls the devices when the sampling point is EInputSamplingPoint::FrameBegin.
+	 */
+	void OnBeginFrame();
+	/**
+	 * Rebuilds the cached device-to-user bindings from the platform input device mapper.
+	 * Called on the first poll after a connection or login change.
+	 */
+	void RefreshDeviceBindings();
+	/**
+	 * Retrieves the hardware identifier reported to the input device scope for a device type.
+	 *
+	 * @param DeviceType The type of the connected device.
+	 * @return A string that lives for the whole program.
+	 */
+	static const FString& GetHardwareDeviceIdentifier(EDeviceType DeviceType);
 
 private:
 	/**
@@ -214,16 +278,48 @@ private:
 	 */
 	bool LazyLoading = false;
 	/**
-	 * Tracks the accumulated time or events between periodic polling operations.
-	 * This variable is typically used to manage timing or frequency of polling processes.
+	 * Defines how often connected devices are sampled. With NativeRate every report
+	 * read since the previous frame is delivered, so no input is lost at low frame rates.
+	 */
+	EPollingPolicy PollingPolicy = EPollingPolicy::NativeRate;
+	/**
+	 * Sampling rate, in Hz, used by EPollingPolicy::FixedRate. The samples are taken along the arrival
+	 * times of the reports, so the rate is not limited by the frame rate.
+	 */
+	float FixedPollRate = 125.0f;
+	/**
+	 * Highest report rate, in Hz, measured on the connected devices during the last poll.
+	 */
+	float DetectedReportRate = 0.0f;
+	/**
+	 * Point of the frame at which the buffered input reports are consumed.
+	 */
+	EInputSamplingPoint SamplingPoint = EInputSamplingPoint::SendControllerEvents;
+	/**
+	 * A connected input device and the platform user it is mapped to.
+	 */
+	struct FDeviceBinding
+	{
+		FInputDeviceId Device;
+		FPlatformUserId User;
+		/**
+		 * Hardware identifier reported to the input device scope, set on the first poll of the device.
+		 */
+		FString HardwareDeviceIdentifier;
+	};
+	/**
+	 * Cached device-to-user bindings polled every frame. Rebuilt only when marked dirty,
+	 * so the steady-state poll neither allocates nor queries the device mapper.
+	 */
+	TArray<FDeviceBinding> DeviceBindings;
+	/**
+	 * Scratch array for the connected devices, kept to reuse its allocation between refreshes.
 	 */
-	float PollAccumulator = 0.0f;
+	TArray<FInputDeviceId> ConnectedDevices;
 	/**
-	 * Defines the interval, in seconds, between periodic polling operations.
-	 * This variable determines how often certain tasks, such as device state checks
-	 * or updates, are performed within the system.
+	 * Set by connection and login changes, so the bindings are rebuilt on the next poll.
 	 */
-	float PollInterval = 0.016f;
+	bool bDeviceBindingsDirty = true;
 	/**
 	 * Interface pointer to platform-specific input device mapper.
 	 * This variable facilitates the mapping of input devices to platform-specific functionalities,
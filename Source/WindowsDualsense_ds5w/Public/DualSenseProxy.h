@@ -12,8 +12,14 @@
 #include "Runtime/ApplicationCore/Public/GenericPlatform/IInputInterface.h"
 #include "Core/Enums/EDeviceCommons.h"
 #include "Core/Structs/FDualSenseFeatureReport.h"
+#include "Core/Structs/FSonyGamepadBroadcastTarget.h"
+#include "Core/Structs/FSonyGamepadTriggerEffect.h"
+#include "Core/Structs/FSonyGamepadTriggerLayer.h"
 #include "DualSenseProxy.generated.h"
 
+class USonyGamepadTriggerPreset;
+class USonyGamepadTriggerTimeline;
+
 /**
  * @brief Proxy class for PlayStation DualSense controller interactions and effects.
  *
@@ -75,8 +81,10 @@ public:
 	 * @param EndStrength The ending vibration strength of the trigger effect. If invalid, a default value of 8 is used.
 	 * @param Hand The controller hand (left or right) to which the effect is applied.
 	 * @param KeepEffect Whether to keep the effect active continuously.
+	 * @param Layer The layer of the trigger effect stack the effect is written to, e.g. Environment for the
+	 * resistance of the ground or Feedback with a lifetime for a hit. Defaults to the Weapon layer.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects", meta = (AutoCreateRefTerm = "Layer"))
 	static void AutomaticGun(
 		int32 ControllerId,
 		UPARAM(DisplayName = "Begin Strength min: 0 max: 8", meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
@@ -86,7 +94,8 @@ public:
 		UPARAM(DisplayName = "End Strength min: 0 max: 8", meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
 		int32 EndStrength,
 		EControllerHand Hand,
-		bool KeepEffect
+		bool KeepEffect,
+		const FSonyGamepadTriggerLayer& Layer
 	);
 
 	/**
@@ -97,8 +106,9 @@ public:
 	 * @param MiddleStrength The strength of the feedback in the middle.
 	 * @param EndStrength The strength of the feedback at the end.
 	 * @param Hand The hand (left or right) associated with the controller.
+	 * @param Layer The layer of the trigger effect stack the effect is written to. Defaults to the Weapon layer.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects", meta = (AutoCreateRefTerm = "Layer"))
 	static void SetFeedback(
 		int32 ControllerId,
 		UPARAM(DisplayName = "Begin Strength min: 0 max: 8", meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
@@ -107,7 +117,8 @@ public:
 		int32 MiddleStrength,
 		UPARAM(DisplayName = "End Strength min: 0 max: 8", meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
 		int32 EndStrength,
-		EControllerHand Hand
+		EControllerHand Hand,
+		const FSonyGamepadTriggerLayer& Layer
 	);
 
 	/**
@@ -122,8 +133,9 @@ public:
 	 * @param EndPosition The ending position of the resistance zone within the trigger's range. Value must be between 0 and 8.
 	 * @param Strength The strength of the resistance effect. Value must be between 0 and 8, with higher values indicating stronger resistance.
 	 * @param Hand The trigger to apply the effect to, specified as EControllerHand (e.g., Left or Right).
+	 * @param Layer The layer of the trigger effect stack the effect is written to. Defaults to the Weapon layer.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects", meta = (AutoCreateRefTerm = "Layer"))
 	static void Resistance(
 		int32 ControllerId,
 		UPARAM(DisplayName = "Start Position min: 0 max: 8", meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
@@ -132,7 +144,8 @@ public:
 		int32 EndPosition,
 		UPARAM(DisplayName = "Strength min: 0 max: 8", meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
 		int32 Strength,
-		EControllerHand Hand
+		EControllerHand Hand,
+		const FSonyGamepadTriggerLayer& Layer
 	);
 
 	/**
@@ -142,15 +155,17 @@ public:
 	 * @param StartPosition The starting position of the resistance effect. Valid range determined by internal validation.
 	 * @param Strength The intensity of the resistance effect. Valid range determined by internal validation.
 	 * @param Hand The controller hand (e.g., left or right) to which the resistance effect applies.
+	 * @param Layer The layer of the trigger effect stack the effect is written to. Defaults to the Weapon layer.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects", meta = (AutoCreateRefTerm = "Layer"))
 	static void ContinuousResistance(
 		int32 ControllerId,
 		UPARAM(DisplayName = "Start Position min: 0 max: 8", meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
 		int32 StartPosition,
 		UPARAM(DisplayName = "Strength min: 0 max: 8", meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
 		int32 Strength,
-		EControllerHand Hand
+		EControllerHand Hand,
+		const FSonyGamepadTriggerLayer& Layer
 	);
 
 	/**
@@ -162,8 +177,9 @@ public:
 	 * @param BeginStrength The strength of the trigger's resistance at the starting position.
 	 * @param EndStrength The strength of the trigger's resistance at the ending position.
 	 * @param Hand The hand (left or right) where the effect will be applied.
+	 * @param Layer The layer of the trigger effect stack the effect is written to. Defaults to the Weapon layer.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects", meta = (AutoCreateRefTerm = "Layer"))
 	static void Bow(
 		int32 ControllerId,
 		UPARAM(meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
@@ -174,7 +190,8 @@ public:
 		int32 BeginStrength,
 		UPARAM(meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
 		int32 EndStrength,
-		EControllerHand Hand
+		EControllerHand Hand,
+		const FSonyGamepadTriggerLayer& Layer
 	);
 
 
@@ -192,8 +209,9 @@ public:
 	 * @param SecondFoot The intensity for the second "foot" step in the galloping effect.
 	 * @param Frequency The frequency at which the galloping effect repeats.
 	 * @param Hand Specifies whether the effect is applied to the left or right hand.
+	 * @param Layer The layer of the trigger effect stack the effect is written to. Defaults to the Weapon layer.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects", meta = (AutoCreateRefTerm = "Layer"))
 	static void Galloping(
 		int32 ControllerId,
 		UPARAM(meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
@@ -206,7 +224,8 @@ public:
 		int32 SecondFoot,
 		UPARAM(DisplayName = "Frequency Example: 0.015", meta = (ClampMin = "0.001", ClampMax = "1.0", UIMin = "0.001", UIMax = "1.0"))
 		float Frequency,
-		EControllerHand Hand
+		EControllerHand Hand,
+		const FSonyGamepadTriggerLayer& Layer
 	);
 
 	/**
@@ -220,8 +239,9 @@ public:
 	 * @param Frequency The frequency at which the haptic effect oscillates.
 	 * @param Period The period of the haptic cycle in seconds.
 	 * @param Hand Specifies which hand the effect is directed towards (left or right).
+	 * @param Layer The layer of the trigger effect stack the effect is written to. Defaults to the Weapon layer.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects", meta = (AutoCreateRefTerm = "Layer"))
 	static void Machine(
 		int32 ControllerId,
 		UPARAM(meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
@@ -236,7 +256,8 @@ public:
 		float Frequency,
 		UPARAM(meta = (ClampMin = "0.015", ClampMax = "1.0", UIMin = "0.01", UIMax = "1.0"))
 		float Period,
-		EControllerHand Hand
+		EControllerHand Hand,
+		const FSonyGamepadTriggerLayer& Layer
 	);
 
 	/**
@@ -247,8 +268,9 @@ public:
 	 * @param EndPosition The ending position of the effect in the trigger. The value should be validated and within the range of allowed positions.
 	 * @param Strength The strength of the weapon effect. The value should be validated and within the range of allowed strengths.
 	 * @param Hand Specifies which controller hand (left or right) should be affected by the weapon effect.
+	 * @param Layer The layer of the trigger effect stack the effect is written to. Defaults to the Weapon layer.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects", meta = (AutoCreateRefTerm = "Layer"))
 	static void Weapon(
 		int32 ControllerId,
 		UPARAM(DisplayName = "Start Position min: 2", meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
@@ -257,7 +279,8 @@ public:
 		int32 EndPosition,
 		UPARAM(DisplayName = "Strength max: 8", meta = (ClampMin = "0", ClampMax = "8", UIMin = "0", UIMax = "8"))
 		int32 Strength,
-		EControllerHand Hand
+		EControllerHand Hand,
+		const FSonyGamepadTriggerLayer& Layer
 	);
 
 	// /**
@@ -279,6 +302,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DualSense Led Effects")
 	static void LedPlayerEffects(int32 ControllerId, ELedPlayerEnum Value, ELedBrightnessEnum Brightness);
 
+	/**
+	 * Plays a pattern on the player LEDs from the output thread, over the LEDs set with LedPlayerEffects,
+	 * which come back when the pattern ends or is stopped. Replaces the pattern playing.
+	 *
+	 * @param ControllerId The identifier for the target controller.
+	 * @param Animation The pattern to play.
+	 * @param Delay Time before the pattern starts, in seconds.
+	 * @return False if the output of the controller is not scheduled.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DualSense Led Effects")
+	static bool PlayPlayerLedAnimation(int32 ControllerId, const FSonyGamepadPlayerLedAnimation& Animation, float Delay = 0.0f);
+
+	/**
+	 * Stops the player LED pattern of a controller.
+	 *
+	 * @param ControllerId The identifier for the target controller.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DualSense Led Effects")
+	static void StopPlayerLedAnimation(int32 ControllerId);
+
 	// /**
 	//  * Controls the LED and microphone visual effects on a DualSense controller.
 	//  *
@@ -345,6 +388,73 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DualSense Reset Effects")
 	static void StopAllTriggersEffects(int32 ControllerId);
 
+	/**
+	 * Clears one layer of the trigger effect stack of a controller, revealing the effects of the layers below it.
+	 *
+	 * @param ControllerId The ID of the DualSense controller.
+	 * @param Layer The layer to clear.
+	 * @param Hand The hand (left or right) whose trigger is cleared.
+	 * @param FadeOut Time over which the effect of the layer fades out, in seconds.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DualSense Reset Effects")
+	static void ClearTriggerLayer(int32 ControllerId, ESonyGamepadTriggerLayer Layer, EControllerHand Hand, float FadeOut = 0.0f);
+
+	/**
+	 * Applies a trigger preset to a controller. The preset was compiled when the asset was saved, so
+	 * applying it only copies its bytes.
+	 *
+	 * @param ControllerId The ID of the DualSense controller.
+	 * @param Preset The preset.
+	 * @param Hand The hand (left or right) to apply the effect to.
+	 * @param Layer The layer of the trigger effect stack the effect is written to. Defaults to the Weapon layer.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects", meta = (AutoCreateRefTerm = "Layer"))
+	static void ApplyTriggerPreset(int32 ControllerId, USonyGamepadTriggerPreset* Preset, EControllerHand Hand, const FSonyGamepadTriggerLayer& Layer);
+
+	/**
+	 * Plays a trigger timeline on a controller, replacing the timeline it plays. The keys are set by the
+	 * output thread at their exact offsets, independently of the frame rate.
+	 *
+	 * @param ControllerId The ID of the DualSense controller.
+	 * @param Timeline The timeline.
+	 * @param bLoop Restarts the timeline when it ends, until it is stopped.
+	 * @return False if the timeline is not set or the controller does not use the output thread.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	static bool PlayTriggerTimeline(int32 ControllerId, USonyGamepadTriggerTimeline* Timeline, bool bLoop = false);
+
+	/**
+	 * Stops the trigger timeline of a controller and clears its layer.
+	 *
+	 * @param ControllerId The ID of the DualSense controller.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DualSense Reset Effects")
+	static void StopTriggerTimeline(int32 ControllerId);
+
+	/**
+	 * Sets the same trigger effect on a set of controllers, on their Weapon layer. The effect is encoded
+	 * once and starts on every controller in the same output report cycle.
+	 *
+	 * @param Target The controllers: all of them, a team or a mask of IDs.
+	 * @param Effect The effect.
+	 * @param Hand The hand (left or right) to apply the effect to.
+	 * @return The number of controllers the effect was sent to.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	static int32 BroadcastTriggerEffect(const FSonyGamepadBroadcastTarget& Target, const FSonyGamepadTriggerEffect& Effect, EControllerHand Hand);
+
+	/**
+	 * Sets the same trigger preset on a set of controllers, on their Weapon layer. The effect starts on
+	 * every controller in the same output report cycle.
+	 *
+	 * @param Target The controllers: all of them, a team or a mask of IDs.
+	 * @param Preset The preset.
+	 * @param Hand The hand (left or right) to apply the effect to.
+	 * @return The number of controllers the effect was sent to.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DualSense Effects")
+	static int32 BroadcastTriggerPreset(const FSonyGamepadBroadcastTarget& Target, USonyGamepadTriggerPreset* Preset, EControllerHand Hand);
+
 	/**
 	 * Resets all haptic feedback effects for the specified DualSense controller.
 	 *
@@ -8,8 +8,27 @@
 #include "UObject/Object.h"
 #include "Core/Enums/EDeviceCommons.h"
 #include "Core/Enums/EDeviceConnection.h"
+#include "Core/Enums/EPollingPolicy.h"
+#include "Core/Enums/EInputSamplingPoint.h"
+#include "Core/Structs/FInputLatencyStats.h"
+#include "Core/Structs/FSonyGamepadBroadcastTarget.h"
+#include "Core/Structs/FSonyGamepadAnalogSettings.h"
+#include "Core/Structs/FSonyGamepadButtonRemap.h"
+#include "Core/Structs/FSonyGamepadGyroLookSettings.h"
+#include "Core/Structs/FSonyGamepadInputState.h"
+#include "Core/Structs/FSonyGamepadLateLatchSettings.h"
+#include "Core/Structs/FSonyGamepadLightAnimation.h"
+#include "Core/Structs/FSonyGamepadOutputBudget.h"
+#include "Core/Structs/FSonyGamepadOutputStats.h"
+#include "Core/Structs/FSonyGamepadPredictionSettings.h"
+#include "Core/Structs/FSonyGamepadPredictionStats.h"
+#include "Core/Structs/FSonyGamepadRumbleEnvelope.h"
+#include "Core/Structs/FSonyGamepadRumbleMix.h"
 #include "SonyGamepadProxy.generated.h"
 
+class UForceFeedbackEffect;
+class USonyGamepadHapticClip;
+
 
 /**
  * 
@@ -79,6 +98,345 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Status")
 	static float LevelBatteryDevice(int32 ControllerId);
+	/**
+	 * Retrieves the report rate measured on the DualSense or DualShock controller for the specified controller ID.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to query.
+	 * @return The number of input reports the controller sends per second, or 0.0f if it cannot be measured.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Status")
+	static float GetDeviceReportRate(int32 ControllerId);
+	/**
+	 * Sets how often the input of every connected DualSense or DualShock controller is sampled.
+	 *
+	 * @param Policy EveryFrame samples the latest report once per frame, FixedRate samples the reports buffered
+	 *               since the previous frame FixedRateHz apart, NativeRate delivers every report the controller
+	 *               produced since the previous frame.
+	 * @param FixedRateHz Sampling rate used by FixedRate. Rates above the report rate of the controller, around
+	 *                    250 Hz over USB, deliver every report.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Status")
+	static void SetPollingPolicy(
+		EPollingPolicy Policy,
+		UPARAM(meta = (ClampMin = "1.0", UIMin = "1.0", UIMax = "250.0"))
+		float FixedRateHz = 125.0f
+	);
+	/**
+	 * Sets at which point of the frame the input of every connected DualSense or DualShock controller is consumed.
+	 *
+	 * @param SamplingPoint SendControllerEvents and Tick sample when the application polls the game devices, FrameBegin
+	 *                      samples slightly earlier, at the start of the frame.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Status")
+	static void SetInputSamplingPoint(EInputSamplingPoint SamplingPoint);
+	/**
+	 * Retrieves the latency between the arrival of input reports and their dispatch to the engine
+	 * for the specified controller ID.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to query.
+	 * @param bReset If true, the statistics are cleared after being read.
+	 * @return The latency in milliseconds and in engine frames, empty if the library instance cannot be retrieved.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Status")
+	static FInputLatencyStats GetInputLatency(int32 ControllerId, bool bReset = false);
+	/**
+	 * Retrieves the latest full input state of the DualSense or DualShock controller for the specified controller ID,
+	 * without going through the input events. The state is updated as soon as a report arrives from the device.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to query.
+	 * @param OutState Receives the sticks, triggers, buttons, touch points, motion sensors and battery of the controller.
+	 * @return True if a state is available for the controller, false otherwise.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Input State")
+	static bool GetInputState(int32 ControllerId, FSonyGamepadInputState& OutState);
+	/**
+	 * Checks whether a button is pressed in an input state retrieved with GetInputState.
+	 *
+	 * @param State The input state to test.
+	 * @param Button The button to check.
+	 * @return True if the button is pressed.
+	 */
+	UFUNCTION(BlueprintPure, Category = "SonyGamepad: Dualsense or DualShock Input State")
+	static bool IsButtonDown(const FSonyGamepadInputState& State, ESonyGamepadButton Button);
+	/**
+	 * Reads the vectors of an input state retrieved with GetInputState, which the state stores in single
+	 * precision, and the values derived from its motion.
+	 *
+	 * @param State The input state to read.
+	 * @param LeftStick Receives the left stick, each axis in the [-1, 1] range, Y up.
+	 * @param RightStick Receives the right stick, each axis in the [-1, 1] range, Y up.
+	 * @param Touch1 Receives the position of the first finger on the touchpad, in device units.
+	 * @param Touch2 Receives the position of the second finger on the touchpad, in device units.
+	 * @param Orientation Receives the orientation of the controller, zero when it lies flat.
+	 * @param AngularVelocity Receives the angular velocity in the controller frame, in rad/s.
+	 * @param Gravity Receives the gravity in the controller frame, in m/s^2.
+	 * @param LinearAcceleration Receives the acceleration in the controller frame with gravity removed, in m/s^2.
+	 */
+	UFUNCTION(BlueprintPure, Category = "SonyGamepad: Dualsense or DualShock Input State")
+	static void BreakInputState(const FSonyGamepadInputState& State, FVector2D& LeftStick, FVector2D& RightStick,
+	                            FVector2D& Touch1, FVector2D& Touch2, FRotator& Orientation, FVector& AngularVelocity,
+	                            FVector& Gravity, FVector& LinearAcceleration);
+	/**
+	 * Retrieves the smoothed velocity of the fingers on the touchpad of the DualSense or DualShock controller,
+	 * tracked from every report on the input thread.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to query.
+	 * @param Touch1Velocity Receives the velocity of the first finger, in device units per second, zero while it is up.
+	 * @param Touch2Velocity Receives the velocity of the second finger, in device units per second, zero while it is up.
+	 * @return True if the touchpad of the controller is tracked, false otherwise.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Touch, Gyroscope and Accelerometer")
+	static bool GetTouchVelocity(int32 ControllerId, FVector2D& Touch1Velocity, FVector2D& Touch2Velocity);
+	/**
+	 * Retrieves the latest fused motion of the DualSense or DualShock controller, updated at the native rate of its IMU.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to query.
+	 * @param Orientation Receives the orientation of the controller, zero when it lies flat.
+	 * @param AngularVelocity Receives the angular velocity in the controller frame, in rad/s.
+	 * @param LinearAcceleration Receives the acceleration in the controller frame with gravity removed, in m/s^2.
+	 * @return True if a state is available for the controller, false otherwise.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Touch, Gyroscope and Accelerometer")
+	static bool GetMotionState(int32 ControllerId, FRotator& Orientation, FVector& AngularVelocity, FVector& LinearAcceleration);
+	/**
+	 * Configures the render-thread camera correction, which applies the controller rotation and right stick
+	 * movement that happened after the game thread computed the camera, right before the frame is rendered.
+	 *
+	 * @param Settings The controller, view and scales used by the correction.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Touch, Gyroscope and Accelerometer")
+	static void SetLateLatchSettings(const FSonyGamepadLateLatchSettings& Settings);
+	/**
+	 * Configures gyro aiming and flick stick for a controller. The rotation is integrated from every
+	 * report on the input thread and retrieved once per frame with ConsumeGyroLookDelta.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to configure.
+	 * @param Settings The sensitivity, acceleration, gyro space and flick stick settings.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Touch, Gyroscope and Accelerometer")
+	static void SetGyroLookSettings(int32 ControllerId, const FSonyGamepadGyroLookSettings& Settings);
+	/**
+	 * Retrieves the camera rotation accumulated from the gyroscope and flick stick since the previous call,
+	 * and restarts the accumulation. Call it once per frame, before applying the camera rotation.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to query.
+	 * @return Yaw (X) and pitch (Y) to add to the camera, in degrees.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Touch, Gyroscope and Accelerometer")
+	static FVector2D ConsumeGyroLookDelta(int32 ControllerId);
+	/**
+	 * Configures the extrapolation of the sticks and angular velocity of a controller, used by PredictInputState.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to configure.
+	 * @param Settings The fit window, and the horizon and maximum correction of each channel.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Prediction")
+	static void SetPredictionSettings(int32 ControllerId, const FSonyGamepadPredictionSettings& Settings);
+	/**
+	 * Predicts the input state of a controller at a time in the near future, e.g. when the frame being
+	 * computed will be presented. The sticks and angular velocity are extrapolated from the recent samples,
+	 * every other field is the latest state.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to query.
+	 * @param SecondsFromNow How far from now the target time is, in seconds.
+	 * @param OutState Receives the predicted state.
+	 * @return False if nothing was predicted: no state was published yet, or prediction is disabled and OutState is the latest state.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Prediction")
+	static bool PredictInputState(int32 ControllerId, float SecondsFromNow, FSonyGamepadInputState& OutState);
+	/**
+	 * Retrieves the error of the predictions of a controller against the values it later reported, with the
+	 * error of not predicting at all as a baseline.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to query.
+	 * @return The error statistics since the last reset.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Prediction")
+	static FSonyGamepadPredictionStats GetPredictionStats(int32 ControllerId);
+	/**
+	 * Clears the prediction error statistics of a controller, e.g. after changing its settings.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Prediction")
+	static void ResetPredictionStats(int32 ControllerId);
+	/**
+	 * Configures the deadzones, response curves and noise filtering of the sticks and triggers of a controller.
+	 * The settings are compiled into lookup tables and applied to every report on the input thread, so the
+	 * analog events, the published state and the history all carry the conditioned values.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to configure.
+	 * @param Settings The deadzone type and sizes, the response curves and the change epsilon.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Analog")
+	static void SetAnalogSettings(int32 ControllerId, const FSonyGamepadAnalogSettings& Settings);
+	/**
+	 * Activates a button remapping profile on a controller, e.g. to make the Edge paddles act as face buttons.
+	 * The profile applies to every report before the button events are generated, so the game only sees the
+	 * remapped buttons. Calling it again swaps the profile without interrupting the input.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to configure.
+	 * @param Profile The remapped and disabled buttons.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Remap")
+	static void SetButtonRemap(int32 ControllerId, const FSonyGamepadButtonRemap& Profile);
+	/**
+	 * Deactivates the button remapping profile of a controller, so every button keeps its own function.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller to configure.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Remap")
+	static void ClearButtonRemap(int32 ControllerId);
+	/**
+	 * Sets the bandwidth the output reports of all the controllers share. Updates that do not fit are
+	 * merged into the next report of their controller; rumble and trigger changes are sent first.
+	 *
+	 * @param Budget The rates and bursts of USB, Bluetooth and each Bluetooth adapter.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Output")
+	static void SetOutputBudget(const FSonyGamepadOutputBudget& Budget);
+	/**
+	 * Declares which Bluetooth adapter a controller is paired with, so controllers on different radios
+	 * do not share the same adapter budget. Every controller starts on adapter 0.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 * @param AdapterId Any number identifying the adapter.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Output")
+	static void SetOutputAdapter(int32 ControllerId, int32 AdapterId);
+	/**
+	 * Retrieves the activity of the output scheduler: reports sent, merged and deferred, and their queue delay.
+	 *
+	 * @return The statistics since the last reset, across all the controllers.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Output")
+	static FSonyGamepadOutputStats GetOutputStats();
+	/**
+	 * Clears the statistics of the output scheduler, e.g. after changing the budget.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Output")
+	static void ResetOutputStats();
+
+	/**
+	 * Plays a force feedback effect on the output thread. The curves are baked once here and sampled
+	 * by the output thread at a fixed rate, so nothing has to be pushed every frame while it plays.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 * @param Effect The force feedback effect. The large and small motors of each side are merged.
+	 * @param Delay Time before the effect starts, in seconds.
+	 * @param Scale Multiplier applied to the curves.
+	 * @param bLoop Restarts the effect when it ends, until it is stopped.
+	 * @return A handle to stop the effect with, or 0 if it can not be played.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Force Feedback")
+	static int32 PlayForceFeedback(int32 ControllerId, UForceFeedbackEffect* Effect, float Delay = 0.0f, float Scale = 1.0f, bool bLoop = false);
+	/**
+	 * Plays an attack, decay, sustain and release envelope on the output thread.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 * @param Envelope The envelope.
+	 * @param Delay Time before the envelope starts, in seconds.
+	 * @return A handle to stop the envelope with, or 0 if it can not be played.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Force Feedback")
+	static int32 PlayRumbleEnvelope(int32 ControllerId, const FSonyGamepadRumbleEnvelope& Envelope, float Delay = 0.0f);
+	/**
+	 * Stops an effect or envelope. An envelope fades out over its release time.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 * @param Handle The handle returned when it was played, or 0 to stop everything the controller plays.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Force Feedback")
+	static void StopRumble(int32 ControllerId, int32 Handle);
+	/**
+	 * Plays a haptic clip, streamed from its compiled file by the output thread. A clip already playing
+	 * on the controller is replaced, or cross-faded into the new one.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 * @param Clip The haptic clip.
+	 * @param StartPosition Position to start from, in seconds.
+	 * @param bLoop Restarts the clip when it ends, until it is stopped.
+	 * @param CrossFade Time over which the clip fades in and the previous one fades out, in seconds.
+	 * @return False if the clip can not be opened or the controller is not connected.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Force Feedback")
+	static bool PlayHapticClip(int32 ControllerId, USonyGamepadHapticClip* Clip, float StartPosition = 0.0f, bool bLoop = false, float CrossFade = 0.0f);
+	/**
+	 * Stops the haptic clip playing on a controller.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 * @param FadeOut Time over which the clip fades out, in seconds.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Force Feedback")
+	static void StopHapticClip(int32 ControllerId, float FadeOut = 0.0f);
+	/**
+	 * Moves the haptic clip playing on a controller to a position.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 * @param Position The position, in seconds from the start of the clip.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Force Feedback")
+	static void SeekHapticClip(int32 ControllerId, float Position);
+	/**
+	 * Sets the rumble of one source, played until the source sets another value. The sources are mixed
+	 * into the rumble of the controller with the settings of SetRumbleMix.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 * @param Source The source, e.g. UI for menu feedback.
+	 * @param LeftMotor Level of the left motor, from 0 to 1.
+	 * @param RightMotor Level of the right motor, from 0 to 1.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Force Feedback")
+	static void SetSourceRumble(int32 ControllerId, ESonyGamepadRumbleSource Source, float LeftMotor, float RightMotor);
+	/**
+	 * Replaces the priority, gain and blend mode of the rumble sources, for every controller.
+	 *
+	 * @param RumbleMix The settings of each source.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Force Feedback")
+	static void SetRumbleMix(const FSonyGamepadRumbleMix& RumbleMix);
+	/**
+	 * Retrieves how often each rumble source of a controller was updated, rumbled and ducked since the
+	 * output statistics were reset.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 * @return The activity of each source.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Force Feedback")
+	static TArray<FSonyGamepadRumbleSourceStats> GetRumbleSourceStats(int32 ControllerId);
+
+	/**
+	 * Assigns a controller to a team, so broadcasts can target the team. Every controller starts in
+	 * team 0 and keeps its team when it reconnects.
+	 *
+	 * @param ControllerId The ID of the DualSense or DualShock controller.
+	 * @param Team Any number identifying the team.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Broadcast")
+	static void SetControllerTeam(int32 ControllerId, int32 Team);
+	/**
+	 * Sets the same lightbar color on a set of controllers with one command. The color changes on every
+	 * controller in the same output report cycle.
+	 *
+	 * @param Target The controllers: all of them, a team or a mask of IDs.
+	 * @param Color The color.
+	 * @return The number of controllers the color was sent to.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Broadcast")
+	static int32 BroadcastLightbar(const FSonyGamepadBroadcastTarget& Target, FColor Color);
+	/**
+	 * Sets the same rumble on a set of controllers with one command. The rumble starts on every
+	 * controller in the same output report cycle.
+	 *
+	 * @param Target The controllers: all of them, a team or a mask of IDs.
+	 * @param LeftMotor The level of the left motor, between 0 and 1.
+	 * @param RightMotor The level of the right motor, between 0 and 1.
+	 * @param Source The rumble source the level is mixed as.
+	 * @return The number of controllers the rumble was sent to.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Broadcast")
+	static int32 BroadcastRumble(const FSonyGamepadBroadcastTarget& Target, float LeftMotor, float RightMotor,
+	                             ESonyGamepadRumbleSource Source = ESonyGamepadRumbleSource::Gameplay);
 
 	/**
 	 * Updates the LED color effects on a DualSense controller using the specified color.
@@ -105,6 +463,36 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Led Effects")
 	static void LedMicEffects(int32 ControllerId, ELedMicEnum Value);
 
+	/**
+	 * Plays a lightbar animation on the output thread, over the color set with LedColorEffects, which
+	 * comes back when the animation ends or is stopped. Replaces the animation playing.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Animation The gradient, pulse, breath or rainbow to play.
+	 * @param Delay Time before the animation starts, in seconds.
+	 * @return False if the output of the controller is not scheduled.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Led Effects")
+	static bool PlayLightbarAnimation(int32 ControllerId, const FSonyGamepadLightbarAnimation& Animation, float Delay = 0.0f);
+
+	/**
+	 * Stops the lightbar animation of a controller.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Led Effects")
+	static void StopLightbarAnimation(int32 ControllerId);
+
+	/**
+	 * Moves the value a gradient driven by a value is sampled at, e.g. the health of the player. Only
+	 * needs to be called when the value changes; the color blends to it on the output thread.
+	 *
+	 * @param ControllerId The ID of the controller.
+	 * @param Value The value, in the unit of the times of the keys of the gradient.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SonyGamepad: Dualsense or DualShock Led Effects")
+	static void SetLightbarAnimationValue(int32 ControllerId, float Value);
+
 	/**
 	 * Enables or disables the touch functionality on a specified DualSense controller.
 	 *
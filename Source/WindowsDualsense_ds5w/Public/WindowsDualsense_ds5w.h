@@ -8,6 +8,7 @@
 #include "DeviceManager.h"
 #include "IInputDeviceModule.h"
 #include "InputCoreTypes.h"
+#include "Core/Rendering/SonyGamepadViewExtension.h"
 
 
 /**
@@ -51,6 +52,24 @@ public:
 	 */
 	virtual TSharedPtr<IInputDevice> CreateInputDevice(
 		const TSharedRef<FGenericApplicationMessageHandler>& InCustomMessageHandler) override;
+	/**
+	 * Retrieves the input device created by this module.
+	 *
+	 * @return A shared pointer to the device manager, or nullptr if the input device was not created yet.
+	 */
+	TSharedPtr<DeviceManager> GetDeviceManager() const
+	{
+		return DeviceInstance;
+	}
+	/**
+	 * Retrieves the scene view extension applying the render-thread camera correction.
+	 *
+	 * @return A shared pointer to the extension, or nullptr before the engine finished initializing.
+	 */
+	TSharedPtr<FSonyGamepadViewExtension, ESPMode::ThreadSafe> GetViewExtension() const
+	{
+		return ViewExtension;
+	}
 
 	/**
 	 * A shared pointer that manages an instance of the DualSense input device.
@@ -60,6 +79,15 @@ public:
 	 */
 private:
 	TSharedPtr<DeviceManager> DeviceInstance;
+	/**
+	 * Scene view extension late-latching the controller motion into the camera.
+	 * Created once the engine is initialized, since view extensions are registered with GEngine.
+	 */
+	TSharedPtr<FSonyGamepadViewExtension, ESPMode::ThreadSafe> ViewExtension;
+	/**
+	 * Registers the scene view extension, called when the engine finished initializing.
+	 */
+	void RegisterViewExtension();
 	/**
 	 * Registers a set of custom input keys for PlayStation-specific controls.
 	 *
@@ -11,9 +11,15 @@ public class WindowsDualsense_ds5w : ModuleRules
 	{
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
  		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "ApplicationCore", "InputCore", "InputDevice",  "AudioMixer" });
-	    PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
+	    PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore", "RenderCore", "RHI" });
 	    bEnableExceptions = true;
 	    
+	    if (Target.bBuildEditor)
+	    {
+		    // The haptic clips check the packaging settings while cooking.
+		    PrivateDependencyModuleNames.Add("DeveloperToolSettings");
+	    }
+
 	    if (Target.Platform == UnrealTargetPlatform.Win64)
 	    {
 		    PublicSystemLibraries.Add("hid.lib");